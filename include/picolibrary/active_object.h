@@ -0,0 +1,609 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary active object interface.
+ */
+
+#ifndef PICOLIBRARY_ACTIVE_OBJECT_H
+#define PICOLIBRARY_ACTIVE_OBJECT_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/error.h"
+#include "picolibrary/event.h"
+#include "picolibrary/event_pool.h"
+#include "picolibrary/interrupt.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Fixed capacity event queue.
+ *
+ * Events are stored in place (without being copied into separately allocated storage),
+ * in fixed size event storage slots. Events allocated from an event pool (see
+ * picolibrary::Event_Pool) are queued by storing a picolibrary::Event_Handle to the event
+ * in the event storage slot, which allows a single event to be queued in multiple queues
+ * without being copied.
+ *
+ * The main thread of execution removes events from the queue. Both the main thread of
+ * execution and interrupts can add events to the queue.
+ *
+ * \attention Interrupts that add events to the queue must not be interrupted by other
+ *            interrupts that also add events to the queue.
+ *
+ * \tparam EVENT_SIZE The size of each event storage slot (must be at least as large as
+ *         the largest event that will be added to the queue, and at least as large as a
+ *         picolibrary::Event_Handle if event handles will be added to the queue).
+ * \tparam Size_Type The unsigned integer type used to track the number of events in the
+ *         queue.
+ * \tparam N The maximum number of events in the queue (must be a power of two).
+ * \tparam Interrupt_Controller The type of interrupt controller used by the main thread
+ *         of execution to manipulate the interrupt enable state of any interrupts that
+ *         add events to the queue.
+ */
+template<std::size_t EVENT_SIZE, typename Size_Type, Size_Type N, typename Interrupt_Controller>
+class Event_Queue {
+  public:
+    static_assert( std::is_unsigned_v<Size_Type> );
+
+    static_assert( is_power_of_two( N ) );
+
+    /**
+     * \brief The number of events in the queue.
+     */
+    using Size = Size_Type;
+
+    Event_Queue() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] interrupt_controller The interrupt controller used by the main thread of
+     *            execution to manipulate the interrupt enable state of interrupts that add
+     *            events to the queue.
+     */
+    Event_Queue( Interrupt_Controller interrupt_controller ) noexcept :
+        m_interrupt_controller{ std::move( interrupt_controller ) }
+    {
+    }
+
+    Event_Queue( Event_Queue && ) = delete;
+
+    Event_Queue( Event_Queue const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Event_Queue() noexcept
+    {
+        clear();
+    }
+
+    auto operator=( Event_Queue && ) = delete;
+
+    auto operator=( Event_Queue const & ) = delete;
+
+    /**
+     * \brief Check if the queue is empty.
+     *
+     * \return true if the queue is empty.
+     * \return false if the queue is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    /**
+     * \brief Check if the queue is full.
+     *
+     * \return true if the queue is full.
+     * \return false if the queue is not full.
+     */
+    [[nodiscard]] auto full() const noexcept -> bool
+    {
+        return size() == N;
+    }
+
+    /**
+     * \brief Check if the queue is full.
+     *
+     * \return true if the queue is full.
+     * \return false if the queue is not full.
+     */
+    [[nodiscard]] auto full_from_interrupt() const noexcept -> bool
+    {
+        return size_from_interrupt() == N;
+    }
+
+    /**
+     * \brief Get the number of events in the queue.
+     *
+     * \return The number of events in the queue.
+     */
+    auto size() const noexcept -> Size
+    {
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        return m_size;
+    }
+
+    /**
+     * \brief Get the number of events in the queue.
+     *
+     * \return The number of events in the queue.
+     */
+    auto size_from_interrupt() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Get the maximum number of events the queue is able to hold.
+     *
+     * \return The maximum number of events the queue is able to hold.
+     */
+    static constexpr auto max_size() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Add an event to the back of the queue.
+     *
+     * \pre not picolibrary::Event_Queue::full()
+     *
+     * \tparam Event The type of event to add.
+     *
+     * \param[in] event The event to add.
+     */
+    template<typename Event>
+    void post( Event && event ) noexcept
+    {
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        post_from_interrupt( std::forward<Event>( event ) );
+    }
+
+    /**
+     * \brief Add an event to the back of the queue.
+     *
+     * \pre not picolibrary::Event_Queue::full_from_interrupt()
+     * \pre if event is a picolibrary::Event_Handle, event is not a null handle
+     *
+     * \tparam Event The type of event to add (or picolibrary::Event_Handle to add an
+     *         event allocated from an event pool).
+     *
+     * \param[in] event The event to add.
+     */
+    template<typename Event>
+    void post_from_interrupt( Event && event ) noexcept
+    {
+        using Stored_Event = std::decay_t<Event>;
+
+        static_assert(
+            std::is_base_of_v<::picolibrary::Event, Stored_Event>
+            or std::is_same_v<Stored_Event, Event_Handle> );
+        static_assert( sizeof( Stored_Event ) <= EVENT_SIZE );
+        static_assert( alignof( Stored_Event ) <= alignof( Storage ) );
+
+        PICOLIBRARY_EXPECT( not full_from_interrupt(), Generic_Error::WOULD_OVERFLOW );
+
+        auto const write = Index{ m_write };
+
+        if constexpr ( std::is_same_v<Stored_Event, Event_Handle> ) {
+            PICOLIBRARY_EXPECT( static_cast<bool>( event ), Generic_Error::INVALID_ARGUMENT );
+
+            m_is_handle[ write ] = true;
+        } else {
+            m_is_handle[ write ] = false;
+        } // else
+
+        new ( &m_storage[ write ] ) Stored_Event{ std::forward<Event>( event ) };
+
+        // the event must be fully constructed before the main thread of execution is able
+        // to see it
+        std::atomic_signal_fence( std::memory_order_release );
+
+        m_write = ( write + 1 ) & index_wrap_around_mask();
+
+        ++m_size;
+    }
+
+    /**
+     * \brief Access the event at the front of the queue.
+     *
+     * \pre not picolibrary::Event_Queue::empty()
+     *
+     * \return The event at the front of the queue.
+     */
+    auto front() noexcept -> Event const &
+    {
+        PICOLIBRARY_EXPECT( not empty(), Generic_Error::WOULD_UNDERFLOW );
+
+        std::atomic_signal_fence( std::memory_order_acquire );
+
+        return m_is_handle[ m_read ] ? handle( m_read ).event() : event( m_read );
+    }
+
+    /**
+     * \brief Remove the event at the front of the queue.
+     *
+     * \pre not picolibrary::Event_Queue::empty()
+     */
+    void pop() noexcept
+    {
+        PICOLIBRARY_EXPECT( not empty(), Generic_Error::WOULD_UNDERFLOW );
+
+        if ( m_is_handle[ m_read ] ) {
+            handle( m_read ).~Event_Handle();
+        } else {
+            event( m_read ).~Event();
+        } // else
+
+        m_read = ( m_read + 1 ) & index_wrap_around_mask();
+
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        --m_size;
+    }
+
+    /**
+     * \brief Remove all events from the queue.
+     */
+    void clear() noexcept
+    {
+        while ( not empty() ) { pop(); } // while
+    }
+
+  private:
+    /**
+     * \brief Event storage slot.
+     */
+    using Storage = std::aligned_storage_t<EVENT_SIZE, alignof( std::max_align_t )>;
+
+    /**
+     * \brief Event storage slot index.
+     */
+    using Index = Size;
+
+    /**
+     * \brief The event storage slot read index.
+     */
+    Index m_read{ 0 };
+
+    /**
+     * \brief The event storage slot write index.
+     */
+    Index volatile m_write{ 0 };
+
+    /**
+     * \brief The number of events in the queue.
+     */
+    Size volatile m_size{ 0 };
+
+    /**
+     * \brief The event storage slots.
+     */
+    Storage m_storage[ N ];
+
+    /**
+     * \brief Event storage slot event handle flags (true if the corresponding event storage
+     *        slot holds a picolibrary::Event_Handle instead of an event).
+     */
+    bool m_is_handle[ N ]{};
+
+    /**
+     * \brief The interrupt controller used by the main thread of execution to manipulate
+     *        the interrupt enable state of interrupts that add events to the queue.
+     */
+    mutable Interrupt_Controller m_interrupt_controller;
+
+    /**
+     * \brief Get the event storage slot index wrap around mask.
+     *
+     * \return The event storage slot index wrap around mask.
+     */
+    static constexpr auto index_wrap_around_mask() noexcept -> Index
+    {
+        return N - 1;
+    }
+
+    /**
+     * \brief Access the event in an event storage slot.
+     *
+     * \param[in] index The index of the event storage slot.
+     *
+     * \return The event in the event storage slot.
+     */
+    auto event( Index index ) noexcept -> Event &
+    {
+        return *std::launder( reinterpret_cast<Event *>( &m_storage[ index ] ) );
+    }
+
+    /**
+     * \brief Access the event handle in an event storage slot.
+     *
+     * \param[in] index The index of the event storage slot.
+     *
+     * \return The event handle in the event storage slot.
+     */
+    auto handle( Index index ) noexcept -> Event_Handle &
+    {
+        return *std::launder( reinterpret_cast<Event_Handle *>( &m_storage[ index ] ) );
+    }
+};
+
+/**
+ * \brief Active object scheduler interface.
+ *
+ * Active objects that have been attached to a scheduler notify the scheduler whenever an
+ * event is posted to them.
+ */
+class Active_Object_Scheduler {
+  public:
+    /**
+     * \brief Active object priority.
+     */
+    using Priority = std::uint_fast8_t;
+
+    /**
+     * \brief Notify the scheduler that an active object has events waiting to be
+     *        processed.
+     *
+     * \param[in] priority The active object's priority.
+     */
+    virtual void make_ready( Priority priority ) noexcept = 0;
+
+    /**
+     * \brief Notify the scheduler that an active object has events waiting to be
+     *        processed (from an interrupt).
+     *
+     * \param[in] priority The active object's priority.
+     */
+    virtual void make_ready_from_interrupt( Priority priority ) noexcept = 0;
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Active_Object_Scheduler() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Active_Object_Scheduler( Active_Object_Scheduler && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Active_Object_Scheduler( Active_Object_Scheduler const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Active_Object_Scheduler() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Active_Object_Scheduler && expression ) noexcept
+        -> Active_Object_Scheduler & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Active_Object_Scheduler const & expression ) noexcept
+        -> Active_Object_Scheduler & = default;
+};
+
+/**
+ * \brief Active object (a state machine that owns an event queue, and that processes
+ *        queued events one at a time, with each event's processing running to completion
+ *        before the next event is processed).
+ *
+ * Events can be posted to an active object from the main thread of execution or from
+ * interrupts (e.g. to hand off events detected by interrupt service routines without
+ * polling). Queued events are processed by the main thread of execution.
+ *
+ * \tparam Derived The derived class. The derived class must provide a
+ *         void dispatch( picolibrary::Event const & event ) member function (e.g.
+ *         picolibrary::State_Machine::dispatch() or picolibrary::HSM::dispatch()) that
+ *         is accessible to picolibrary::Active_Object.
+ * \tparam EVENT_SIZE The size of each event queue event storage slot (must be at least as
+ *         large as the largest event that will be posted to the active object).
+ * \tparam Size_Type The unsigned integer type used to track the number of events in the
+ *         event queue.
+ * \tparam N The maximum number of events in the event queue (must be a power of two).
+ * \tparam Interrupt_Controller The type of interrupt controller used by the main thread
+ *         of execution to manipulate the interrupt enable state of any interrupts that
+ *         post events to the active object.
+ */
+template<typename Derived, std::size_t EVENT_SIZE, typename Size_Type, Size_Type N, typename Interrupt_Controller>
+class Active_Object {
+  public:
+    /**
+     * \brief The active object's event queue type.
+     */
+    using Event_Queue = ::picolibrary::Event_Queue<EVENT_SIZE, Size_Type, N, Interrupt_Controller>;
+
+    /**
+     * \brief Check if the active object has events waiting to be processed.
+     *
+     * \return true if the active object has events waiting to be processed.
+     * \return false if the active object does not have events waiting to be processed.
+     */
+    auto has_pending_events() const noexcept -> bool
+    {
+        return not m_event_queue.empty();
+    }
+
+    /**
+     * \brief Post an event to the active object.
+     *
+     * \pre the active object's event queue is not full
+     *
+     * \tparam Event The type of event to post (or picolibrary::Event_Handle to post an
+     *         event allocated from an event pool).
+     *
+     * \param[in] event The event to post.
+     */
+    template<typename Event>
+    void post( Event && event ) noexcept
+    {
+        m_event_queue.post( std::forward<Event>( event ) );
+
+        if ( m_scheduler ) {
+            m_scheduler->make_ready( m_priority );
+        } // if
+    }
+
+    /**
+     * \brief Post an event to the active object from an interrupt.
+     *
+     * \pre the active object's event queue is not full
+     *
+     * \tparam Event The type of event to post (or picolibrary::Event_Handle to post an
+     *         event allocated from an event pool).
+     *
+     * \param[in] event The event to post.
+     */
+    template<typename Event>
+    void post_from_interrupt( Event && event ) noexcept
+    {
+        m_event_queue.post_from_interrupt( std::forward<Event>( event ) );
+
+        if ( m_scheduler ) {
+            m_scheduler->make_ready_from_interrupt( m_priority );
+        } // if
+    }
+
+    /**
+     * \brief Attach the active object to a scheduler.
+     *
+     * \param[in] scheduler The scheduler to notify when an event is posted to the active
+     *            object.
+     * \param[in] priority The active object's priority.
+     */
+    void attach( Active_Object_Scheduler & scheduler, Active_Object_Scheduler::Priority priority ) noexcept
+    {
+        m_scheduler = &scheduler;
+        m_priority  = priority;
+    }
+
+    /**
+     * \brief Dispatch the event at the front of the event queue (if any) to the active
+     *        object and remove it from the event queue.
+     *
+     * \return true if an event was processed.
+     * \return false if there were no events to process.
+     */
+    auto process_event() noexcept -> bool
+    {
+        if ( m_event_queue.empty() ) {
+            return false;
+        } // if
+
+        static_cast<Derived &>( *this ).dispatch( m_event_queue.front() );
+
+        m_event_queue.pop();
+
+        return true;
+    }
+
+    /**
+     * \brief Process events until the event queue is empty (including events posted
+     *        while processing events).
+     */
+    void process_events() noexcept
+    {
+        while ( process_event() ) {} // while
+    }
+
+  protected:
+    Active_Object() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] interrupt_controller The interrupt controller used by the main thread of
+     *            execution to manipulate the interrupt enable state of interrupts that
+     *            post events to the active object.
+     */
+    Active_Object( Interrupt_Controller interrupt_controller ) noexcept :
+        m_event_queue{ std::move( interrupt_controller ) }
+    {
+    }
+
+    Active_Object( Active_Object && ) = delete;
+
+    Active_Object( Active_Object const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Active_Object() noexcept = default;
+
+    auto operator=( Active_Object && ) = delete;
+
+    auto operator=( Active_Object const & ) = delete;
+
+  private:
+    /**
+     * \brief The active object's event queue.
+     */
+    Event_Queue m_event_queue;
+
+    /**
+     * \brief The scheduler the active object is attached to (nullptr if the active object
+     *        is not attached to a scheduler).
+     */
+    Active_Object_Scheduler * m_scheduler{};
+
+    /**
+     * \brief The active object's priority.
+     */
+    Active_Object_Scheduler::Priority m_priority{};
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_ACTIVE_OBJECT_H
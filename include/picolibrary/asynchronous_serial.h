@@ -371,6 +371,20 @@ class Reliable_Unbuffered_Output_Stream_Buffer final : public Reliable_Stream_Bu
             reinterpret_cast<std::uint8_t const *>( end ) );
     }
 
+    /**
+     * \brief Transmit a sequence of blocks of unsigned bytes.
+     *
+     * \param[in] begin The beginning of the sequence of blocks of unsigned bytes to
+     *            transmit.
+     * \param[in] end The end of the sequence of blocks of unsigned bytes to transmit.
+     */
+    void put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept override final
+    {
+        ::picolibrary::for_each( begin, end, [ this ]( auto segment ) noexcept {
+            m_transmitter.transmit( segment.begin, segment.end );
+        } );
+    }
+
     /**
      * \brief Do nothing.
      */
@@ -391,7 +405,8 @@ class Reliable_Unbuffered_Output_Stream_Buffer final : public Reliable_Stream_Bu
  * \tparam Transmitter The type of transmitter to abstract with the stream.
  */
 template<typename Transmitter>
-class Reliable_Unbuffered_Output_Stream : public Reliable_Output_Stream {
+class Reliable_Unbuffered_Output_Stream :
+    public Static_Output_Stream<Reliable_Unbuffered_Output_Stream_Buffer<Transmitter>> {
   public:
     /**
      * \brief Constructor.
@@ -406,7 +421,7 @@ class Reliable_Unbuffered_Output_Stream : public Reliable_Output_Stream {
     constexpr Reliable_Unbuffered_Output_Stream( Transmitter transmitter ) noexcept :
         m_buffer{ std::move( transmitter ) }
     {
-        set_buffer( &m_buffer );
+        this->set_buffer( &m_buffer );
     }
 
     /**
@@ -417,7 +432,7 @@ class Reliable_Unbuffered_Output_Stream : public Reliable_Output_Stream {
     constexpr Reliable_Unbuffered_Output_Stream( Reliable_Unbuffered_Output_Stream && source ) noexcept
     {
         if ( source.buffer_is_set() ) {
-            set_buffer( &m_buffer );
+            this->set_buffer( &m_buffer );
 
             source.set_buffer( nullptr );
         } // if
@@ -444,11 +459,11 @@ class Reliable_Unbuffered_Output_Stream : public Reliable_Output_Stream {
             m_buffer = std::move( expression.m_buffer );
 
             if ( expression.buffer_is_set() ) {
-                set_buffer( &m_buffer );
+                this->set_buffer( &m_buffer );
 
                 expression.set_buffer( nullptr );
             } else {
-                set_buffer( nullptr );
+                this->set_buffer( nullptr );
             } // else
         }     // if
 
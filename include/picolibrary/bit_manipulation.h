@@ -51,6 +51,38 @@ constexpr auto highest_bit_set( T value ) noexcept -> std::uint_fast8_t
     return bit;
 }
 
+/**
+ * \brief Lookup an unsigned integer's lowest bit set (find first set).
+ *
+ * \tparam T The type of unsigned integer the lookup will be performed on.
+ *
+ * \param[in] value The value whose lowest bit set is to be looked up (assumed to be
+ *            non-zero).
+ *
+ * \return The value's lowest bit set.
+ */
+template<typename T>
+constexpr auto lowest_bit_set( T value ) noexcept -> std::uint_fast8_t
+{
+    static_assert( std::is_unsigned_v<T> );
+
+#ifdef __GNUC__
+    if constexpr ( sizeof( T ) <= sizeof( unsigned int ) ) {
+        return static_cast<std::uint_fast8_t>( __builtin_ctz( value ) );
+    } else if constexpr ( sizeof( T ) <= sizeof( unsigned long ) ) {
+        return static_cast<std::uint_fast8_t>( __builtin_ctzl( value ) );
+    } else {
+        return static_cast<std::uint_fast8_t>( __builtin_ctzll( value ) );
+    } // else
+#else  // __GNUC__
+    auto bit = std::uint_fast8_t{ 0 };
+
+    for ( ; not( value & 1 ); value >>= 1, ++bit ) {} // for
+
+    return bit;
+#endif // __GNUC__
+}
+
 /**
  * \brief Create a bit mask.
  *
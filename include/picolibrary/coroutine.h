@@ -0,0 +1,897 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Coroutine interface.
+ *
+ * The facilities defined in this header are only available when compiling with C++20
+ * (or later) coroutine support.
+ */
+
+#ifndef PICOLIBRARY_COROUTINE_H
+#define PICOLIBRARY_COROUTINE_H
+
+#if defined( __cpp_impl_coroutine ) && __cpp_impl_coroutine >= 201902L
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/error.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/timer.h"
+
+/**
+ * \brief C++20 coroutine facilities.
+ */
+namespace picolibrary::Coroutine {
+
+/**
+ * \brief Wake signal.
+ *
+ * A wake signal is notified (e.g. by a socket interrupt service routine, or by a timer)
+ * when an operation that a parked coroutine is waiting on may be able to make progress.
+ *
+ * Each notification advances the signal's generation. Each coroutine parked on a signal
+ * records the generation it last observed, so any number of coroutines can be parked on
+ * the same signal without one coroutine's retry consuming another coroutine's wakeup.
+ */
+class Wake_Signal {
+  public:
+    /**
+     * \brief Signal generation.
+     *
+     * A generation is a single byte so that it is read and written atomically on 8-bit
+     * targets. A generation wraps around after 256 notifications.
+     */
+    using Generation = std::uint8_t;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Wake_Signal() noexcept = default;
+
+    Wake_Signal( Wake_Signal && ) = delete;
+
+    Wake_Signal( Wake_Signal const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Wake_Signal() noexcept = default;
+
+    auto operator=( Wake_Signal && ) = delete;
+
+    auto operator=( Wake_Signal const & ) = delete;
+
+    /**
+     * \brief Notify the signal (can be called from an interrupt).
+     */
+    void notify() noexcept
+    {
+        std::atomic_signal_fence( std::memory_order_release );
+
+        m_generation = static_cast<Generation>( m_generation + 1 );
+    }
+
+    /**
+     * \brief Get the signal's generation.
+     *
+     * \return The signal's generation.
+     */
+    auto generation() const noexcept -> Generation
+    {
+        auto const generation = m_generation;
+
+        std::atomic_signal_fence( std::memory_order_acquire );
+
+        return generation;
+    }
+
+  private:
+    /**
+     * \brief The signal's generation.
+     */
+    Generation volatile m_generation{};
+};
+
+/**
+ * \brief Coroutine task (a coroutine that can be spawned on a
+ *        picolibrary::Coroutine::Executor).
+ *
+ * A task's coroutine is suspended until the task is spawned on an executor.
+ */
+class Task {
+  public:
+    /**
+     * \brief Coroutine promise.
+     */
+    class promise_type {
+      public:
+        /**
+         * \brief Parked coroutine retry function.
+         *
+         * \param[in] awaiter The awaiter the coroutine is parked on.
+         *
+         * \return true if the operation the coroutine is parked on has completed.
+         * \return false if the operation the coroutine is parked on would still block.
+         */
+        using Retry = auto ( * )( void * awaiter ) noexcept -> bool;
+
+        /**
+         * \brief Constructor.
+         */
+        constexpr promise_type() noexcept = default;
+
+        promise_type( promise_type && ) = delete;
+
+        promise_type( promise_type const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~promise_type() noexcept = default;
+
+        auto operator=( promise_type && ) = delete;
+
+        auto operator=( promise_type const & ) = delete;
+
+        /**
+         * \brief Get the task that owns the coroutine.
+         *
+         * \return The task that owns the coroutine.
+         */
+        auto get_return_object() noexcept -> Task
+        {
+            return Task{ std::coroutine_handle<promise_type>::from_promise( *this ) };
+        }
+
+        /**
+         * \brief Get the task to return if the coroutine frame could not be allocated.
+         *
+         * \return A task that does not own a coroutine.
+         */
+        static auto get_return_object_on_allocation_failure() noexcept -> Task
+        {
+            return Task{};
+        }
+
+        /**
+         * \brief Suspend the coroutine until the task is spawned on an executor.
+         *
+         * \return Suspend always awaitable.
+         */
+        auto initial_suspend() const noexcept -> std::suspend_always
+        {
+            return {};
+        }
+
+        /**
+         * \brief Suspend the coroutine once it has completed (the executor destroys the
+         *        coroutine).
+         *
+         * \return Suspend always awaitable.
+         */
+        auto final_suspend() const noexcept -> std::suspend_always
+        {
+            return {};
+        }
+
+        /**
+         * \brief Handle coroutine completion.
+         */
+        void return_void() const noexcept
+        {
+        }
+
+        /**
+         * \brief Handle an exception escaping the coroutine.
+         */
+        [[noreturn]] void unhandled_exception() const noexcept
+        {
+            PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::LOGIC_ERROR );
+        }
+
+        /**
+         * \brief Park the coroutine until an operation that would block can complete.
+         *
+         * \param[in] signal The signal that is notified when the operation may be able to
+         *            complete.
+         * \param[in] generation The signal's generation when the operation was last
+         *            attempted.
+         * \param[in] retry The function to call to retry the operation.
+         * \param[in] awaiter The awaiter to pass to the retry function.
+         */
+        void park( Wake_Signal &           signal,
+                   Wake_Signal::Generation generation,
+                   Retry                   retry,
+                   void *                  awaiter ) noexcept
+        {
+            m_signal     = &signal;
+            m_generation = generation;
+            m_retry      = retry;
+            m_awaiter    = awaiter;
+        }
+
+        /**
+         * \brief Check if the coroutine can be resumed, retrying the operation it is
+         *        parked on (if any) if the operation's wake signal has been notified
+         *        since the operation was last attempted.
+         *
+         * \return true if the coroutine can be resumed.
+         * \return false if the coroutine is parked on an operation that would still
+         *         block.
+         */
+        auto ready() noexcept -> bool
+        {
+            if ( not m_signal ) {
+                return true;
+            } // if
+
+            auto const generation = m_signal->generation();
+            if ( generation == m_generation ) {
+                return false;
+            } // if
+
+            // the generation must be recorded before the operation is retried so that a
+            // notification that occurs during the retry is not lost
+            m_generation = generation;
+
+            if ( not m_retry( m_awaiter ) ) {
+                return false;
+            } // if
+
+            m_signal = nullptr;
+
+            return true;
+        }
+
+      private:
+        /**
+         * \brief The wake signal of the operation the coroutine is parked on (nullptr if
+         *        the coroutine is not parked).
+         */
+        Wake_Signal * m_signal{};
+
+        /**
+         * \brief The wake signal's generation when the operation the coroutine is parked
+         *        on was last attempted.
+         */
+        Wake_Signal::Generation m_generation{};
+
+        /**
+         * \brief The function to call to retry the operation the coroutine is parked on.
+         */
+        Retry m_retry{};
+
+        /**
+         * \brief The awaiter the coroutine is parked on.
+         */
+        void * m_awaiter{};
+    };
+
+    /**
+     * \brief Coroutine handle.
+     */
+    using Handle = std::coroutine_handle<promise_type>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Task() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Task( Task && source ) noexcept : m_handle{ source.release() }
+    {
+    }
+
+    Task( Task const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Task() noexcept
+    {
+        if ( m_handle ) {
+            m_handle.destroy();
+        } // if
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Task && expression ) noexcept -> Task &
+    {
+        if ( &expression != this ) {
+            if ( m_handle ) {
+                m_handle.destroy();
+            } // if
+
+            m_handle = expression.release();
+        } // if
+
+        return *this;
+    }
+
+    auto operator=( Task const & ) = delete;
+
+    /**
+     * \brief Check if the task owns a coroutine.
+     *
+     * \return true if the task owns a coroutine.
+     * \return false if the task does not own a coroutine (e.g. the coroutine frame could
+     *         not be allocated).
+     */
+    explicit constexpr operator bool() const noexcept
+    {
+        return static_cast<bool>( m_handle );
+    }
+
+    /**
+     * \brief Release ownership of the task's coroutine.
+     *
+     * \return The task's coroutine.
+     */
+    constexpr auto release() noexcept -> Handle
+    {
+        return std::exchange( m_handle, Handle{} );
+    }
+
+  private:
+    /**
+     * \brief The task's coroutine.
+     */
+    Handle m_handle{};
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] handle The task's coroutine.
+     */
+    constexpr explicit Task( Handle handle ) noexcept : m_handle{ handle }
+    {
+    }
+};
+
+/**
+ * \brief Single-threaded coroutine executor.
+ *
+ * Coroutines that await an operation that would block are parked until the operation's
+ * wake signal is notified, at which point the operation is retried. Parked coroutines do
+ * not consume CPU time.
+ *
+ * \tparam TASKS The maximum number of concurrently spawned tasks.
+ */
+template<std::size_t TASKS>
+class Executor {
+  public:
+    static_assert( TASKS > 0 );
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Executor() noexcept = default;
+
+    Executor( Executor && ) = delete;
+
+    Executor( Executor const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Executor() noexcept
+    {
+        for ( auto & handle : m_tasks ) {
+            if ( handle ) {
+                handle.destroy();
+            } // if
+        }     // for
+    }
+
+    auto operator=( Executor && ) = delete;
+
+    auto operator=( Executor const & ) = delete;
+
+    /**
+     * \brief Spawn a task.
+     *
+     * \pre task owns a coroutine
+     * \pre the number of spawned tasks that have not completed is less than TASKS
+     *
+     * \param[in] task The task to spawn.
+     */
+    void spawn( Task task ) noexcept
+    {
+        PICOLIBRARY_EXPECT( static_cast<bool>( task ), Generic_Error::INVALID_ARGUMENT );
+
+        for ( auto & handle : m_tasks ) {
+            if ( not handle ) {
+                handle = task.release();
+
+                return;
+            } // if
+        }     // for
+
+        PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::INSUFFICIENT_CAPACITY );
+    }
+
+    /**
+     * \brief Get the number of spawned tasks that have not completed.
+     *
+     * \return The number of spawned tasks that have not completed.
+     */
+    auto tasks() const noexcept -> std::size_t
+    {
+        auto tasks = std::size_t{ 0 };
+
+        for ( auto const & handle : m_tasks ) {
+            if ( handle ) {
+                ++tasks;
+            } // if
+        }     // for
+
+        return tasks;
+    }
+
+    /**
+     * \brief Resume each task that can make progress once.
+     *
+     * \return true if any task was resumed.
+     * \return false if all tasks are parked on operations that would still block (or
+     *         there are no tasks).
+     */
+    auto run_once() noexcept -> bool
+    {
+        auto resumed = false;
+
+        for ( auto & handle : m_tasks ) {
+            if ( handle and handle.promise().ready() ) {
+                handle.resume();
+
+                if ( handle.done() ) {
+                    handle.destroy();
+                    handle = Task::Handle{};
+                } // if
+
+                resumed = true;
+            } // if
+        }     // for
+
+        return resumed;
+    }
+
+    /**
+     * \brief Run tasks until all tasks have completed.
+     *
+     * \tparam Idle_Hook The type of idle hook to call.
+     *
+     * \param[in] idle_hook The idle hook to call when all tasks are parked (e.g. a HIL
+     *            function that waits for an interrupt, or a function that advances a
+     *            picolibrary::Timer_Service).
+     */
+    template<typename Idle_Hook>
+    void run( Idle_Hook idle_hook ) noexcept
+    {
+        while ( tasks() ) {
+            if ( not run_once() ) {
+                idle_hook();
+            } // if
+        }     // while
+    }
+
+  private:
+    /**
+     * \brief The spawned tasks' coroutines.
+     */
+    Task::Handle m_tasks[ TASKS ]{};
+};
+
+/**
+ * \brief Non-blocking operation awaitable.
+ *
+ * The operation is attempted when awaited. If the operation would block, the awaiting
+ * coroutine is parked until the operation's wake signal is notified, at which point the
+ * operation is retried.
+ *
+ * \tparam Operation The type of operation to perform (a function object that returns a
+ *         picolibrary::Result).
+ * \tparam OPERATION_TIMEOUT_WOULD_BLOCK true if picolibrary::Generic_Error::OPERATION_TIMEOUT
+ *         indicates that the operation would block (as is the case for non-blocking
+ *         socket data transmission, data reception, and connection acceptance).
+ */
+template<typename Operation, bool OPERATION_TIMEOUT_WOULD_BLOCK>
+class Nonblocking_Operation {
+  public:
+    /**
+     * \brief The operation's result type.
+     */
+    using Result = std::invoke_result_t<Operation &>;
+
+    Nonblocking_Operation() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] signal The signal that is notified when the operation may be able to
+     *            make progress.
+     * \param[in] operation The operation to perform.
+     */
+    constexpr Nonblocking_Operation( Wake_Signal & signal, Operation operation ) noexcept :
+        m_signal{ &signal },
+        m_operation{ std::move( operation ) }
+    {
+    }
+
+    Nonblocking_Operation( Nonblocking_Operation && ) = delete;
+
+    Nonblocking_Operation( Nonblocking_Operation const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Nonblocking_Operation() noexcept
+    {
+        if ( m_is_complete ) {
+            m_result.~Result();
+        } // if
+    }
+
+    auto operator=( Nonblocking_Operation && ) = delete;
+
+    auto operator=( Nonblocking_Operation const & ) = delete;
+
+    /**
+     * \brief Attempt the operation.
+     *
+     * \return true if the operation completed (successfully or unsuccessfully).
+     * \return false if the operation would block.
+     */
+    auto await_ready() noexcept -> bool
+    {
+        // the generation must be recorded before the operation is attempted so that a
+        // notification that occurs during the attempt is not lost
+        m_generation = m_signal->generation();
+
+        return attempt();
+    }
+
+    /**
+     * \brief Park the awaiting coroutine until the operation can complete.
+     *
+     * \param[in] handle The awaiting coroutine.
+     */
+    void await_suspend( Task::Handle handle ) noexcept
+    {
+        handle.promise().park( *m_signal, m_generation, &retry, this );
+    }
+
+    /**
+     * \brief Get the operation's result.
+     *
+     * \return The operation's result.
+     */
+    auto await_resume() noexcept -> Result
+    {
+        return std::move( m_result );
+    }
+
+  private:
+    /**
+     * \brief The signal that is notified when the operation may be able to make progress.
+     */
+    Wake_Signal * m_signal;
+
+    /**
+     * \brief The signal's generation when the operation was first attempted.
+     */
+    Wake_Signal::Generation m_generation{};
+
+    /**
+     * \brief The operation to perform.
+     */
+    Operation m_operation;
+
+    union {
+        /**
+         * \brief The operation's result (valid once the operation has completed).
+         */
+        Result m_result;
+    };
+
+    /**
+     * \brief The operation's completion state.
+     */
+    bool m_is_complete{};
+
+    /**
+     * \brief Retry the operation.
+     *
+     * \param[in] awaiter The awaiter.
+     *
+     * \return true if the operation completed.
+     * \return false if the operation would still block.
+     */
+    static auto retry( void * awaiter ) noexcept -> bool
+    {
+        return static_cast<Nonblocking_Operation *>( awaiter )->attempt();
+    }
+
+    /**
+     * \brief Attempt the operation.
+     *
+     * \return true if the operation completed.
+     * \return false if the operation would block.
+     */
+    auto attempt() noexcept -> bool
+    {
+        auto result = m_operation();
+        if ( result.is_error()
+             and ( result.error() == Generic_Error::WOULD_BLOCK
+                   or ( OPERATION_TIMEOUT_WOULD_BLOCK
+                        and result.error() == Generic_Error::OPERATION_TIMEOUT ) ) ) {
+            return false;
+        } // if
+
+        new ( &m_result ) Result{ std::move( result ) };
+        m_is_complete = true;
+
+        return true;
+    }
+};
+
+/**
+ * \brief Sleep awaitable.
+ *
+ * \tparam Timer_Service The type of timer service used to wake the awaiting coroutine
+ *         (e.g. picolibrary::Timer_Service).
+ */
+template<typename Timer_Service>
+class Sleep {
+  public:
+    Sleep() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] timer_service The timer service used to wake the awaiting coroutine.
+     * \param[in] ticks The number of ticks to sleep for.
+     */
+    constexpr Sleep( Timer_Service & timer_service, Timer::Tick ticks ) noexcept :
+        m_timer_service{ &timer_service },
+        m_ticks{ ticks }
+    {
+    }
+
+    Sleep( Sleep && ) = delete;
+
+    Sleep( Sleep const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Sleep() noexcept = default;
+
+    auto operator=( Sleep && ) = delete;
+
+    auto operator=( Sleep const & ) = delete;
+
+    /**
+     * \brief Start the sleep timer.
+     *
+     * \return true if the number of ticks to sleep for is zero.
+     * \return false if the number of ticks to sleep for is not zero.
+     */
+    auto await_ready() noexcept -> bool
+    {
+        if ( not m_ticks ) {
+            return true;
+        } // if
+
+        m_generation = m_signal.generation();
+
+        m_timer_service->start( m_timer, m_ticks );
+
+        return false;
+    }
+
+    /**
+     * \brief Park the awaiting coroutine until the sleep timer expires.
+     *
+     * \param[in] handle The awaiting coroutine.
+     */
+    void await_suspend( Task::Handle handle ) noexcept
+    {
+        handle.promise().park( m_signal, m_generation, &expired, this );
+    }
+
+    /**
+     * \brief Complete the sleep.
+     */
+    constexpr void await_resume() const noexcept
+    {
+    }
+
+  private:
+    /**
+     * \brief The timer service used to wake the awaiting coroutine.
+     */
+    Timer_Service * m_timer_service;
+
+    /**
+     * \brief The number of ticks to sleep for.
+     */
+    Timer::Tick m_ticks;
+
+    /**
+     * \brief The signal that is notified when the sleep timer expires.
+     */
+    Wake_Signal m_signal{};
+
+    /**
+     * \brief The signal's generation when the sleep timer was started.
+     */
+    Wake_Signal::Generation m_generation{};
+
+    /**
+     * \brief The sleep timer.
+     */
+    Timer m_timer{ []( void * signal ) noexcept { static_cast<Wake_Signal *>( signal )->notify(); },
+                   &m_signal };
+
+    /**
+     * \brief Check if the sleep timer has expired.
+     *
+     * \param[in] awaiter The awaiter.
+     *
+     * \return true if the sleep timer has expired.
+     */
+    static auto expired( void * awaiter ) noexcept -> bool
+    {
+        return not static_cast<Sleep *>( awaiter )->m_timer.is_running();
+    }
+};
+
+/**
+ * \brief Create a non-blocking operation awaitable.
+ *
+ * \tparam OPERATION_TIMEOUT_WOULD_BLOCK true if picolibrary::Generic_Error::OPERATION_TIMEOUT
+ *         indicates that the operation would block.
+ * \tparam Operation The type of operation to perform.
+ *
+ * \param[in] signal The signal that is notified when the operation may be able to make
+ *            progress.
+ * \param[in] operation The operation to perform.
+ *
+ * \return The created awaitable.
+ */
+template<bool OPERATION_TIMEOUT_WOULD_BLOCK, typename Operation>
+constexpr auto make_nonblocking_operation( Wake_Signal & signal, Operation operation ) noexcept
+    -> Nonblocking_Operation<Operation, OPERATION_TIMEOUT_WOULD_BLOCK>
+{
+    return { signal, std::move( operation ) };
+}
+
+/**
+ * \brief Connect a non-blocking TCP client socket to a remote endpoint.
+ *
+ * \tparam Client The type of TCP client socket (see picolibrary::IP::TCP::Client_Concept).
+ *
+ * \param[in] signal The socket's wake signal.
+ * \param[in] client The socket to connect.
+ * \param[in] endpoint The remote endpoint to connect to.
+ *
+ * \return An awaitable that yields the result of picolibrary::IP::TCP::Client_Concept::connect().
+ */
+template<typename Client>
+constexpr auto connect( Wake_Signal & signal, Client & client, typename Client::Endpoint const & endpoint ) noexcept
+{
+    return make_nonblocking_operation<false>(
+        signal, [ &client, endpoint ]() noexcept { return client.connect( endpoint ); } );
+}
+
+/**
+ * \brief Accept an incoming connection request using a non-blocking TCP server socket.
+ *
+ * \tparam Server The type of TCP server socket (see picolibrary::IP::TCP::Server_Concept).
+ *
+ * \param[in] signal The socket's wake signal.
+ * \param[in] server The socket to accept an incoming connection request with.
+ *
+ * \return An awaitable that yields the result of picolibrary::IP::TCP::Server_Concept::accept().
+ */
+template<typename Server>
+constexpr auto accept( Wake_Signal & signal, Server & server ) noexcept
+{
+    return make_nonblocking_operation<true>( signal, [ &server ]() noexcept { return server.accept(); } );
+}
+
+/**
+ * \brief Transmit data using a non-blocking TCP socket.
+ *
+ * \tparam Socket The type of TCP socket (see picolibrary::IP::TCP::Client_Concept and
+ *         picolibrary::IP::TCP::Server_Connection_Handler_Concept).
+ *
+ * \param[in] signal The socket's wake signal.
+ * \param[in] socket The socket to transmit the data with.
+ * \param[in] begin The beginning of the block of data to write to the socket's transmit
+ *            buffer.
+ * \param[in] end The end of the block of data to write to the socket's transmit buffer.
+ *
+ * \return An awaitable that yields the result of the socket's transmit() member function.
+ */
+template<typename Socket>
+constexpr auto transmit( Wake_Signal & signal, Socket & socket, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+{
+    return make_nonblocking_operation<true>(
+        signal, [ &socket, begin, end ]() noexcept { return socket.transmit( begin, end ); } );
+}
+
+/**
+ * \brief Receive data using a non-blocking TCP or UDP socket.
+ *
+ * \tparam Socket The type of socket (see picolibrary::IP::TCP::Client_Concept,
+ *         picolibrary::IP::TCP::Server_Connection_Handler_Concept, and
+ *         picolibrary::IP::UDP::Socket_Concept).
+ *
+ * \param[in] signal The socket's wake signal.
+ * \param[in] socket The socket to receive the data with.
+ * \param[out] begin The beginning of the block of data read from the socket.
+ * \param[out] end The end of the block of data read from the socket.
+ *
+ * \return An awaitable that yields the result of the socket's receive() member function.
+ */
+template<typename Socket>
+constexpr auto receive( Wake_Signal & signal, Socket & socket, std::uint8_t * begin, std::uint8_t * end ) noexcept
+{
+    return make_nonblocking_operation<true>(
+        signal, [ &socket, begin, end ]() noexcept { return socket.receive( begin, end ); } );
+}
+
+/**
+ * \brief Sleep for a number of ticks.
+ *
+ * \tparam Timer_Service The type of timer service used to wake the awaiting coroutine.
+ *
+ * \param[in] timer_service The timer service used to wake the awaiting coroutine.
+ * \param[in] ticks The number of ticks to sleep for.
+ *
+ * \return An awaitable that completes once the number of ticks have elapsed.
+ */
+template<typename Timer_Service>
+constexpr auto sleep_for( Timer_Service & timer_service, Timer::Tick ticks ) noexcept -> Sleep<Timer_Service>
+{
+    return { timer_service, ticks };
+}
+
+} // namespace picolibrary::Coroutine
+
+#endif // defined( __cpp_impl_coroutine ) && __cpp_impl_coroutine >= 201902L
+
+#endif // PICOLIBRARY_COROUTINE_H
@@ -266,6 +266,154 @@ class Multiple_Signals_Debouncer {
     State m_state{};
 };
 
+/**
+ * \brief Vertical counter multiple signals debouncer.
+ *
+ * Each signal has a saturating counter of consecutive samples that differ from the
+ * signal's debounced state. The counters are stored as bit planes (one State per counter
+ * bit) so that all signals are updated using a fixed number of bitwise operations per
+ * sample, regardless of the number of signals. A signal's debounced state changes once
+ * SAMPLES consecutive samples differ from it.
+ *
+ * \tparam State The unsigned integer type used to hold the state of the signals.
+ * \tparam SAMPLES The number of signal samples to use to determine whether a signal state
+ *         is stable.
+ */
+template<typename State, std::uint_fast8_t SAMPLES>
+class Vertical_Counter_Debouncer {
+  public:
+    static_assert( std::is_unsigned_v<State> );
+    static_assert( SAMPLES > 0 );
+
+    Vertical_Counter_Debouncer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] state The initial debounced state of the signals.
+     */
+    constexpr Vertical_Counter_Debouncer( State state ) noexcept : m_state{ state }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Vertical_Counter_Debouncer( Vertical_Counter_Debouncer && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Vertical_Counter_Debouncer( Vertical_Counter_Debouncer const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Vertical_Counter_Debouncer() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Vertical_Counter_Debouncer && expression ) noexcept
+        -> Vertical_Counter_Debouncer & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Vertical_Counter_Debouncer const & expression ) noexcept
+        -> Vertical_Counter_Debouncer & = default;
+
+    /**
+     * \brief Update the debouncer with a new signals sample.
+     *
+     * \param[in] state The new signals sample to update the debouncer with.
+     */
+    constexpr void debounce( State state ) noexcept
+    {
+        auto const delta = static_cast<State>( state ^ m_state );
+
+        auto stable = delta;
+        for ( auto plane = std::uint_fast8_t{ 0 }; plane < COUNTER_BITS; ++plane ) {
+            stable &= ( STABLE_COUNT >> plane ) & 0b1 ? m_counter[ plane ]
+                                                      : static_cast<State>( ~m_counter[ plane ] );
+        } // for
+
+        auto carry = static_cast<State>( delta & ~stable );
+        for ( auto & plane : m_counter ) {
+            auto const sum = static_cast<State>( plane ^ carry );
+
+            carry = plane & carry;
+            plane = sum & delta & ~stable;
+        } // for
+
+        m_changed = stable;
+        m_state ^= stable;
+    }
+
+    /**
+     * \brief Get the debounced state of the signals.
+     *
+     * \return The debounced state of the signals.
+     */
+    constexpr auto state() const noexcept -> State
+    {
+        return m_state;
+    }
+
+    /**
+     * \brief Get the signals whose debounced state changed during the most recent
+     *        debouncer update.
+     *
+     * \return The signals whose debounced state changed during the most recent debouncer
+     *         update.
+     */
+    constexpr auto changed() const noexcept -> State
+    {
+        return m_changed;
+    }
+
+  private:
+    /**
+     * \brief The counter value at which a differing sample changes a signal's debounced
+     *        state.
+     */
+    static constexpr auto STABLE_COUNT = static_cast<std::uint_fast8_t>( SAMPLES - 1 );
+
+    /**
+     * \brief The number of bits in each signal's counter.
+     */
+    static constexpr auto COUNTER_BITS = static_cast<std::uint_fast8_t>(
+        STABLE_COUNT ? highest_bit_set( STABLE_COUNT ) + 1 : 1 );
+
+    /**
+     * \brief Counter bit planes (least significant bit first).
+     */
+    Array<State, COUNTER_BITS> m_counter{};
+
+    /**
+     * \brief The debounced state of the signals.
+     */
+    State m_state{};
+
+    /**
+     * \brief The signals whose debounced state changed during the most recent debouncer
+     *        update.
+     */
+    State m_changed{};
+};
+
 } // namespace picolibrary::Debounce
 
 #endif // PICOLIBRARY_DEBOUNCE_H
@@ -0,0 +1,896 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary event pool interface.
+ */
+
+#ifndef PICOLIBRARY_EVENT_POOL_H
+#define PICOLIBRARY_EVENT_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/array.h"
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/error.h"
+#include "picolibrary/event.h"
+#include "picolibrary/interrupt.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary {
+
+class Event_Handle;
+
+/**
+ * \brief Fixed block event pool interface.
+ */
+class Event_Pool_Base {
+  public:
+    /**
+     * \brief Event pool block header.
+     */
+    struct Block {
+        /**
+         * \brief The pool the block belongs to.
+         */
+        Event_Pool_Base * pool;
+
+        /**
+         * \brief The block's event storage.
+         */
+        void * storage;
+
+        /**
+         * \brief The event stored in the block (if the block is allocated), or the next
+         *        free block (if the block is free).
+         */
+        union {
+            /**
+             * \brief The event stored in the block.
+             */
+            Event * event;
+
+            /**
+             * \brief The next free block.
+             */
+            Block * next;
+        };
+
+        /**
+         * \brief The number of event handles that reference the block's event.
+         */
+        std::uint_fast8_t references;
+    };
+
+    /**
+     * \brief Get the size of the pool's event storage blocks.
+     *
+     * \return The size of the pool's event storage blocks.
+     */
+    virtual auto block_size() const noexcept -> std::size_t = 0;
+
+    /**
+     * \brief Get the number of free blocks in the pool.
+     *
+     * \return The number of free blocks in the pool.
+     */
+    virtual auto available() const noexcept -> std::size_t = 0;
+
+    /**
+     * \brief Construct an event in a block allocated from the pool.
+     *
+     * \tparam Event The type of event to construct.
+     * \tparam Arguments Event construction argument types.
+     *
+     * \param[in] arguments Event construction arguments.
+     *
+     * \return A handle to the constructed event if the event fits in a block and a block
+     *         could be allocated.
+     * \return A null handle if the event does not fit in a block or the pool is
+     *         exhausted.
+     */
+    template<typename Event, typename... Arguments>
+    auto make( Arguments &&... arguments ) noexcept -> Event_Handle;
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Event_Pool_Base() noexcept = default;
+
+    Event_Pool_Base( Event_Pool_Base && ) = delete;
+
+    Event_Pool_Base( Event_Pool_Base const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Event_Pool_Base() noexcept = default;
+
+    auto operator=( Event_Pool_Base && ) = delete;
+
+    auto operator=( Event_Pool_Base const & ) = delete;
+
+    /**
+     * \brief Allocate a block from the pool.
+     *
+     * \return The allocated block if a block could be allocated.
+     * \return nullptr if the pool is exhausted.
+     */
+    virtual auto allocate() noexcept -> Block * = 0;
+
+    /**
+     * \brief Add a reference to an allocated block's event.
+     *
+     * \param[in] block The block.
+     */
+    virtual void add_reference( Block & block ) noexcept = 0;
+
+    /**
+     * \brief Remove a reference to an allocated block's event, destroying the event and
+     *        returning the block to the pool if the reference was the last reference.
+     *
+     * \param[in] block The block.
+     */
+    virtual void remove_reference( Block & block ) noexcept = 0;
+
+  private:
+    friend class Event_Handle;
+};
+
+/**
+ * \brief Reference counted handle to an event allocated from an event pool.
+ *
+ * Copying a handle shares the event (no event copies are made). The event is destroyed,
+ * and its block returned to its pool, when the last handle that references the event is
+ * destroyed or reset.
+ */
+class Event_Handle {
+  public:
+    /**
+     * \brief Constructor (constructs a null handle).
+     */
+    constexpr Event_Handle() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Event_Handle( Event_Handle && source ) noexcept : m_block{ source.m_block }
+    {
+        source.m_block = nullptr;
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    Event_Handle( Event_Handle const & original ) noexcept : m_block{ original.m_block }
+    {
+        if ( m_block ) {
+            m_block->pool->add_reference( *m_block );
+        } // if
+    }
+
+    /**
+     * \brief Destructor.
+     */
+    ~Event_Handle() noexcept
+    {
+        reset();
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Event_Handle && expression ) noexcept -> Event_Handle &
+    {
+        if ( &expression != this ) {
+            reset();
+
+            m_block            = expression.m_block;
+            expression.m_block = nullptr;
+        } // if
+
+        return *this;
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    auto operator=( Event_Handle const & expression ) noexcept -> Event_Handle &
+    {
+        if ( &expression != this ) {
+            reset();
+
+            m_block = expression.m_block;
+
+            if ( m_block ) {
+                m_block->pool->add_reference( *m_block );
+            } // if
+        } // if
+
+        return *this;
+    }
+
+    /**
+     * \brief Check if the handle references an event.
+     *
+     * \return true if the handle references an event.
+     * \return false if the handle is a null handle.
+     */
+    explicit constexpr operator bool() const noexcept
+    {
+        return m_block;
+    }
+
+    /**
+     * \brief Get the referenced event.
+     *
+     * \warning Calling this function on a null handle results in undefined behavior.
+     *
+     * \return The referenced event.
+     */
+    auto event() const noexcept -> Event const &
+    {
+        return *m_block->event;
+    }
+
+    /**
+     * \brief Get the number of handles that reference the referenced event.
+     *
+     * \return The number of handles that reference the referenced event (0 if the handle
+     *         is a null handle).
+     */
+    auto references() const noexcept -> std::uint_fast8_t
+    {
+        return m_block ? m_block->references : 0;
+    }
+
+    /**
+     * \brief Release the handle's reference to the referenced event (if any), making the
+     *        handle a null handle.
+     */
+    void reset() noexcept
+    {
+        if ( m_block ) {
+            auto const block = m_block;
+
+            m_block = nullptr;
+
+            block->pool->remove_reference( *block );
+        } // if
+    }
+
+  private:
+    friend class Event_Pool_Base;
+
+    /**
+     * \brief The referenced event's block (nullptr if the handle is a null handle).
+     */
+    Event_Pool_Base::Block * m_block{};
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] block The referenced event's block (the handle takes ownership of the
+     *            block's initial reference).
+     */
+    constexpr explicit Event_Handle( Event_Pool_Base::Block & block ) noexcept :
+        m_block{ &block }
+    {
+    }
+};
+
+template<typename Event, typename... Arguments>
+auto Event_Pool_Base::make( Arguments &&... arguments ) noexcept -> Event_Handle
+{
+    static_assert( std::is_base_of_v<::picolibrary::Event, Event> );
+    static_assert( alignof( Event ) <= alignof( std::max_align_t ) );
+
+    if ( sizeof( Event ) > block_size() ) {
+        return {};
+    } // if
+
+    auto const block = allocate();
+    if ( not block ) {
+        return {};
+    } // if
+
+    block->event      = new ( block->storage ) Event( std::forward<Arguments>( arguments )... );
+    block->references = 1;
+
+    return Event_Handle{ *block };
+}
+
+/**
+ * \brief Fixed block event pool.
+ *
+ * Blocks can be allocated and released from both the main thread of execution and from
+ * interrupts.
+ *
+ * \tparam BLOCK_SIZE The size of each event storage block.
+ * \tparam BLOCKS The number of event storage blocks.
+ * \tparam Interrupt_Controller The type of interrupt controller used to manipulate the
+ *         interrupt enable state of any interrupts that allocate events from the pool or
+ *         release references to events allocated from the pool.
+ */
+template<std::size_t BLOCK_SIZE, std::size_t BLOCKS, typename Interrupt_Controller>
+class Event_Pool final : public Event_Pool_Base {
+  public:
+    static_assert( BLOCKS > 0 );
+
+    Event_Pool() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] interrupt_controller The interrupt controller used to manipulate the
+     *            interrupt enable state of interrupts that allocate events from the pool
+     *            or release references to events allocated from the pool.
+     */
+    Event_Pool( Interrupt_Controller interrupt_controller ) noexcept :
+        m_interrupt_controller{ std::move( interrupt_controller ) }
+    {
+        for ( auto i = std::size_t{ 0 }; i < BLOCKS; ++i ) {
+            auto & block = m_blocks[ i ];
+
+            block.pool       = this;
+            block.storage    = &m_storage[ i ];
+            block.next       = i + 1 < BLOCKS ? &m_blocks[ i + 1 ] : nullptr;
+            block.references = 0;
+        } // for
+
+        m_free = &m_blocks[ 0 ];
+    }
+
+    Event_Pool( Event_Pool && ) = delete;
+
+    Event_Pool( Event_Pool const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     *
+     * \warning All handles that reference events allocated from the pool must be
+     *          destroyed or reset before the pool is destroyed.
+     */
+    ~Event_Pool() noexcept = default;
+
+    auto operator=( Event_Pool && ) = delete;
+
+    auto operator=( Event_Pool const & ) = delete;
+
+    /**
+     * \copydoc picolibrary::Event_Pool_Base::block_size()
+     */
+    auto block_size() const noexcept -> std::size_t override final
+    {
+        return BLOCK_SIZE;
+    }
+
+    /**
+     * \copydoc picolibrary::Event_Pool_Base::available()
+     */
+    auto available() const noexcept -> std::size_t override final
+    {
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        return m_available;
+    }
+
+  private:
+    /**
+     * \copydoc picolibrary::Event_Pool_Base::allocate()
+     */
+    auto allocate() noexcept -> Block * override final
+    {
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        auto const block = m_free;
+
+        if ( block ) {
+            m_free = block->next;
+
+            --m_available;
+        } // if
+
+        return block;
+    }
+
+    /**
+     * \copydoc picolibrary::Event_Pool_Base::add_reference()
+     */
+    void add_reference( Block & block ) noexcept override final
+    {
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        PICOLIBRARY_EXPECT(
+            block.references < std::numeric_limits<std::uint_fast8_t>::max(),
+            Generic_Error::WOULD_OVERFLOW );
+
+        ++block.references;
+    }
+
+    /**
+     * \copydoc picolibrary::Event_Pool_Base::remove_reference()
+     */
+    void remove_reference( Block & block ) noexcept override final
+    {
+        {
+            auto const guard = Interrupt::Critical_Section_Guard{
+                m_interrupt_controller, Interrupt::RESTORE_INTERRUPT_ENABLE_STATE
+            };
+
+            if ( --block.references ) {
+                return;
+            } // if
+        }
+
+        block.event->~Event();
+
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        block.next = m_free;
+        m_free     = &block;
+
+        ++m_available;
+    }
+
+    /**
+     * \brief Event storage block.
+     */
+    using Storage = std::aligned_storage_t<BLOCK_SIZE, alignof( std::max_align_t )>;
+
+    /**
+     * \brief The block headers.
+     */
+    Block m_blocks[ BLOCKS ];
+
+    /**
+     * \brief The event storage blocks.
+     */
+    Storage m_storage[ BLOCKS ];
+
+    /**
+     * \brief The free block list.
+     */
+    Block * m_free{};
+
+    /**
+     * \brief The number of free blocks.
+     */
+    std::size_t m_available{ BLOCKS };
+
+    /**
+     * \brief The interrupt controller used to manipulate the interrupt enable state of
+     *        interrupts that allocate events from the pool or release references to events
+     *        allocated from the pool.
+     */
+    mutable Interrupt_Controller m_interrupt_controller;
+};
+
+/**
+ * \brief Event pool size class set.
+ *
+ * Events are allocated from the smallest size class that the event fits in. If that
+ * size class is exhausted, the next larger size class is used.
+ *
+ * \tparam SIZE_CLASSES The number of size classes.
+ */
+template<std::size_t SIZE_CLASSES>
+class Event_Pool_Set {
+  public:
+    static_assert( SIZE_CLASSES > 0 );
+
+    Event_Pool_Set() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \pre the pools are ordered by increasing block size
+     *
+     * \tparam Pools The types of event pools.
+     *
+     * \param[in] pools The event pools (one per size class).
+     */
+    template<
+        typename... Pools,
+        typename = std::enable_if_t<( std::is_base_of_v<Event_Pool_Base, Pools> and ... )>>
+    constexpr Event_Pool_Set( Pools &... pools ) noexcept : m_pools{ { &pools... } }
+    {
+        static_assert( sizeof...( Pools ) == SIZE_CLASSES );
+
+        for ( auto i = std::size_t{ 1 }; i < SIZE_CLASSES; ++i ) {
+            PICOLIBRARY_EXPECT(
+                m_pools[ i - 1 ]->block_size() < m_pools[ i ]->block_size(),
+                Generic_Error::INVALID_ARGUMENT );
+        } // for
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Event_Pool_Set( Event_Pool_Set && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Event_Pool_Set( Event_Pool_Set const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Event_Pool_Set() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Event_Pool_Set && expression ) noexcept -> Event_Pool_Set & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Event_Pool_Set const & expression ) noexcept
+        -> Event_Pool_Set & = default;
+
+    /**
+     * \brief Construct an event in a block allocated from the smallest size class that
+     *        the event fits in and that is not exhausted.
+     *
+     * \tparam Event The type of event to construct.
+     * \tparam Arguments Event construction argument types.
+     *
+     * \param[in] arguments Event construction arguments.
+     *
+     * \return A handle to the constructed event if a block could be allocated.
+     * \return A null handle if the event does not fit in any size class or all size
+     *         classes the event fits in are exhausted.
+     */
+    template<typename Event, typename... Arguments>
+    auto make( Arguments &&... arguments ) const noexcept -> Event_Handle
+    {
+        for ( auto const pool : m_pools ) {
+            if ( sizeof( Event ) <= pool->block_size() ) {
+                auto handle = pool->template make<Event>( arguments... );
+                if ( handle ) {
+                    return handle;
+                } // if
+            }     // if
+        }         // for
+
+        return {};
+    }
+
+  private:
+    /**
+     * \brief The event pools (ordered by increasing block size).
+     */
+    Array<Event_Pool_Base *, SIZE_CLASSES> m_pools;
+};
+
+/**
+ * \brief Event publish/subscribe registry.
+ *
+ * Subscribers (e.g. picolibrary::Active_Object derived classes) are registered with a
+ * subscriber index, and subscribe to event IDs. Each event ID's subscribers are tracked
+ * with a subscriber bitmask, so publishing an event posts a handle to the event to each
+ * subscriber without copying the event.
+ *
+ * A publisher is bound to a single event category, and subscriptions are keyed by event
+ * ID within that category. Events from other event categories are not published.
+ *
+ * \tparam EVENT_IDS The number of event IDs.
+ * \tparam SUBSCRIBERS The maximum number of subscribers (must be in the range [1, 32]).
+ */
+template<std::size_t EVENT_IDS, std::uint_fast8_t SUBSCRIBERS>
+class Event_Publisher {
+  public:
+    static_assert( EVENT_IDS > 0 );
+    static_assert( SUBSCRIBERS > 0 and SUBSCRIBERS <= 32 );
+
+    /**
+     * \brief Subscriber index.
+     */
+    using Subscriber_Index = std::uint_fast8_t;
+
+    Event_Publisher() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] category The event category whose events are published.
+     */
+    constexpr Event_Publisher( Event_Category const & category ) noexcept :
+        m_category{ &category }
+    {
+    }
+
+    Event_Publisher( Event_Publisher && ) = delete;
+
+    Event_Publisher( Event_Publisher const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Event_Publisher() noexcept = default;
+
+    auto operator=( Event_Publisher && ) = delete;
+
+    auto operator=( Event_Publisher const & ) = delete;
+
+    /**
+     * \brief Get the event category whose events are published.
+     *
+     * \return The event category whose events are published.
+     */
+    constexpr auto category() const noexcept -> Event_Category const &
+    {
+        return *m_category;
+    }
+
+    /**
+     * \brief Register a subscriber.
+     *
+     * \pre index < SUBSCRIBERS
+     * \pre no other subscriber has been registered with index
+     *
+     * \tparam Subscriber The type of subscriber to register (must provide
+     *         void post( picolibrary::Event_Handle ) and
+     *         void post_from_interrupt( picolibrary::Event_Handle ) member functions).
+     *
+     * \param[in] index The subscriber's index.
+     * \param[in] subscriber The subscriber to register.
+     */
+    template<typename Subscriber>
+    void add( Subscriber_Index index, Subscriber & subscriber ) noexcept
+    {
+        PICOLIBRARY_EXPECT( index < SUBSCRIBERS, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT( not m_subscribers[ index ].subscriber, Generic_Error::LOGIC_ERROR );
+
+        m_subscribers[ index ] = Registration{
+            &subscriber,
+            []( void * object, Event_Handle const & handle ) noexcept {
+                static_cast<Subscriber *>( object )->post( handle );
+            },
+            []( void * object, Event_Handle const & handle ) noexcept {
+                static_cast<Subscriber *>( object )->post_from_interrupt( handle );
+            },
+        };
+    }
+
+    /**
+     * \brief Subscribe a subscriber to an event ID of the publisher's event category.
+     *
+     * \pre index is the index of a registered subscriber
+     * \pre id < EVENT_IDS
+     *
+     * \param[in] index The subscriber's index.
+     * \param[in] id The event ID to subscribe to.
+     */
+    void subscribe( Subscriber_Index index, Event_ID id ) noexcept
+    {
+        PICOLIBRARY_EXPECT(
+            index < SUBSCRIBERS and m_subscribers[ index ].subscriber,
+            Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT( id < EVENT_IDS, Generic_Error::INVALID_ARGUMENT );
+
+        m_subscriptions[ id ] = static_cast<Subscriber_Mask>(
+            m_subscriptions[ id ] | subscriber_mask( index ) );
+    }
+
+    /**
+     * \brief Unsubscribe a subscriber from an event ID of the publisher's event
+     *        category.
+     *
+     * \pre index < SUBSCRIBERS
+     * \pre id < EVENT_IDS
+     *
+     * \param[in] index The subscriber's index.
+     * \param[in] id The event ID to unsubscribe from.
+     */
+    void unsubscribe( Subscriber_Index index, Event_ID id ) noexcept
+    {
+        PICOLIBRARY_EXPECT( index < SUBSCRIBERS, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT( id < EVENT_IDS, Generic_Error::INVALID_ARGUMENT );
+
+        m_subscriptions[ id ] = static_cast<Subscriber_Mask>(
+            m_subscriptions[ id ] & ~subscriber_mask( index ) );
+    }
+
+    /**
+     * \brief Check if a subscriber is subscribed to an event ID of the publisher's event
+     *        category.
+     *
+     * \pre index < SUBSCRIBERS
+     * \pre id < EVENT_IDS
+     *
+     * \param[in] index The subscriber's index.
+     * \param[in] id The event ID.
+     *
+     * \return true if the subscriber is subscribed to the event ID.
+     * \return false if the subscriber is not subscribed to the event ID.
+     */
+    auto is_subscribed( Subscriber_Index index, Event_ID id ) const noexcept -> bool
+    {
+        PICOLIBRARY_EXPECT( index < SUBSCRIBERS, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT( id < EVENT_IDS, Generic_Error::INVALID_ARGUMENT );
+
+        return m_subscriptions[ id ] & subscriber_mask( index );
+    }
+
+    /**
+     * \brief Publish an event to all of the event's ID's subscribers.
+     *
+     * \pre handle is not a null handle
+     * \pre the event's ID < EVENT_IDS if the event is from the publisher's event category
+     *
+     * \param[in] handle The handle to the event to publish.
+     *
+     * \return The number of subscribers the event was published to (0 if the event is not
+     *         from the publisher's event category).
+     */
+    auto publish( Event_Handle const & handle ) noexcept -> std::uint_fast8_t
+    {
+        return publish( handle, &Registration::post );
+    }
+
+    /**
+     * \brief Publish an event to all of the event's ID's subscribers (from an interrupt).
+     *
+     * \pre handle is not a null handle
+     * \pre the event's ID < EVENT_IDS if the event is from the publisher's event category
+     *
+     * \param[in] handle The handle to the event to publish.
+     *
+     * \return The number of subscribers the event was published to (0 if the event is not
+     *         from the publisher's event category).
+     */
+    auto publish_from_interrupt( Event_Handle const & handle ) noexcept -> std::uint_fast8_t
+    {
+        return publish( handle, &Registration::post_from_interrupt );
+    }
+
+  private:
+    /**
+     * \brief Subscriber bitmask (bit N is set if the subscriber with index N is
+     *        subscribed).
+     */
+    using Subscriber_Mask = std::conditional_t<
+        SUBSCRIBERS <= 8,
+        std::uint8_t,
+        std::conditional_t<SUBSCRIBERS <= 16, std::uint16_t, std::uint32_t>>;
+
+    /**
+     * \brief Subscriber registration.
+     */
+    struct Registration {
+        /**
+         * \brief The subscriber (nullptr if no subscriber has been registered with the
+         *        index).
+         */
+        void * subscriber;
+
+        /**
+         * \brief Post an event to the subscriber.
+         */
+        void ( *post )( void * subscriber, Event_Handle const & handle ) noexcept;
+
+        /**
+         * \brief Post an event to the subscriber from an interrupt.
+         */
+        void ( *post_from_interrupt )( void * subscriber, Event_Handle const & handle ) noexcept;
+    };
+
+    /**
+     * \brief The event category whose events are published.
+     */
+    Event_Category const * m_category;
+
+    /**
+     * \brief The registered subscribers (indexed by subscriber index).
+     */
+    Array<Registration, SUBSCRIBERS> m_subscribers{};
+
+    /**
+     * \brief The subscriptions (indexed by event ID).
+     */
+    Array<Subscriber_Mask, EVENT_IDS> m_subscriptions{};
+
+    /**
+     * \brief Get a subscriber's subscriber mask.
+     *
+     * \param[in] index The subscriber's index.
+     *
+     * \return The subscriber's subscriber mask.
+     */
+    static constexpr auto subscriber_mask( Subscriber_Index index ) noexcept -> Subscriber_Mask
+    {
+        return static_cast<Subscriber_Mask>( Subscriber_Mask{ 1 } << index );
+    }
+
+    /**
+     * \brief Publish an event to all of the event's ID's subscribers.
+     *
+     * \param[in] handle The handle to the event to publish.
+     * \param[in] post The registration post function to use.
+     *
+     * \return The number of subscribers the event was published to (0 if the event is not
+     *         from the publisher's event category).
+     */
+    auto publish( Event_Handle const & handle, decltype( &Registration::post ) post ) noexcept
+        -> std::uint_fast8_t
+    {
+        PICOLIBRARY_EXPECT( static_cast<bool>( handle ), Generic_Error::INVALID_ARGUMENT );
+
+        if ( &handle.event().category() != m_category ) {
+            return 0;
+        } // if
+
+        PICOLIBRARY_EXPECT( handle.event().id() < EVENT_IDS, Generic_Error::INVALID_ARGUMENT );
+
+        auto subscribers = m_subscriptions[ handle.event().id() ];
+        auto published   = std::uint_fast8_t{ 0 };
+
+        while ( subscribers ) {
+            auto const & registration = m_subscribers[ lowest_bit_set( subscribers ) ];
+
+            ( registration.*post )( registration.subscriber, handle );
+
+            subscribers = static_cast<Subscriber_Mask>( subscribers & ( subscribers - 1 ) );
+
+            ++published;
+        } // while
+
+        return published;
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_EVENT_POOL_H
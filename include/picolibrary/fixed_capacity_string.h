@@ -0,0 +1,925 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Capacity_String interface.
+ */
+
+#ifndef PICOLIBRARY_FIXED_CAPACITY_STRING_H
+#define PICOLIBRARY_FIXED_CAPACITY_STRING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "picolibrary/array.h"
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/stream.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Fixed capacity string storage.
+ *
+ * \tparam N The maximum number of characters in the string.
+ */
+template<std::size_t N>
+class Fixed_Capacity_String_Storage {
+  public:
+    /**
+     * \brief The number of characters in the string.
+     */
+    using Size = std::size_t;
+
+    /**
+     * \brief A const string iterator.
+     */
+    using Const_Iterator = char const *;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fixed_Capacity_String_Storage() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fixed_Capacity_String_Storage( Fixed_Capacity_String_Storage && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Fixed_Capacity_String_Storage( Fixed_Capacity_String_Storage const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed_Capacity_String_Storage() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed_Capacity_String_Storage && expression ) noexcept
+        -> Fixed_Capacity_String_Storage & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed_Capacity_String_Storage const & expression ) noexcept
+        -> Fixed_Capacity_String_Storage & = default;
+
+    /**
+     * \brief Access the underlying character array.
+     *
+     * \attention The underlying character array is not null-terminated.
+     *
+     * \return The underlying character array.
+     */
+    constexpr auto data() const noexcept -> char const *
+    {
+        return m_string.data();
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the string.
+     *
+     * \return An iterator to the first character of the string.
+     */
+    constexpr auto begin() const noexcept -> Const_Iterator
+    {
+        return m_string.begin();
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        string.
+     *
+     * \return An iterator to the character following the last character of the string.
+     */
+    constexpr auto end() const noexcept -> Const_Iterator
+    {
+        return m_string.begin() + m_size;
+    }
+
+    /**
+     * \brief Check if the string is empty.
+     *
+     * \return true if the string is empty.
+     * \return false if the string is not empty.
+     */
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool
+    {
+        return m_size == 0;
+    }
+
+    /**
+     * \brief Check if the string is full.
+     *
+     * \return true if the string is full.
+     * \return false if the string is not full.
+     */
+    constexpr auto full() const noexcept -> bool
+    {
+        return m_size == N;
+    }
+
+    /**
+     * \brief Get the number of characters in the string.
+     *
+     * \return The number of characters in the string.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Get the maximum number of characters the string is able to hold.
+     *
+     * \return The maximum number of characters the string is able to hold.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Check if characters have been discarded because the string was full.
+     *
+     * \return true if characters have been discarded.
+     * \return false if characters have not been discarded.
+     */
+    constexpr auto truncated() const noexcept -> bool
+    {
+        return m_truncated;
+    }
+
+    /**
+     * \brief Erase all characters and clear the truncation flag.
+     */
+    constexpr void clear() noexcept
+    {
+        m_size      = 0;
+        m_truncated = false;
+    }
+
+    /**
+     * \brief Append a character to the string.
+     *
+     * \param[in] character The character to append to the string.
+     *
+     * \return true if the character was appended.
+     * \return false if the string was full and the character was discarded.
+     */
+    constexpr auto append( char character ) noexcept -> bool
+    {
+        if ( full() ) {
+            m_truncated = true;
+
+            return false;
+        } // if
+
+        m_string[ m_size++ ] = character;
+
+        return true;
+    }
+
+    /**
+     * \brief Append a block of characters to the string.
+     *
+     * \param[in] begin The beginning of the block of characters to append to the string.
+     * \param[in] end The end of the block of characters to append to the string.
+     *
+     * \return true if the block of characters was appended.
+     * \return false if the string was filled before the end of the block of characters
+     *         was reached and the remaining characters were discarded.
+     */
+    constexpr auto append( char const * begin, char const * end ) noexcept -> bool
+    {
+        auto const fits = static_cast<Size>( end - begin ) <= N - m_size;
+        if ( not fits ) {
+            end         = begin + ( N - m_size );
+            m_truncated = true;
+        } // if
+
+        for ( ; begin != end; ++begin ) { m_string[ m_size++ ] = *begin; } // for
+
+        return fits;
+    }
+
+  private:
+    /**
+     * \brief The string's characters.
+     */
+    Array<char, N> m_string{};
+
+    /**
+     * \brief The number of characters in the string.
+     */
+    Size m_size{ 0 };
+
+    /**
+     * \brief The string truncation flag.
+     */
+    bool m_truncated{ false };
+};
+
+/**
+ * \brief Fixed capacity string I/O stream device access buffer.
+ *
+ * \tparam N The maximum number of characters in the string.
+ */
+template<std::size_t N>
+class Fixed_Capacity_String_Stream_Buffer final :
+    public Stream_Buffer,
+    public Fixed_Capacity_String_Storage<N> {
+  public:
+    /**
+     * \brief Write a character to the string.
+     *
+     * \param[in] character The character to write to the string.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the string is full.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        if ( not this->append( character ) ) {
+            return Generic_Error::INSUFFICIENT_CAPACITY;
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a block of characters to the string.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the string.
+     * \param[in] end The end of the block of characters to write to the string.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the string was filled
+     *         before the end of the block of characters was reached.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final
+    {
+        if ( not this->append( begin, end ) ) {
+            return Generic_Error::INSUFFICIENT_CAPACITY;
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a null-terminated string to the string.
+     *
+     * \param[in] string The null-terminated string to write to the string.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the string was filled
+     *         before the end of the null-terminated string was reached.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final
+    {
+        while ( auto const character = *string++ ) {
+            if ( not this->append( character ) ) {
+                return Generic_Error::INSUFFICIENT_CAPACITY;
+            } // if
+        }     // while
+
+        return {};
+    }
+
+#ifdef PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the string.
+     *
+     * \param[in] string The null-terminated ROM string to write to the string.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the string was filled
+     *         before the end of the null-terminated ROM string was reached.
+     */
+    auto put( ROM::String string ) noexcept -> Result<void> override final
+    {
+        while ( auto const character = *string++ ) {
+            if ( not this->append( character ) ) {
+                return Generic_Error::INSUFFICIENT_CAPACITY;
+            } // if
+        }     // while
+
+        return {};
+    }
+#endif // PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write an unsigned byte to the string.
+     *
+     * \param[in] value The unsigned byte to write to the string.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the string is full.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void> override final
+    {
+        return put( static_cast<char>( value ) );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the string.
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the
+     *            string.
+     * \param[in] end The end of the block of unsigned bytes to write to the string.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the string was filled
+     *         before the end of the block of unsigned bytes was reached.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void> override final
+    {
+        return put( reinterpret_cast<char const *>( begin ), reinterpret_cast<char const *>( end ) );
+    }
+
+    /**
+     * \brief Write a signed byte to the string.
+     *
+     * \param[in] value The signed byte to write to the string.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the string is full.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void> override final
+    {
+        return put( static_cast<char>( value ) );
+    }
+
+    /**
+     * \brief Write a block of signed bytes to the string.
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to the string.
+     * \param[in] end The end of the block of signed bytes to write to the string.
+     *
+     * \return Nothing if the write succeeded.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the string was filled
+     *         before the end of the block of signed bytes was reached.
+     */
+    auto put( std::int8_t const * begin, std::int8_t const * end ) noexcept -> Result<void> override final
+    {
+        return put( reinterpret_cast<char const *>( begin ), reinterpret_cast<char const *>( end ) );
+    }
+
+    using Stream_Buffer::put;
+
+    /**
+     * \brief Do nothing.
+     *
+     * \return Nothing.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        return {};
+    }
+};
+
+/**
+ * \brief Fixed capacity string reliable I/O stream device access buffer.
+ *
+ * \tparam N The maximum number of characters in the string.
+ */
+template<std::size_t N>
+class Reliable_Fixed_Capacity_String_Stream_Buffer final :
+    public Reliable_Stream_Buffer,
+    public Fixed_Capacity_String_Storage<N> {
+  public:
+    /**
+     * \brief Write a character to the string.
+     *
+     * \param[in] character The character to write to the string.
+     */
+    void put( char character ) noexcept override final
+    {
+        this->append( character );
+    }
+
+    /**
+     * \brief Write a block of characters to the string.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the string.
+     * \param[in] end The end of the block of characters to write to the string.
+     */
+    void put( char const * begin, char const * end ) noexcept override final
+    {
+        this->append( begin, end );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the string.
+     *
+     * \param[in] string The null-terminated string to write to the string.
+     */
+    void put( char const * string ) noexcept override final
+    {
+        while ( auto const character = *string++ ) {
+            if ( not this->append( character ) ) {
+                return;
+            } // if
+        }     // while
+    }
+
+#ifdef PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the string.
+     *
+     * \param[in] string The null-terminated ROM string to write to the string.
+     */
+    void put( ROM::String string ) noexcept override final
+    {
+        while ( auto const character = *string++ ) {
+            if ( not this->append( character ) ) {
+                return;
+            } // if
+        }     // while
+    }
+#endif // PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write an unsigned byte to the string.
+     *
+     * \param[in] value The unsigned byte to write to the string.
+     */
+    void put( std::uint8_t value ) noexcept override final
+    {
+        this->append( static_cast<char>( value ) );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the string.
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the
+     *            string.
+     * \param[in] end The end of the block of unsigned bytes to write to the string.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final
+    {
+        this->append( reinterpret_cast<char const *>( begin ), reinterpret_cast<char const *>( end ) );
+    }
+
+    /**
+     * \brief Write a signed byte to the string.
+     *
+     * \param[in] value The signed byte to write to the string.
+     */
+    void put( std::int8_t value ) noexcept override final
+    {
+        this->append( static_cast<char>( value ) );
+    }
+
+    /**
+     * \brief Write a block of signed bytes to the string.
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to the string.
+     * \param[in] end The end of the block of signed bytes to write to the string.
+     */
+    void put( std::int8_t const * begin, std::int8_t const * end ) noexcept override final
+    {
+        this->append( reinterpret_cast<char const *>( begin ), reinterpret_cast<char const *>( end ) );
+    }
+
+    using Reliable_Stream_Buffer::put;
+
+    /**
+     * \brief Do nothing.
+     */
+    void flush() noexcept override final
+    {
+    }
+};
+
+/**
+ * \brief Fixed capacity string that is also an output stream.
+ *
+ * Formatted and unformatted output written to the stream is appended to the string. If
+ * the string is filled, the characters that do not fit are discarded, the write fails
+ * with picolibrary::Generic_Error::INSUFFICIENT_CAPACITY, and the stream reports a fatal
+ * error (see picolibrary::Stream::fatal_error_present()) until it is cleared using
+ * picolibrary::Fixed_Capacity_String::clear().
+ *
+ * \tparam N The maximum number of characters in the string.
+ */
+template<std::size_t N>
+class Fixed_Capacity_String : public Static_Output_Stream<Fixed_Capacity_String_Stream_Buffer<N>> {
+  public:
+    /**
+     * \brief The number of characters in the string.
+     */
+    using Size = typename Fixed_Capacity_String_Storage<N>::Size;
+
+    /**
+     * \brief A const string iterator.
+     */
+    using Const_Iterator = typename Fixed_Capacity_String_Storage<N>::Const_Iterator;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Fixed_Capacity_String() noexcept
+    {
+        this->set_buffer( &m_buffer );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Fixed_Capacity_String( Fixed_Capacity_String && source ) noexcept :
+        Static_Output_Stream<Fixed_Capacity_String_Stream_Buffer<N>>{ std::move( source ) },
+        m_buffer{ std::move( source.m_buffer ) }
+    {
+        this->set_buffer( &m_buffer );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Fixed_Capacity_String( Fixed_Capacity_String const & original ) noexcept :
+        Static_Output_Stream<Fixed_Capacity_String_Stream_Buffer<N>>{ original },
+        m_buffer{ original.m_buffer }
+    {
+        this->set_buffer( &m_buffer );
+    }
+
+    /**
+     * \brief Destructor.
+     */
+    ~Fixed_Capacity_String() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed_Capacity_String && expression ) noexcept -> Fixed_Capacity_String &
+    {
+        return *this = static_cast<Fixed_Capacity_String const &>( expression );
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Fixed_Capacity_String const & expression ) noexcept
+        -> Fixed_Capacity_String &
+    {
+        if ( &expression != this ) {
+            Static_Output_Stream<Fixed_Capacity_String_Stream_Buffer<N>>::operator=( expression );
+
+            m_buffer = expression.m_buffer;
+
+            this->set_buffer( &m_buffer );
+        } // if
+
+        return *this;
+    }
+
+    /**
+     * \brief Access the underlying character array.
+     *
+     * \attention The underlying character array is not null-terminated.
+     *
+     * \return The underlying character array.
+     */
+    constexpr auto data() const noexcept -> char const *
+    {
+        return m_buffer.data();
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the string.
+     *
+     * \return An iterator to the first character of the string.
+     */
+    constexpr auto begin() const noexcept -> Const_Iterator
+    {
+        return m_buffer.begin();
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        string.
+     *
+     * \return An iterator to the character following the last character of the string.
+     */
+    constexpr auto end() const noexcept -> Const_Iterator
+    {
+        return m_buffer.end();
+    }
+
+    /**
+     * \brief Check if the string is empty.
+     *
+     * \return true if the string is empty.
+     * \return false if the string is not empty.
+     */
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool
+    {
+        return m_buffer.empty();
+    }
+
+    /**
+     * \brief Check if the string is full.
+     *
+     * \return true if the string is full.
+     * \return false if the string is not full.
+     */
+    constexpr auto full() const noexcept -> bool
+    {
+        return m_buffer.full();
+    }
+
+    /**
+     * \brief Get the number of characters in the string.
+     *
+     * \return The number of characters in the string.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_buffer.size();
+    }
+
+    /**
+     * \brief Get the maximum number of characters the string is able to hold.
+     *
+     * \return The maximum number of characters the string is able to hold.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Check if characters have been discarded because the string was full.
+     *
+     * \return true if characters have been discarded.
+     * \return false if characters have not been discarded.
+     */
+    constexpr auto truncated() const noexcept -> bool
+    {
+        return m_buffer.truncated();
+    }
+
+    /**
+     * \brief Erase all characters and clear any fatal error reported by the stream.
+     */
+    constexpr void clear() noexcept
+    {
+        m_buffer.clear();
+
+        this->clear_fatal_error();
+    }
+
+  private:
+    /**
+     * \brief The stream's device access buffer.
+     */
+    Fixed_Capacity_String_Stream_Buffer<N> m_buffer{};
+};
+
+/**
+ * \brief Fixed capacity string that is also a reliable output stream.
+ *
+ * Formatted and unformatted output written to the stream is appended to the string. If
+ * the string is filled, the characters that do not fit are discarded and
+ * picolibrary::Reliable_Fixed_Capacity_String::truncated() reports the truncation.
+ * Truncation is not reported through the stream's state since a reliable output stream
+ * that is not nominal cannot be written to, which would make writing a sequence of
+ * values that does not fit a precondition violation instead of a truncation.
+ *
+ * \tparam N The maximum number of characters in the string.
+ */
+template<std::size_t N>
+class Reliable_Fixed_Capacity_String :
+    public Static_Output_Stream<Reliable_Fixed_Capacity_String_Stream_Buffer<N>> {
+  public:
+    /**
+     * \brief The number of characters in the string.
+     */
+    using Size = typename Fixed_Capacity_String_Storage<N>::Size;
+
+    /**
+     * \brief A const string iterator.
+     */
+    using Const_Iterator = typename Fixed_Capacity_String_Storage<N>::Const_Iterator;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Reliable_Fixed_Capacity_String() noexcept
+    {
+        this->set_buffer( &m_buffer );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Reliable_Fixed_Capacity_String( Reliable_Fixed_Capacity_String && source ) noexcept :
+        Static_Output_Stream<Reliable_Fixed_Capacity_String_Stream_Buffer<N>>{ std::move( source ) },
+        m_buffer{ std::move( source.m_buffer ) }
+    {
+        this->set_buffer( &m_buffer );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Reliable_Fixed_Capacity_String( Reliable_Fixed_Capacity_String const & original ) noexcept :
+        Static_Output_Stream<Reliable_Fixed_Capacity_String_Stream_Buffer<N>>{ original },
+        m_buffer{ original.m_buffer }
+    {
+        this->set_buffer( &m_buffer );
+    }
+
+    /**
+     * \brief Destructor.
+     */
+    ~Reliable_Fixed_Capacity_String() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Reliable_Fixed_Capacity_String && expression ) noexcept
+        -> Reliable_Fixed_Capacity_String &
+    {
+        return *this = static_cast<Reliable_Fixed_Capacity_String const &>( expression );
+    }
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Reliable_Fixed_Capacity_String const & expression ) noexcept
+        -> Reliable_Fixed_Capacity_String &
+    {
+        if ( &expression != this ) {
+            Static_Output_Stream<Reliable_Fixed_Capacity_String_Stream_Buffer<N>>::operator=( expression );
+
+            m_buffer = expression.m_buffer;
+
+            this->set_buffer( &m_buffer );
+        } // if
+
+        return *this;
+    }
+
+    /**
+     * \brief Access the underlying character array.
+     *
+     * \attention The underlying character array is not null-terminated.
+     *
+     * \return The underlying character array.
+     */
+    constexpr auto data() const noexcept -> char const *
+    {
+        return m_buffer.data();
+    }
+
+    /**
+     * \brief Get an iterator to the first character of the string.
+     *
+     * \return An iterator to the first character of the string.
+     */
+    constexpr auto begin() const noexcept -> Const_Iterator
+    {
+        return m_buffer.begin();
+    }
+
+    /**
+     * \brief Get an iterator to the character following the last character of the
+     *        string.
+     *
+     * \return An iterator to the character following the last character of the string.
+     */
+    constexpr auto end() const noexcept -> Const_Iterator
+    {
+        return m_buffer.end();
+    }
+
+    /**
+     * \brief Check if the string is empty.
+     *
+     * \return true if the string is empty.
+     * \return false if the string is not empty.
+     */
+    [[nodiscard]] constexpr auto empty() const noexcept -> bool
+    {
+        return m_buffer.empty();
+    }
+
+    /**
+     * \brief Check if the string is full.
+     *
+     * \return true if the string is full.
+     * \return false if the string is not full.
+     */
+    constexpr auto full() const noexcept -> bool
+    {
+        return m_buffer.full();
+    }
+
+    /**
+     * \brief Get the number of characters in the string.
+     *
+     * \return The number of characters in the string.
+     */
+    constexpr auto size() const noexcept -> Size
+    {
+        return m_buffer.size();
+    }
+
+    /**
+     * \brief Get the maximum number of characters the string is able to hold.
+     *
+     * \return The maximum number of characters the string is able to hold.
+     */
+    static constexpr auto capacity() noexcept -> Size
+    {
+        return N;
+    }
+
+    /**
+     * \brief Check if characters have been discarded because the string was full.
+     *
+     * \return true if characters have been discarded.
+     * \return false if characters have not been discarded.
+     */
+    constexpr auto truncated() const noexcept -> bool
+    {
+        return m_buffer.truncated();
+    }
+
+    /**
+     * \brief Erase all characters.
+     */
+    constexpr void clear() noexcept
+    {
+        m_buffer.clear();
+    }
+
+  private:
+    /**
+     * \brief The stream's device access buffer.
+     */
+    Reliable_Fixed_Capacity_String_Stream_Buffer<N> m_buffer{};
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_FIXED_CAPACITY_STRING_H
@@ -23,11 +23,11 @@
 #ifndef PICOLIBRARY_FORMAT_H
 #define PICOLIBRARY_FORMAT_H
 
-#include <cctype>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
+#include <tuple>
 #include <type_traits>
 
 #include "picolibrary/algorithm.h"
@@ -35,6 +35,7 @@
 #include "picolibrary/bit_manipulation.h"
 #include "picolibrary/result.h"
 #include "picolibrary/stream.h"
+#include "picolibrary/text_encoding.h"
 #include "picolibrary/utility.h"
 
 /**
@@ -42,6 +43,41 @@
  */
 namespace picolibrary::Format {
 
+/**
+ * \brief Nibble to hexadecimal digit lookup table.
+ */
+inline constexpr auto HEX_DIGIT_LOOKUP_TABLE = Array<char, 16>{
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+};
+
+/**
+ * \brief Nibble to binary digits lookup table.
+ */
+using Bin_Digits_Lookup_Table = Array<Array<char, 4>, 16>;
+
+/**
+ * \brief Generate the nibble to binary digits lookup table.
+ *
+ * \return The generated nibble to binary digits lookup table.
+ */
+constexpr auto generate_bin_digits_lookup_table() noexcept -> Bin_Digits_Lookup_Table
+{
+    Bin_Digits_Lookup_Table lookup_table{};
+
+    for ( auto nibble = std::uint_fast8_t{ 0 }; nibble < lookup_table.size(); ++nibble ) {
+        for ( auto bit = std::uint_fast8_t{ 0 }; bit < lookup_table[ nibble ].size(); ++bit ) {
+            lookup_table[ nibble ][ lookup_table[ nibble ].size() - 1 - bit ] = '0' + ( ( nibble >> bit ) & 0b1 );
+        } // for
+    }     // for
+
+    return lookup_table;
+}
+
+/**
+ * \brief Nibble to binary digits lookup table.
+ */
+inline constexpr auto BIN_DIGITS_LOOKUP_TABLE = generate_bin_digits_lookup_table();
+
 /**
  * \brief Integer binary output format specifier.
  *
@@ -271,10 +307,15 @@ class Hex {
  * \brief Hex dump output format specifier.
  *
  * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam ROWS_PER_PUT The maximum number of rows to write to the stream with a single
+ *         put. Increasing the number of rows per put reduces the number of stream buffer
+ *         calls at the cost of a larger row buffer.
  */
-template<typename Iterator>
+template<typename Iterator, std::size_t ROWS_PER_PUT = 1>
 class Hex_Dump {
   public:
+    static_assert( ROWS_PER_PUT > 0 );
+
     Hex_Dump() = delete;
 
     /**
@@ -358,41 +399,51 @@ class Hex_Dump {
     Iterator m_end{};
 };
 
-} // namespace picolibrary::Format
-
-namespace picolibrary {
-
 /**
- * \brief picolibrary::Format::Bin output formatter.
+ * \brief Base16 (hexadecimal string) output format specifier.
  *
- * \tparam Integer The type of integer to print.
+ * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam BYTES_PER_PUT The maximum number of bytes to encode and write to the stream
+ *         with a single put. Increasing the number of bytes per put reduces the number of
+ *         stream buffer calls at the cost of a larger encoding buffer.
  */
-template<typename Integer>
-class Output_Formatter<Format::Bin<Integer>> {
+template<typename Iterator, std::size_t BYTES_PER_PUT = 32>
+class Base16 {
   public:
+    static_assert( BYTES_PER_PUT > 0 );
+
+    Base16() = delete;
+
     /**
      * \brief Constructor.
+     *
+     * \param[in] begin The beginning of the data to encode.
+     * \param[in] end The end of the data to encode.
      */
-    constexpr Output_Formatter() noexcept = default;
+    constexpr Base16( Iterator begin, Iterator end ) noexcept :
+        m_begin{ begin },
+        m_end{ end }
+    {
+    }
 
     /**
      * \brief Constructor.
      *
      * \param[in] source The source of the move.
      */
-    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+    constexpr Base16( Base16 && source ) noexcept = default;
 
     /**
      * \brief Constructor.
      *
      * \param[in] original The original to copy.
      */
-    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+    constexpr Base16( Base16 const & original ) noexcept = default;
 
     /**
      * \brief Destructor.
      */
-    ~Output_Formatter() noexcept = default;
+    ~Base16() noexcept = default;
 
     /**
      * \brief Assignment operator.
@@ -401,7 +452,7 @@ class Output_Formatter<Format::Bin<Integer>> {
      *
      * \return The assigned to object.
      */
-    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+    constexpr auto operator=( Base16 && expression ) noexcept -> Base16 & = default;
 
     /**
      * \brief Assignment operator.
@@ -410,117 +461,85 @@ class Output_Formatter<Format::Bin<Integer>> {
      *
      * \return The assigned to object.
      */
-    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
-        -> Output_Formatter & = default;
+    constexpr auto operator=( Base16 const & expression ) noexcept -> Base16 & = default;
 
     /**
-     * \brief Write the formatted picolibrary::Format::Bin to the stream.
-     *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Bin to.
-     * \param[in] integer The integer to format.
+     * \brief Get the beginning of the data to encode.
      *
-     * \return The number of characters written to the stream if the write succeeded.
-     * \return An error code if the write failed.
+     * \return The beginning of the data to encode.
      */
-    auto print( Output_Stream & stream, Integer integer ) const noexcept -> Result<std::size_t>
+    constexpr auto begin() const noexcept -> Iterator
     {
-        auto const formatted_integer = format( integer );
-
-        auto result = stream.put( formatted_integer.begin(), formatted_integer.end() );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
-
-        return formatted_integer.size();
+        return m_begin;
     }
 
     /**
-     * \brief Write the formatted picolibrary::Format::Bin to the stream.
-     *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Bin to.
-     * \param[in] integer The integer to format.
+     * \brief Get the end of the data to encode.
      *
-     * \return The number of characters written to the stream.
+     * \return The end of the data to encode.
      */
-    auto print( Reliable_Output_Stream & stream, Integer integer ) const noexcept
+    constexpr auto end() const noexcept -> Iterator
     {
-        auto const formatted_integer = format( integer );
-
-        stream.put( formatted_integer.begin(), formatted_integer.end() );
-
-        return formatted_integer.size();
+        return m_end;
     }
 
   private:
     /**
-     * \brief The number of bits in an unsigned integer.
-     */
-    static constexpr auto DIGITS = std::numeric_limits<std::make_unsigned_t<Integer>>::digits;
-
-    /**
-     * \brief Formatted integer.
+     * \brief The beginning of the data to encode.
      */
-    using Formatted_Integer = Array<char, 2 + DIGITS>;
+    Iterator m_begin{};
 
     /**
-     * \brief Format an integer.
-     *
-     * \param[in] integer The integer to format.
-     *
-     * \return The formatted integer.
+     * \brief The end of the data to encode.
      */
-    static constexpr auto format( Integer integer ) noexcept -> Formatted_Integer
-    {
-        auto unsigned_integer = to_unsigned( integer );
-
-        Formatted_Integer formatted_integer;
-
-        auto i = formatted_integer.rbegin();
-        for ( auto bit = 0; bit < DIGITS; ++bit ) {
-            *i = '0' + ( unsigned_integer & 0b1 );
-
-            ++i;
-            unsigned_integer >>= 1;
-        } // for
-        *i = 'b';
-        ++i;
-        *i = '0';
-
-        return formatted_integer;
-    }
+    Iterator m_end{};
 };
 
 /**
- * \brief picolibrary::Format::Dec output formatter.
+ * \brief Base64 output format specifier.
  *
- * \tparam Integer The type of integer to print.
+ * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam GROUPS_PER_PUT The maximum number of 3 byte groups to encode and write to the
+ *         stream with a single put. Increasing the number of groups per put reduces the
+ *         number of stream buffer calls at the cost of a larger encoding buffer.
  */
-template<typename Integer>
-class Output_Formatter<Format::Dec<Integer>, std::enable_if_t<std::is_signed_v<Integer>>> {
+template<typename Iterator, std::size_t GROUPS_PER_PUT = 16>
+class Base64 {
   public:
+    static_assert( GROUPS_PER_PUT > 0 );
+
+    Base64() = delete;
+
     /**
      * \brief Constructor.
+     *
+     * \param[in] begin The beginning of the data to encode.
+     * \param[in] end The end of the data to encode.
      */
-    constexpr Output_Formatter() noexcept = default;
+    constexpr Base64( Iterator begin, Iterator end ) noexcept :
+        m_begin{ begin },
+        m_end{ end }
+    {
+    }
 
     /**
      * \brief Constructor.
      *
      * \param[in] source The source of the move.
      */
-    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+    constexpr Base64( Base64 && source ) noexcept = default;
 
     /**
      * \brief Constructor.
      *
      * \param[in] original The original to copy.
      */
-    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+    constexpr Base64( Base64 const & original ) noexcept = default;
 
     /**
      * \brief Destructor.
      */
-    ~Output_Formatter() noexcept = default;
+    ~Base64() noexcept = default;
 
     /**
      * \brief Assignment operator.
@@ -529,7 +548,7 @@ class Output_Formatter<Format::Dec<Integer>, std::enable_if_t<std::is_signed_v<I
      *
      * \return The assigned to object.
      */
-    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+    constexpr auto operator=( Base64 && expression ) noexcept -> Base64 & = default;
 
     /**
      * \brief Assignment operator.
@@ -538,119 +557,168 @@ class Output_Formatter<Format::Dec<Integer>, std::enable_if_t<std::is_signed_v<I
      *
      * \return The assigned to object.
      */
-    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
-        -> Output_Formatter & = default;
+    constexpr auto operator=( Base64 const & expression ) noexcept -> Base64 & = default;
 
     /**
-     * \brief Write the formatted picolibrary::Format::Dec to the stream.
+     * \brief Get the beginning of the data to encode.
      *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Dec to.
-     * \param[in] integer The integer to format.
-     *
-     * \return The number of characters written to the stream if the write succeeded.
-     * \return An error code if the write failed.
+     * \return The beginning of the data to encode.
      */
-    auto print( Output_Stream & stream, Integer integer ) const noexcept -> Result<std::size_t>
+    constexpr auto begin() const noexcept -> Iterator
     {
-        Formatted_Integer formatted_integer;
-
-        auto const begin = format( integer, formatted_integer );
-
-        auto result = stream.put( begin, formatted_integer.end() );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
-
-        return static_cast<std::size_t>( formatted_integer.end() - begin );
+        return m_begin;
     }
 
     /**
-     * \brief Write the formatted picolibrary::Format::Dec to the stream.
-     *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Dec to.
-     * \param[in] integer The integer to format.
+     * \brief Get the end of the data to encode.
      *
-     * \return The number of characters written to the stream.
+     * \return The end of the data to encode.
      */
-    auto print( Reliable_Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
+    constexpr auto end() const noexcept -> Iterator
     {
-        Formatted_Integer formatted_integer;
-
-        auto const begin = format( integer, formatted_integer );
-
-        stream.put( begin, formatted_integer.end() );
-
-        return static_cast<std::size_t>( formatted_integer.end() - begin );
+        return m_end;
     }
 
   private:
     /**
-     * \brief Formatted integer.
+     * \brief The beginning of the data to encode.
      */
-    using Formatted_Integer = Array<char, 1 + std::numeric_limits<Integer>::digits10 + 1>;
+    Iterator m_begin{};
 
     /**
-     * \brief Format an integer.
-     *
-     * \param[in] integer The integer to format.
-     * \param[out] formatted_integer The array to write the formatted integer to.
-     *
-     * \return An iterator to the beginning of the formatted integer.
+     * \brief The end of the data to encode.
      */
-    static constexpr auto format( Integer integer, Formatted_Integer & formatted_integer ) noexcept
-    {
-        auto is_negative = integer < 0;
+    Iterator m_end{};
+};
 
-        auto i = formatted_integer.rbegin();
+/**
+ * \brief Compile-time format string output format specifier.
+ *
+ * Use PICOLIBRARY_FORMAT() to create a compile-time format string output format
+ * specifier.
+ *
+ * The format string is parsed at compile time. Adjacent literal characters are merged
+ * into a single literal fragment that is written to the stream with a single put, and the
+ * number and type of the values to format is checked against the format string's
+ * replacement fields.
+ *
+ * The following format string syntax is supported:
+ * - "{{" and "}}" are replaced with "{" and "}" respectively
+ * - "{}" is replaced with the next value formatted using the value's default output
+ *   formatter
+ * - "{:b}" is replaced with the next value formatted using
+ *   picolibrary::Output_Formatter<picolibrary::Format::Bin<Integer>> (the value must be
+ *   an integer)
+ * - "{:d}" is replaced with the next value formatted using
+ *   picolibrary::Output_Formatter<picolibrary::Format::Dec<Integer>> (the value must be
+ *   an integer)
+ * - "{:x}" is replaced with the next value formatted using
+ *   picolibrary::Output_Formatter<picolibrary::Format::Hex<Integer>> (the value must be
+ *   an integer)
+ *
+ * \tparam Source The format string source. The format string source must provide a
+ *         static constexpr string() member function that returns the null-terminated
+ *         format string.
+ * \tparam Types The types of the values to format.
+ */
+template<typename Source, typename... Types>
+class String {
+  public:
+    /**
+     * \brief Replacement field conversion.
+     */
+    enum class Conversion : std::uint_fast8_t {
+        DEFAULT, ///< Default.
+        BIN,     ///< Binary.
+        DEC,     ///< Decimal.
+        HEX,     ///< Hexadecimal.
+    };
 
-        do {
-            *i = '0' + std::abs( integer % 10 );
+    /**
+     * \brief Format string fragment.
+     */
+    struct Fragment {
+        /**
+         * \brief true if the fragment is a literal, false if the fragment is a
+         *        replacement field.
+         */
+        bool is_literal;
 
-            ++i;
-            integer /= 10;
-        } while ( integer );
+        /**
+         * \brief The beginning of the literal fragment's characters in the literal
+         *        character table.
+         */
+        std::size_t begin;
 
-        if ( is_negative ) {
-            *i = '-';
+        /**
+         * \brief The end of the literal fragment's characters in the literal character
+         *        table.
+         */
+        std::size_t end;
 
-            ++i;
-        } // if
+        /**
+         * \brief The replacement field fragment's conversion.
+         */
+        Conversion conversion;
+    };
 
-        return i.base();
-    }
-};
+    /**
+     * \brief Format string analysis.
+     */
+    struct Analysis {
+        /**
+         * \brief true if the format string is well formed, false if the format string is
+         *        malformed.
+         */
+        bool is_valid;
+
+        /**
+         * \brief The number of characters in the format string's literal fragments.
+         */
+        std::size_t literal_characters;
+
+        /**
+         * \brief The number of fragments in the format string.
+         */
+        std::size_t fragments;
+
+        /**
+         * \brief The number of replacement fields in the format string.
+         */
+        std::size_t replacement_fields;
+    };
+
+    String() = delete;
 
-/**
- * \brief picolibrary::Format::Dec output formatter.
- *
- * \tparam Integer The type of integer to print.
- */
-template<typename Integer>
-class Output_Formatter<Format::Dec<Integer>, std::enable_if_t<std::is_unsigned_v<Integer>>> {
-  public:
     /**
      * \brief Constructor.
+     *
+     * \param[in] source The format string source.
+     * \param[in] values The values to format.
      */
-    constexpr Output_Formatter() noexcept = default;
+    constexpr String( Source source, Types const &... values ) noexcept : m_values{ values... }
+    {
+        static_cast<void>( source );
+    }
 
     /**
      * \brief Constructor.
      *
      * \param[in] source The source of the move.
      */
-    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+    constexpr String( String && source ) noexcept = default;
 
     /**
      * \brief Constructor.
      *
      * \param[in] original The original to copy.
      */
-    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+    constexpr String( String const & original ) noexcept = default;
 
     /**
      * \brief Destructor.
      */
-    ~Output_Formatter() noexcept = default;
+    ~String() noexcept = default;
 
     /**
      * \brief Assignment operator.
@@ -659,7 +727,7 @@ class Output_Formatter<Format::Dec<Integer>, std::enable_if_t<std::is_unsigned_v
      *
      * \return The assigned to object.
      */
-    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+    constexpr auto operator=( String && expression ) noexcept -> String & = default;
 
     /**
      * \brief Assignment operator.
@@ -668,85 +736,223 @@ class Output_Formatter<Format::Dec<Integer>, std::enable_if_t<std::is_unsigned_v
      *
      * \return The assigned to object.
      */
-    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
-        -> Output_Formatter & = default;
+    constexpr auto operator=( String const & expression ) noexcept -> String & = default;
 
     /**
-     * \brief Write the formatted picolibrary::Format::Dec to the stream.
+     * \brief Analyze the format string.
      *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Dec to.
-     * \param[in] integer The integer to format.
+     * \return The format string analysis.
+     */
+    static constexpr auto analyze() noexcept -> Analysis
+    {
+        auto analysis = Analysis{ false, 0, 0, 0 };
+
+        auto previous_fragment_is_literal = false;
+
+        analysis.is_valid = parse(
+            [ & ]( char ) noexcept {
+                if ( not previous_fragment_is_literal ) {
+                    ++analysis.fragments;
+                } // if
+
+                ++analysis.literal_characters;
+                previous_fragment_is_literal = true;
+            },
+            [ & ]( Conversion ) noexcept {
+                ++analysis.fragments;
+                ++analysis.replacement_fields;
+                previous_fragment_is_literal = false;
+            } );
+
+        return analysis;
+    }
+
+    /**
+     * \brief Generate the format string's literal character table.
      *
-     * \return The number of characters written to the stream if the write succeeded.
-     * \return An error code if the write failed.
+     * \tparam N The number of characters in the format string's literal fragments.
+     *
+     * \return The format string's literal character table.
      */
-    auto print( Output_Stream & stream, Integer integer ) const noexcept -> Result<std::size_t>
+    template<std::size_t N>
+    static constexpr auto literal_characters() noexcept -> Array<char, N>
     {
-        Formatted_Integer formatted_integer;
+        auto table = Array<char, N>{};
 
-        auto const begin = format( integer, formatted_integer );
+        auto i = std::size_t{ 0 };
 
-        auto result = stream.put( begin, formatted_integer.end() );
-        if ( result.is_error() ) {
-            return result.error();
-        } // if
+        parse(
+            [ & ]( char character ) noexcept {
+                table[ i ] = character;
+                ++i;
+            },
+            []( Conversion ) noexcept {} );
 
-        return static_cast<std::size_t>( formatted_integer.end() - begin );
+        return table;
     }
 
     /**
-     * \brief Write the formatted picolibrary::Format::Dec to the stream.
+     * \brief Generate the format string's fragment table.
      *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Dec to.
-     * \param[in] integer The integer to format.
+     * \tparam N The number of fragments in the format string.
      *
-     * \return The number of characters written to the stream.
+     * \return The format string's fragment table.
      */
-    auto print( Reliable_Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
+    template<std::size_t N>
+    static constexpr auto fragments() noexcept -> Array<Fragment, N>
     {
-        Formatted_Integer formatted_integer;
-
-        auto const begin = format( integer, formatted_integer );
-
-        stream.put( begin, formatted_integer.end() );
+        auto table = Array<Fragment, N>{};
+
+        auto fragment  = std::size_t{ 0 };
+        auto character = std::size_t{ 0 };
+
+        parse(
+            [ & ]( char ) noexcept {
+                if ( fragment and table[ fragment - 1 ].is_literal ) {
+                    ++table[ fragment - 1 ].end;
+                } else {
+                    table[ fragment ] = Fragment{ true, character, character + 1, Conversion::DEFAULT };
+                    ++fragment;
+                } // else
+
+                ++character;
+            },
+            [ & ]( Conversion conversion ) noexcept {
+                table[ fragment ] = Fragment{ false, character, character, conversion };
+                ++fragment;
+            } );
+
+        return table;
+    }
 
-        return static_cast<std::size_t>( formatted_integer.end() - begin );
+    /**
+     * \brief Get the values to format.
+     *
+     * \return The values to format.
+     */
+    constexpr auto values() const noexcept -> std::tuple<Types...> const &
+    {
+        return m_values;
     }
 
   private:
     /**
-     * \brief Formatted integer.
+     * \brief The values to format.
      */
-    using Formatted_Integer = Array<char, std::numeric_limits<Integer>::digits10 + 1>;
+    std::tuple<Types...> m_values;
 
     /**
-     * \brief Format an integer.
+     * \brief Parse the format string.
      *
-     * \param[in] integer The integer to format.
-     * \param[in] formatted_integer The array to write the formatted integer to.
+     * \tparam Literal_Handler A literal character handler. The handler must take the
+     *         form void( char ).
+     * \tparam Replacement_Field_Handler A replacement field handler. The handler must
+     *         take the form void( Conversion ).
      *
-     * \return An iterator to the beginning of the formatted integer.
+     * \param[in] literal_handler The literal character handler.
+     * \param[in] replacement_field_handler The replacement field handler.
+     *
+     * \return true if the format string is well formed.
+     * \return false if the format string is malformed.
      */
-    static constexpr auto format( Integer integer, Formatted_Integer & formatted_integer ) noexcept
+    template<typename Literal_Handler, typename Replacement_Field_Handler>
+    static constexpr auto parse( Literal_Handler literal_handler, Replacement_Field_Handler replacement_field_handler ) noexcept
+        -> bool
     {
-        auto i = formatted_integer.rbegin();
-        do {
-            *i = '0' + ( integer % 10 );
+        for ( auto i = Source::string(); *i; ++i ) {
+            if ( *i == '}' ) {
+                ++i;
 
-            ++i;
-            integer /= 10;
-        } while ( integer );
-        return i.base();
+                if ( *i != '}' ) {
+                    return false;
+                } // if
+
+                literal_handler( '}' );
+            } else if ( *i == '{' ) {
+                ++i;
+
+                if ( *i == '{' ) {
+                    literal_handler( '{' );
+
+                    continue;
+                } // if
+
+                auto conversion = Conversion::DEFAULT;
+
+                if ( *i == ':' ) {
+                    ++i;
+
+                    switch ( *i ) {
+                        case 'b': conversion = Conversion::BIN; break;
+                        case 'd': conversion = Conversion::DEC; break;
+                        case 'x': conversion = Conversion::HEX; break;
+                        default: return false;
+                    } // switch
+
+                    ++i;
+                } // if
+
+                if ( *i != '}' ) {
+                    return false;
+                } // if
+
+                replacement_field_handler( conversion );
+            } else {
+                literal_handler( *i );
+            } // else
+        }     // for
+
+        return true;
     }
 };
 
 /**
- * \brief picolibrary::Format::Hex output formatter.
+ * \brief picolibrary::Format::String deduction guide.
+ *
+ * \tparam Source The format string source.
+ * \tparam Types The types of the values to format.
+ */
+template<typename Source, typename... Types>
+String( Source, Types... ) -> String<Source, Types...>;
+
+} // namespace picolibrary::Format
+
+/**
+ * \brief Create a compile-time format string output format specifier.
+ *
+ * \relatedalso picolibrary::Format::String
+ *
+ * \param[in] format The format string literal.
+ * \param[in] ... The values to format.
+ *
+ * \return The compile-time format string output format specifier.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PICOLIBRARY_FORMAT( format, ... )                                    \
+    ::picolibrary::Format::String                                           \
+    {                                                                       \
+        [] {                                                                \
+            struct Source {                                                 \
+                static constexpr auto string() noexcept -> char const *     \
+                {                                                           \
+                    return format;                                          \
+                }                                                           \
+            };                                                              \
+                                                                            \
+            return Source{};                                                \
+        }(),                                                                \
+            ##__VA_ARGS__                                                   \
+    }
+
+namespace picolibrary {
+
+/**
+ * \brief picolibrary::Format::Bin output formatter.
  *
  * \tparam Integer The type of integer to print.
  */
 template<typename Integer>
-class Output_Formatter<Format::Hex<Integer>> {
+class Output_Formatter<Format::Bin<Integer>> {
   public:
     /**
      * \brief Constructor.
@@ -792,9 +998,9 @@ class Output_Formatter<Format::Hex<Integer>> {
         -> Output_Formatter & = default;
 
     /**
-     * \brief Write the formatted picolibrary::Format::Hex to the stream.
+     * \brief Write the formatted picolibrary::Format::Bin to the stream.
      *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Hex to.
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Bin to.
      * \param[in] integer The integer to format.
      *
      * \return The number of characters written to the stream if the write succeeded.
@@ -813,14 +1019,14 @@ class Output_Formatter<Format::Hex<Integer>> {
     }
 
     /**
-     * \brief Write the formatted picolibrary::Format::Hex to the stream.
+     * \brief Write the formatted picolibrary::Format::Bin to the stream.
      *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Hex to.
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Bin to.
      * \param[in] integer The integer to format.
      *
      * \return The number of characters written to the stream.
      */
-    auto print( Reliable_Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
+    auto print( Reliable_Output_Stream & stream, Integer integer ) const noexcept
     {
         auto const formatted_integer = format( integer );
 
@@ -830,25 +1036,30 @@ class Output_Formatter<Format::Hex<Integer>> {
     }
 
   private:
+    /**
+     * \brief The number of bits in an unsigned integer.
+     */
+    static constexpr auto DIGITS = std::numeric_limits<std::make_unsigned_t<Integer>>::digits;
+
     /**
      * \brief The number of bits in a nibble.
      */
     static constexpr auto NIBBLE_DIGITS = 4;
 
     /**
-     * \brief The largest value a nibble can hold.
+     * \brief Nibble bit mask.
      */
-    static constexpr auto NIBBLE_MAX = std::uint_fast8_t{ 0xF };
+    static constexpr auto NIBBLE_MASK = std::uint_fast8_t{ 0xF };
 
     /**
      * \brief The number of nibbles in an unsigned integer.
      */
-    static constexpr auto NIBBLES = std::numeric_limits<std::make_unsigned_t<Integer>>::digits / NIBBLE_DIGITS;
+    static constexpr auto NIBBLES = DIGITS / NIBBLE_DIGITS;
 
     /**
      * \brief Formatted integer.
      */
-    using Formatted_Integer = Array<char, 2 + NIBBLES>;
+    using Formatted_Integer = Array<char, 2 + DIGITS>;
 
     /**
      * \brief Format an integer.
@@ -863,30 +1074,29 @@ class Output_Formatter<Format::Hex<Integer>> {
 
         Formatted_Integer formatted_integer;
 
-        auto i = formatted_integer.rbegin();
+        auto i = formatted_integer.end();
         for ( auto nibble = 0; nibble < NIBBLES; ++nibble ) {
-            auto const n = unsigned_integer & NIBBLE_MAX;
+            auto const & digits = Format::BIN_DIGITS_LOOKUP_TABLE[ unsigned_integer & NIBBLE_MASK ];
 
-            *i = n < 0xA ? '0' + n : 'A' + ( n - 0xA );
+            i -= digits.size();
+            for ( auto j = std::size_t{ 0 }; j < digits.size(); ++j ) { i[ j ] = digits[ j ]; } // for
 
-            ++i;
             unsigned_integer >>= NIBBLE_DIGITS;
         } // for
-        *i = 'x';
-        ++i;
-        *i = '0';
+        formatted_integer[ 0 ] = '0';
+        formatted_integer[ 1 ] = 'b';
 
         return formatted_integer;
     }
 };
 
 /**
- * \brief picolibrary::Format::Hex_Dump output formatter.
+ * \brief picolibrary::Format::Dec output formatter.
  *
- * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam Integer The type of integer to print.
  */
-template<typename Iterator>
-class Output_Formatter<Format::Hex_Dump<Iterator>> {
+template<typename Integer>
+class Output_Formatter<Format::Dec<Integer>, std::enable_if_t<std::is_signed_v<Integer>>> {
   public:
     /**
      * \brief Constructor.
@@ -932,205 +1142,1159 @@ class Output_Formatter<Format::Hex_Dump<Iterator>> {
         -> Output_Formatter & = default;
 
     /**
-     * \brief Write the formatted picolibrary::Format::Hex_Dump to the stream.
+     * \brief Write the formatted picolibrary::Format::Dec to the stream.
      *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Hex_Dump
-     *            to.
-     * \param[in] hex_dump The picolibrary::Format::Hex_Dump to format.
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Dec to.
+     * \param[in] integer The integer to format.
      *
      * \return The number of characters written to the stream if the write succeeded.
      * \return An error code if the write failed.
      */
-    // NOLINTNEXTLINE(readability-function-size)
-    auto print( Output_Stream & stream, Format::Hex_Dump<Iterator> const & hex_dump ) const noexcept
-        -> Result<std::size_t>
+    auto print( Output_Stream & stream, Integer integer ) const noexcept -> Result<std::size_t>
     {
-        Row row;
-
-        auto begin = hex_dump.begin();
-        auto end   = hex_dump.end();
-        auto n     = std::size_t{ 0 };
+        Formatted_Integer formatted_integer;
 
-        for ( auto memory_offset = std::size_t{ 0 }; begin != end;
-              memory_offset += ROW_BYTES, n += row.size() ) {
-            begin = generate_row( memory_offset, begin, end, row );
+        auto const begin = format( integer, formatted_integer );
 
-            auto result = stream.put( row.begin(), row.end() );
-            if ( result.is_error() ) {
-                return result.error();
-            } // if
-        }     // for
+        auto result = stream.put( begin, formatted_integer.end() );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
 
-        return n;
+        return static_cast<std::size_t>( formatted_integer.end() - begin );
     }
 
     /**
-     * \brief Write the formatted picolibrary::Format::Hex_Dump to the stream.
+     * \brief Write the formatted picolibrary::Format::Dec to the stream.
      *
-     * \param[in] stream The stream to write the formatted picolibrary::Format::Hex_Dump
-     *            to.
-     * \param[in] hex_dump The picolibrary::Format::Hex_Dump to format.
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Dec to.
+     * \param[in] integer The integer to format.
      *
      * \return The number of characters written to the stream.
      */
-    auto print( Reliable_Output_Stream & stream, Format::Hex_Dump<Iterator> const & hex_dump ) const noexcept
-        -> std::size_t
+    auto print( Reliable_Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
     {
-        Row row;
-
-        auto begin = hex_dump.begin();
-        auto end   = hex_dump.end();
-        auto n     = std::size_t{ 0 };
+        Formatted_Integer formatted_integer;
 
-        for ( auto memory_offset = std::size_t{ 0 }; begin != end;
-              memory_offset += ROW_BYTES, n += row.size() ) {
-            begin = generate_row( memory_offset, begin, end, row );
+        auto const begin = format( integer, formatted_integer );
 
-            stream.put( row.begin(), row.end() );
-        } // for
+        stream.put( begin, formatted_integer.end() );
 
-        return n;
+        return static_cast<std::size_t>( formatted_integer.end() - begin );
     }
 
   private:
     /**
-     * \brief The number of bits in a nibble.
+     * \brief Formatted integer.
      */
-    static constexpr auto NIBBLE_DIGITS = std::uint_fast8_t{ 4 };
+    using Formatted_Integer = Array<char, 1 + std::numeric_limits<Integer>::digits10 + 1>;
 
     /**
-     * \brief Nibble bit mask.
+     * \brief Format an integer.
+     *
+     * \param[in] integer The integer to format.
+     * \param[out] formatted_integer The array to write the formatted integer to.
+     *
+     * \return An iterator to the beginning of the formatted integer.
      */
-    static constexpr auto NIBBLE_MASK = mask<std::uint_fast8_t>( NIBBLE_DIGITS, 0 );
+    static constexpr auto format( Integer integer, Formatted_Integer & formatted_integer ) noexcept
+    {
+        auto is_negative = integer < 0;
 
-    /**
-     * \brief The number of nibbles in a memory offset.
-     */
-    static constexpr auto MEMORY_OFFSET_NIBBLES = std::uint_fast8_t{
-        std::numeric_limits<std::size_t>::digits / NIBBLE_DIGITS
-    };
+        auto i = formatted_integer.rbegin();
 
-    /**
-     * \brief The number of nibbles in a byte.
-     */
-    static constexpr auto BYTE_NIBBLES = std::uint_fast8_t{ std::numeric_limits<std::uint8_t>::digits
-                                                            / NIBBLE_DIGITS };
+        do {
+            *i = '0' + std::abs( integer % 10 );
+
+            ++i;
+            integer /= 10;
+        } while ( integer );
+
+        if ( is_negative ) {
+            *i = '-';
+
+            ++i;
+        } // if
+
+        return i.base();
+    }
+};
 
+/**
+ * \brief picolibrary::Format::Dec output formatter.
+ *
+ * \tparam Integer The type of integer to print.
+ */
+template<typename Integer>
+class Output_Formatter<Format::Dec<Integer>, std::enable_if_t<std::is_unsigned_v<Integer>>> {
+  public:
     /**
-     * \brief Group separation spaces.
+     * \brief Constructor.
      */
-    static constexpr auto GROUP_SEPARATION = std::uint_fast8_t{ 2 };
+    constexpr Output_Formatter() noexcept = default;
 
     /**
-     * \brief The number of bytes in a row.
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
      */
-    static constexpr auto ROW_BYTES = std::uint_fast8_t{ 16 };
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
 
     /**
-     * \brief Row buffer memory offset (hex) offset.
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
      */
-    static constexpr auto MEMORY_OFFSET_HEX_OFFSET = std::uint_fast8_t{ 0 };
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
 
     /**
-     * \brief Row buffer data (hex) offset.
+     * \brief Destructor.
      */
-    static constexpr auto DATA_HEX_OFFSET = std::uint_fast8_t{ MEMORY_OFFSET_HEX_OFFSET + MEMORY_OFFSET_NIBBLES
-                                                               + GROUP_SEPARATION };
+    ~Output_Formatter() noexcept = default;
 
     /**
-     * \brief Row buffer data (ASCII) offset.
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
      */
-    static constexpr auto DATA_ASCII_OFFSET = std::uint_fast8_t{
-        DATA_HEX_OFFSET + ( ( ( BYTE_NIBBLES + 1 ) * ROW_BYTES ) - 1 ) + GROUP_SEPARATION + 1
-    };
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
 
     /**
-     * \brief Row buffer.
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
      */
-    using Row =
-        Array<char, MEMORY_OFFSET_NIBBLES + GROUP_SEPARATION + ( ( ( BYTE_NIBBLES + 1 ) * ROW_BYTES ) - 1 ) + GROUP_SEPARATION + 1 + ROW_BYTES + 1 + 1>;
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
 
     /**
-     * \brief Format a memory offset (hex).
+     * \brief Write the formatted picolibrary::Format::Dec to the stream.
      *
-     * \param[in] memory_offset The memory offset to format.
-     * \param[out] location The location to write the formatted memory offset to.
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Dec to.
+     * \param[in] integer The integer to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
      */
-    static void format_hex( std::size_t memory_offset, typename Row::Iterator location ) noexcept
+    auto print( Output_Stream & stream, Integer integer ) const noexcept -> Result<std::size_t>
     {
-        auto i = typename Row::Reverse_Iterator{ location + MEMORY_OFFSET_NIBBLES };
-        for ( auto nibble = std::uint_fast8_t{ 0 }; nibble < MEMORY_OFFSET_NIBBLES; ++nibble ) {
-            auto const n = memory_offset & NIBBLE_MASK;
+        Formatted_Integer formatted_integer;
 
-            *i = n < 0xA ? '0' + n : 'A' + ( n - 0xA );
+        auto const begin = format( integer, formatted_integer );
 
-            ++i;
-            memory_offset >>= NIBBLE_DIGITS;
-        } // for
+        auto result = stream.put( begin, formatted_integer.end() );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return static_cast<std::size_t>( formatted_integer.end() - begin );
     }
 
     /**
-     * \brief Format a byte (hex).
+     * \brief Write the formatted picolibrary::Format::Dec to the stream.
      *
-     * \param[in] byte The byte to format.
-     * \param[out] location The location to write the formatted byte to.
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Dec to.
+     * \param[in] integer The integer to format.
+     *
+     * \return The number of characters written to the stream.
      */
-    static void format_hex( std::uint8_t byte, typename Row::Iterator location ) noexcept
+    auto print( Reliable_Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
     {
-        auto i = typename Row::Reverse_Iterator{ location + BYTE_NIBBLES };
-        for ( auto nibble = std::uint_fast8_t{ 0 }; nibble < BYTE_NIBBLES; ++nibble ) {
-            auto const n = byte & NIBBLE_MASK;
+        Formatted_Integer formatted_integer;
 
-            *i = n < 0xA ? '0' + n : 'A' + ( n - 0xA );
+        auto const begin = format( integer, formatted_integer );
 
-            ++i;
-            byte >>= NIBBLE_DIGITS;
-        } // for
+        stream.put( begin, formatted_integer.end() );
+
+        return static_cast<std::size_t>( formatted_integer.end() - begin );
     }
 
+  private:
     /**
-     * \brief Format a byte (ASCII).
-     *
-     * \param[in] byte The byte to format.
-     * \param[out] location The location to write the formatted byte to.
+     * \brief Formatted integer.
      */
-    static void format_ascii( std::uint8_t byte, typename Row::Iterator location ) noexcept
-    {
-        *location = std::isprint( byte ) ? static_cast<char>( byte ) : '.';
-    }
+    using Formatted_Integer = Array<char, std::numeric_limits<Integer>::digits10 + 1>;
 
     /**
-     * \brief Generate a row.
+     * \brief Format an integer.
      *
-     * \param[in] memory_offset The row's memory offset.
-     * \param[in] begin The beginning of the data.
-     * \param[in] end The end of the data.
-     * \param[out] row The row buffer to write the generated row to.
+     * \param[in] integer The integer to format.
+     * \param[in] formatted_integer The array to write the formatted integer to.
+     *
+     * \return An iterator to the beginning of the formatted integer.
+     */
+    static constexpr auto format( Integer integer, Formatted_Integer & formatted_integer ) noexcept
+    {
+        auto i = formatted_integer.rbegin();
+        do {
+            *i = '0' + ( integer % 10 );
+
+            ++i;
+            integer /= 10;
+        } while ( integer );
+        return i.base();
+    }
+};
+
+/**
+ * \brief picolibrary::Format::Hex output formatter.
+ *
+ * \tparam Integer The type of integer to print.
+ */
+template<typename Integer>
+class Output_Formatter<Format::Hex<Integer>> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
+
+    /**
+     * \brief Write the formatted picolibrary::Format::Hex to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Hex to.
+     * \param[in] integer The integer to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto print( Output_Stream & stream, Integer integer ) const noexcept -> Result<std::size_t>
+    {
+        auto const formatted_integer = format( integer );
+
+        auto result = stream.put( formatted_integer.begin(), formatted_integer.end() );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return formatted_integer.size();
+    }
+
+    /**
+     * \brief Write the formatted picolibrary::Format::Hex to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Hex to.
+     * \param[in] integer The integer to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    auto print( Reliable_Output_Stream & stream, Integer integer ) const noexcept -> std::size_t
+    {
+        auto const formatted_integer = format( integer );
+
+        stream.put( formatted_integer.begin(), formatted_integer.end() );
+
+        return formatted_integer.size();
+    }
+
+  private:
+    /**
+     * \brief The number of bits in a nibble.
+     */
+    static constexpr auto NIBBLE_DIGITS = 4;
+
+    /**
+     * \brief The largest value a nibble can hold.
+     */
+    static constexpr auto NIBBLE_MAX = std::uint_fast8_t{ 0xF };
+
+    /**
+     * \brief The number of bits in a byte.
+     */
+    static constexpr auto BYTE_DIGITS = std::numeric_limits<std::uint8_t>::digits;
+
+    /**
+     * \brief The number of nibbles in an unsigned integer.
+     */
+    static constexpr auto NIBBLES = std::numeric_limits<std::make_unsigned_t<Integer>>::digits / NIBBLE_DIGITS;
+
+    /**
+     * \brief The number of bytes in an unsigned integer.
+     */
+    static constexpr auto BYTES = std::numeric_limits<std::make_unsigned_t<Integer>>::digits / BYTE_DIGITS;
+
+    /**
+     * \brief Formatted integer.
+     */
+    using Formatted_Integer = Array<char, 2 + NIBBLES>;
+
+    /**
+     * \brief Format an integer.
+     *
+     * \param[in] integer The integer to format.
+     *
+     * \return The formatted integer.
+     */
+    static constexpr auto format( Integer integer ) noexcept -> Formatted_Integer
+    {
+        auto unsigned_integer = to_unsigned( integer );
+
+        Formatted_Integer formatted_integer;
+
+        auto i = formatted_integer.rbegin();
+        for ( auto byte = 0; byte < BYTES; ++byte ) {
+            auto const b = static_cast<std::uint8_t>( unsigned_integer );
+
+            *i = Format::HEX_DIGIT_LOOKUP_TABLE[ b & NIBBLE_MAX ];
+            ++i;
+            *i = Format::HEX_DIGIT_LOOKUP_TABLE[ b >> NIBBLE_DIGITS ];
+            ++i;
+
+            unsigned_integer >>= BYTE_DIGITS;
+        } // for
+        *i = 'x';
+        ++i;
+        *i = '0';
+
+        return formatted_integer;
+    }
+};
+
+/**
+ * \brief picolibrary::Format::Hex_Dump output formatter.
+ *
+ * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam ROWS_PER_PUT The maximum number of rows to write to the stream with a single
+ *         put.
+ */
+template<typename Iterator, std::size_t ROWS_PER_PUT>
+class Output_Formatter<Format::Hex_Dump<Iterator, ROWS_PER_PUT>> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
+
+    /**
+     * \brief Write the formatted picolibrary::Format::Hex_Dump to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Hex_Dump
+     *            to.
+     * \param[in] hex_dump The picolibrary::Format::Hex_Dump to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    // NOLINTNEXTLINE(readability-function-size)
+    auto print( Output_Stream & stream, Format::Hex_Dump<Iterator, ROWS_PER_PUT> const & hex_dump ) const noexcept
+        -> Result<std::size_t>
+    {
+        Rows rows;
+
+        auto begin         = hex_dump.begin();
+        auto end           = hex_dump.end();
+        auto memory_offset = std::size_t{ 0 };
+        auto n             = std::size_t{ 0 };
+
+        while ( begin != end ) {
+            auto const rows_end = generate_rows( memory_offset, begin, end, rows );
+
+            auto result = stream.put( rows.begin(), rows_end );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            n += rows_end - rows.begin();
+        } // while
+
+        return n;
+    }
+
+    /**
+     * \brief Write the formatted picolibrary::Format::Hex_Dump to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Hex_Dump
+     *            to.
+     * \param[in] hex_dump The picolibrary::Format::Hex_Dump to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    auto print( Reliable_Output_Stream & stream, Format::Hex_Dump<Iterator, ROWS_PER_PUT> const & hex_dump ) const noexcept
+        -> std::size_t
+    {
+        Rows rows;
+
+        auto begin         = hex_dump.begin();
+        auto end           = hex_dump.end();
+        auto memory_offset = std::size_t{ 0 };
+        auto n             = std::size_t{ 0 };
+
+        while ( begin != end ) {
+            auto const rows_end = generate_rows( memory_offset, begin, end, rows );
+
+            stream.put( rows.begin(), rows_end );
+
+            n += rows_end - rows.begin();
+        } // while
+
+        return n;
+    }
+
+  private:
+    /**
+     * \brief The number of bits in a nibble.
+     */
+    static constexpr auto NIBBLE_DIGITS = std::uint_fast8_t{ 4 };
+
+    /**
+     * \brief Nibble bit mask.
+     */
+    static constexpr auto NIBBLE_MASK = mask<std::uint_fast8_t>( NIBBLE_DIGITS, 0 );
+
+    /**
+     * \brief The number of nibbles in a memory offset.
+     */
+    static constexpr auto MEMORY_OFFSET_NIBBLES = std::uint_fast8_t{
+        std::numeric_limits<std::size_t>::digits / NIBBLE_DIGITS
+    };
+
+    /**
+     * \brief The number of nibbles in a byte.
+     */
+    static constexpr auto BYTE_NIBBLES = std::uint_fast8_t{ std::numeric_limits<std::uint8_t>::digits
+                                                            / NIBBLE_DIGITS };
+
+    /**
+     * \brief Group separation spaces.
+     */
+    static constexpr auto GROUP_SEPARATION = std::uint_fast8_t{ 2 };
+
+    /**
+     * \brief The number of bytes in a row.
+     */
+    static constexpr auto ROW_BYTES = std::uint_fast8_t{ 16 };
+
+    /**
+     * \brief Row buffer memory offset (hex) offset.
+     */
+    static constexpr auto MEMORY_OFFSET_HEX_OFFSET = std::uint_fast8_t{ 0 };
+
+    /**
+     * \brief Row buffer data (hex) offset.
+     */
+    static constexpr auto DATA_HEX_OFFSET = std::uint_fast8_t{ MEMORY_OFFSET_HEX_OFFSET + MEMORY_OFFSET_NIBBLES
+                                                               + GROUP_SEPARATION };
+
+    /**
+     * \brief Row buffer data (ASCII) offset.
+     */
+    static constexpr auto DATA_ASCII_OFFSET = std::uint_fast8_t{
+        DATA_HEX_OFFSET + ( ( ( BYTE_NIBBLES + 1 ) * ROW_BYTES ) - 1 ) + GROUP_SEPARATION + 1
+    };
+
+    /**
+     * \brief The number of characters in a row.
+     */
+    static constexpr auto ROW_SIZE = std::size_t{ MEMORY_OFFSET_NIBBLES + GROUP_SEPARATION
+                                                  + ( ( ( BYTE_NIBBLES + 1 ) * ROW_BYTES ) - 1 )
+                                                  + GROUP_SEPARATION + 1 + ROW_BYTES + 1 + 1 };
+
+    /**
+     * \brief Rows buffer.
+     */
+    using Rows = Array<char, ROW_SIZE * ROWS_PER_PUT>;
+
+    /**
+     * \brief Format a memory offset (hex).
+     *
+     * \param[in] memory_offset The memory offset to format.
+     * \param[out] location The location to write the formatted memory offset to.
+     */
+    static void format_hex( std::size_t memory_offset, typename Rows::Iterator location ) noexcept
+    {
+        auto i = typename Rows::Reverse_Iterator{ location + MEMORY_OFFSET_NIBBLES };
+        for ( auto byte = std::uint_fast8_t{ 0 }; byte < MEMORY_OFFSET_NIBBLES / BYTE_NIBBLES; ++byte ) {
+            auto const b = static_cast<std::uint8_t>( memory_offset );
+
+            *i = Format::HEX_DIGIT_LOOKUP_TABLE[ b & NIBBLE_MASK ];
+            ++i;
+            *i = Format::HEX_DIGIT_LOOKUP_TABLE[ b >> NIBBLE_DIGITS ];
+            ++i;
+
+            memory_offset >>= NIBBLE_DIGITS * BYTE_NIBBLES;
+        } // for
+    }
+
+    /**
+     * \brief Format a byte (hex).
+     *
+     * \param[in] byte The byte to format.
+     * \param[out] location The location to write the formatted byte to.
+     */
+    static void format_hex( std::uint8_t byte, typename Rows::Iterator location ) noexcept
+    {
+        location[ 0 ] = Format::HEX_DIGIT_LOOKUP_TABLE[ byte >> NIBBLE_DIGITS ];
+        location[ 1 ] = Format::HEX_DIGIT_LOOKUP_TABLE[ byte & NIBBLE_MASK ];
+    }
+
+    /**
+     * \brief Format a byte (ASCII).
+     *
+     * \param[in] byte The byte to format.
+     * \param[out] location The location to write the formatted byte to.
+     */
+    static void format_ascii( std::uint8_t byte, typename Rows::Iterator location ) noexcept
+    {
+        *location = byte >= ' ' and byte <= '~' ? static_cast<char>( byte ) : '.';
+    }
+
+    /**
+     * \brief Generate a row.
+     *
+     * \param[in] memory_offset The row's memory offset.
+     * \param[in] begin The beginning of the data.
+     * \param[in] end The end of the data.
+     * \param[out] row The location to write the generated row to.
+     *
+     * \return The beginning of the remaining data.
+     */
+    static auto generate_row( std::size_t memory_offset, Iterator begin, Iterator end, typename Rows::Iterator row ) noexcept
+        -> Iterator
+    {
+        fill( row + MEMORY_OFFSET_NIBBLES, row + ROW_SIZE - 1, ' ' );
+
+        row[ ROW_SIZE - 1 ] = '\n';
+
+        row[ DATA_ASCII_OFFSET - 1 ] = '|';
+
+        format_hex( memory_offset, row + MEMORY_OFFSET_HEX_OFFSET );
+
+        auto byte = std::uint_fast8_t{ 0 };
+        for ( ; begin != end and byte < ROW_BYTES; ++begin, ++byte ) {
+            format_hex(
+                static_cast<std::uint8_t>( *begin ), row + DATA_HEX_OFFSET + ( ( BYTE_NIBBLES + 1 ) * byte ) );
+
+            format_ascii( static_cast<std::uint8_t>( *begin ), row + DATA_ASCII_OFFSET + byte );
+        } // for
+        row[ DATA_ASCII_OFFSET + byte ] = '|';
+
+        return begin;
+    }
+
+    /**
+     * \brief Generate as many rows as will fit in the rows buffer.
+     *
+     * \param[in,out] memory_offset The first row's memory offset. Updated to the memory
+     *                offset of the row following the last generated row.
+     * \param[in,out] begin The beginning of the data. Updated to the beginning of the
+     *                remaining data.
+     * \param[in] end The end of the data.
+     * \param[out] rows The rows buffer to write the generated rows to.
+     *
+     * \return The end of the generated rows.
+     */
+    static auto generate_rows( std::size_t & memory_offset, Iterator & begin, Iterator end, Rows & rows ) noexcept
+        -> typename Rows::Iterator
+    {
+        auto row = rows.begin();
+        for ( ; begin != end and row != rows.end(); row += ROW_SIZE, memory_offset += ROW_BYTES ) {
+            begin = generate_row( memory_offset, begin, end, row );
+        } // for
+
+        return row;
+    }
+};
+
+/**
+ * \brief picolibrary::Format::Base16 output formatter.
+ *
+ * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam BYTES_PER_PUT The maximum number of bytes to encode and write to the stream
+ *         with a single put.
+ */
+template<typename Iterator, std::size_t BYTES_PER_PUT>
+class Output_Formatter<Format::Base16<Iterator, BYTES_PER_PUT>> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
+
+    /**
+     * \brief Write the formatted picolibrary::Format::Base16 to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Base16 to.
+     * \param[in] base16 The picolibrary::Format::Base16 to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto print( Output_Stream & stream, Format::Base16<Iterator, BYTES_PER_PUT> const & base16 ) const noexcept
+        -> Result<std::size_t>
+    {
+        Buffer buffer;
+
+        auto begin = base16.begin();
+        auto end   = base16.end();
+        auto n     = std::size_t{ 0 };
+
+        while ( begin != end ) {
+            auto const buffer_end = encode( begin, end, buffer );
+
+            auto result = stream.put( buffer.begin(), buffer_end );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            n += buffer_end - buffer.begin();
+        } // while
+
+        return n;
+    }
+
+    /**
+     * \brief Write the formatted picolibrary::Format::Base16 to the stream.
      *
-     * \return The beginning of the remaining data.
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Base16 to.
+     * \param[in] base16 The picolibrary::Format::Base16 to format.
+     *
+     * \return The number of characters written to the stream.
      */
-    static auto generate_row( std::size_t memory_offset, Iterator begin, Iterator end, Row & row ) noexcept
-        -> Iterator
+    auto print( Reliable_Output_Stream & stream, Format::Base16<Iterator, BYTES_PER_PUT> const & base16 ) const noexcept
+        -> std::size_t
     {
-        fill( row.begin() + MEMORY_OFFSET_NIBBLES, row.end() - 1, ' ' );
+        Buffer buffer;
 
-        row.back() = '\n';
+        auto begin = base16.begin();
+        auto end   = base16.end();
+        auto n     = std::size_t{ 0 };
 
-        *( row.begin() + DATA_ASCII_OFFSET - 1 ) = '|';
+        while ( begin != end ) {
+            auto const buffer_end = encode( begin, end, buffer );
 
-        format_hex( memory_offset, row.begin() + MEMORY_OFFSET_HEX_OFFSET );
+            stream.put( buffer.begin(), buffer_end );
 
-        auto byte = std::uint_fast8_t{ 0 };
-        for ( ; begin != end and byte < ROW_BYTES; ++begin, ++byte ) {
-            format_hex(
-                static_cast<std::uint8_t>( *begin ),
-                row.begin() + DATA_HEX_OFFSET + ( ( BYTE_NIBBLES + 1 ) * byte ) );
+            n += buffer_end - buffer.begin();
+        } // while
+
+        return n;
+    }
+
+  private:
+    /**
+     * \brief The maximum number of bytes to encode and write to the stream with a single
+     *        put.
+     */
+    static constexpr auto CHUNK_SIZE = std::size_t{ BYTES_PER_PUT };
+
+    /**
+     * \brief Encoding buffer.
+     */
+    using Buffer = Array<char, Text_Encoding::base16_encoded_size( CHUNK_SIZE )>;
 
-            format_ascii( static_cast<std::uint8_t>( *begin ), row.begin() + DATA_ASCII_OFFSET + byte );
+    /**
+     * \brief Encode as much data as will fit in the encoding buffer.
+     *
+     * \param[in,out] begin The beginning of the data. Updated to the beginning of the
+     *                remaining data.
+     * \param[in] end The end of the data.
+     * \param[out] buffer The encoding buffer to write the encoded data to.
+     *
+     * \return The end of the encoded data.
+     */
+    static auto encode( Iterator & begin, Iterator end, Buffer & buffer ) noexcept ->
+        typename Buffer::Iterator
+    {
+        auto chunk_end = begin;
+        for ( auto i = std::size_t{ 0 }; chunk_end != end and i < CHUNK_SIZE; ++i ) {
+            ++chunk_end;
         } // for
-        *( row.begin() + DATA_ASCII_OFFSET + byte ) = '|';
 
-        return begin;
+        auto const buffer_end = Text_Encoding::encode_base16( begin, chunk_end, buffer.begin() );
+
+        begin = chunk_end;
+
+        return buffer_end;
+    }
+};
+
+/**
+ * \brief picolibrary::Format::Base64 output formatter.
+ *
+ * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ * \tparam GROUPS_PER_PUT The maximum number of 3 byte groups to encode and write to the
+ *         stream with a single put.
+ */
+template<typename Iterator, std::size_t GROUPS_PER_PUT>
+class Output_Formatter<Format::Base64<Iterator, GROUPS_PER_PUT>> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
+
+    /**
+     * \brief Write the formatted picolibrary::Format::Base64 to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Base64 to.
+     * \param[in] base64 The picolibrary::Format::Base64 to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto print( Output_Stream & stream, Format::Base64<Iterator, GROUPS_PER_PUT> const & base64 ) const noexcept
+        -> Result<std::size_t>
+    {
+        Buffer buffer;
+
+        auto begin = base64.begin();
+        auto end   = base64.end();
+        auto n     = std::size_t{ 0 };
+
+        while ( begin != end ) {
+            auto const buffer_end = encode( begin, end, buffer );
+
+            auto result = stream.put( buffer.begin(), buffer_end );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            n += buffer_end - buffer.begin();
+        } // while
+
+        return n;
+    }
+
+    /**
+     * \brief Write the formatted picolibrary::Format::Base64 to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::Base64 to.
+     * \param[in] base64 The picolibrary::Format::Base64 to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    auto print( Reliable_Output_Stream & stream, Format::Base64<Iterator, GROUPS_PER_PUT> const & base64 ) const noexcept
+        -> std::size_t
+    {
+        Buffer buffer;
+
+        auto begin = base64.begin();
+        auto end   = base64.end();
+        auto n     = std::size_t{ 0 };
+
+        while ( begin != end ) {
+            auto const buffer_end = encode( begin, end, buffer );
+
+            stream.put( buffer.begin(), buffer_end );
+
+            n += buffer_end - buffer.begin();
+        } // while
+
+        return n;
+    }
+
+  private:
+    /**
+     * \brief The maximum number of bytes to encode and write to the stream with a single
+     *        put.
+     */
+    static constexpr auto CHUNK_SIZE = std::size_t{ GROUPS_PER_PUT * 3 };
+
+    /**
+     * \brief Encoding buffer.
+     */
+    using Buffer = Array<char, Text_Encoding::base64_encoded_size( CHUNK_SIZE )>;
+
+    /**
+     * \brief Encode as much data as will fit in the encoding buffer.
+     *
+     * \param[in,out] begin The beginning of the data. Updated to the beginning of the
+     *                remaining data.
+     * \param[in] end The end of the data.
+     * \param[out] buffer The encoding buffer to write the encoded data to.
+     *
+     * \return The end of the encoded data.
+     */
+    static auto encode( Iterator & begin, Iterator end, Buffer & buffer ) noexcept ->
+        typename Buffer::Iterator
+    {
+        auto chunk_end = begin;
+        for ( auto i = std::size_t{ 0 }; chunk_end != end and i < CHUNK_SIZE; ++i ) {
+            ++chunk_end;
+        } // for
+
+        auto const buffer_end = Text_Encoding::encode_base64( begin, chunk_end, buffer.begin() );
+
+        begin = chunk_end;
+
+        return buffer_end;
+    }
+};
+
+/**
+ * \brief picolibrary::Format::String output formatter.
+ *
+ * \tparam Source The format string source.
+ * \tparam Types The types of the values to format.
+ */
+template<typename Source, typename... Types>
+class Output_Formatter<Format::String<Source, Types...>> {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Output_Formatter( Output_Formatter && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Output_Formatter( Output_Formatter const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Output_Formatter() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Output_Formatter && expression ) noexcept -> Output_Formatter & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator   =( Output_Formatter const & expression ) noexcept
+        -> Output_Formatter & = default;
+
+    /**
+     * \brief Write the formatted picolibrary::Format::String to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::String to.
+     * \param[in] string The picolibrary::Format::String to format.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto print( Output_Stream & stream, Format::String<Source, Types...> const & string ) const noexcept
+        -> Result<std::size_t>
+    {
+        return print<0, 0>( stream, string.values(), 0 );
+    }
+
+    /**
+     * \brief Write the formatted picolibrary::Format::String to the stream.
+     *
+     * \param[in] stream The stream to write the formatted picolibrary::Format::String to.
+     * \param[in] string The picolibrary::Format::String to format.
+     *
+     * \return The number of characters written to the stream.
+     */
+    auto print( Reliable_Output_Stream & stream, Format::String<Source, Types...> const & string ) const noexcept
+        -> std::size_t
+    {
+        return print<0, 0>( stream, string.values(), 0 );
+    }
+
+  private:
+    /**
+     * \brief Format string.
+     */
+    using String = Format::String<Source, Types...>;
+
+    /**
+     * \brief Replacement field conversion.
+     */
+    using Conversion = typename String::Conversion;
+
+    /**
+     * \brief Format string analysis.
+     */
+    static constexpr auto ANALYSIS = String::analyze();
+
+    static_assert( ANALYSIS.is_valid, "malformed format string" );
+    static_assert(
+        ANALYSIS.replacement_fields == sizeof...( Types ),
+        "format string replacement field count does not match value count" );
+
+    /**
+     * \brief Format string literal character table.
+     */
+    static constexpr auto LITERAL_CHARACTERS = String::template literal_characters<ANALYSIS.literal_characters>();
+
+    /**
+     * \brief Format string fragment table.
+     */
+    static constexpr auto FRAGMENTS = String::template fragments<ANALYSIS.fragments>();
+
+    /**
+     * \brief Write a formatted value to a stream.
+     *
+     * \tparam CONVERSION The replacement field conversion to use to format the value.
+     * \tparam Stream The type of stream to write the formatted value to.
+     * \tparam T The type of value to format.
+     *
+     * \param[in] stream The stream to write the formatted value to.
+     * \param[in] value The value to format.
+     *
+     * \return The result of the value's output formatter's print.
+     */
+    template<Conversion CONVERSION, typename Stream, typename T>
+    static auto print_value( Stream & stream, T const & value ) noexcept
+    {
+        if constexpr ( CONVERSION == Conversion::DEFAULT ) {
+            return Output_Formatter<T>{}.print( stream, value );
+        } else {
+            static_assert( std::is_integral_v<T>, "format string conversion requires an integer" );
+
+            if constexpr ( CONVERSION == Conversion::BIN ) {
+                return Output_Formatter<Format::Bin<T>>{}.print( stream, value );
+            } else if constexpr ( CONVERSION == Conversion::DEC ) {
+                return Output_Formatter<Format::Dec<T>>{}.print( stream, value );
+            } else {
+                return Output_Formatter<Format::Hex<T>>{}.print( stream, value );
+            } // else
+        }     // else
+    }
+
+    /**
+     * \brief Write the formatted format string fragments to the stream.
+     *
+     * \tparam FRAGMENT The format string fragment to write.
+     * \tparam VALUE The value to use for the next replacement field.
+     *
+     * \param[in] stream The stream to write the formatted format string fragments to.
+     * \param[in] values The values to format.
+     * \param[in] n The number of characters that have been written to the stream.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    template<std::size_t FRAGMENT, std::size_t VALUE>
+    static auto print( Output_Stream & stream, std::tuple<Types...> const & values, std::size_t n ) noexcept
+        -> Result<std::size_t>
+    {
+        if constexpr ( FRAGMENT == FRAGMENTS.size() ) {
+            static_cast<void>( stream );
+            static_cast<void>( values );
+
+            return n;
+        } else if constexpr ( FRAGMENTS[ FRAGMENT ].is_literal ) {
+            constexpr auto fragment = FRAGMENTS[ FRAGMENT ];
+
+            auto result = stream.put(
+                LITERAL_CHARACTERS.begin() + fragment.begin, LITERAL_CHARACTERS.begin() + fragment.end );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            return print<FRAGMENT + 1, VALUE>( stream, values, n + ( fragment.end - fragment.begin ) );
+        } else {
+            auto result = print_value<FRAGMENTS[ FRAGMENT ].conversion>(
+                stream, std::get<VALUE>( values ) );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            return print<FRAGMENT + 1, VALUE + 1>( stream, values, n + result.value() );
+        } // else
+    }
+
+    /**
+     * \brief Write the formatted format string fragments to the stream.
+     *
+     * \tparam FRAGMENT The format string fragment to write.
+     * \tparam VALUE The value to use for the next replacement field.
+     *
+     * \param[in] stream The stream to write the formatted format string fragments to.
+     * \param[in] values The values to format.
+     * \param[in] n The number of characters that have been written to the stream.
+     *
+     * \return The number of characters written to the stream.
+     */
+    template<std::size_t FRAGMENT, std::size_t VALUE>
+    static auto print( Reliable_Output_Stream & stream, std::tuple<Types...> const & values, std::size_t n ) noexcept
+        -> std::size_t
+    {
+        if constexpr ( FRAGMENT == FRAGMENTS.size() ) {
+            static_cast<void>( stream );
+            static_cast<void>( values );
+
+            return n;
+        } else if constexpr ( FRAGMENTS[ FRAGMENT ].is_literal ) {
+            constexpr auto fragment = FRAGMENTS[ FRAGMENT ];
+
+            stream.put( LITERAL_CHARACTERS.begin() + fragment.begin, LITERAL_CHARACTERS.begin() + fragment.end );
+
+            return print<FRAGMENT + 1, VALUE>( stream, values, n + ( fragment.end - fragment.begin ) );
+        } else {
+            return print<FRAGMENT + 1, VALUE + 1>(
+                stream,
+                values,
+                n + print_value<FRAGMENTS[ FRAGMENT ].conversion>( stream, std::get<VALUE>( values ) ) );
+        } // else
     }
 };
 
@@ -0,0 +1,1081 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary framing interface.
+ */
+
+#ifndef PICOLIBRARY_FRAMING_H
+#define PICOLIBRARY_FRAMING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/array.h"
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Check if a circular buffer is written to by interrupts.
+ *
+ * \tparam Buffer The circular buffer to check.
+ */
+template<typename Buffer, typename = void>
+struct is_interrupt_written_circular_buffer : std::false_type {
+};
+
+/**
+ * \brief Check if a circular buffer is written to by interrupts.
+ *
+ * \tparam Buffer The circular buffer to check.
+ */
+template<typename Buffer>
+struct is_interrupt_written_circular_buffer<Buffer, std::void_t<decltype( std::declval<Buffer &>().push_from_interrupt( std::declval<typename Buffer::Value const &>() ) )>> :
+    std::true_type {
+};
+
+/**
+ * \brief Check if a circular buffer is written to by interrupts.
+ *
+ * \tparam Buffer The circular buffer to check.
+ */
+template<typename Buffer>
+inline constexpr auto is_interrupt_written_circular_buffer_v = is_interrupt_written_circular_buffer<Buffer>::value;
+
+/**
+ * \brief Write a decoded byte to a frame decoder's circular buffer.
+ *
+ * \tparam Buffer The type of circular buffer to write to. If the circular buffer is
+ *         written to by interrupts (picolibrary::is_interrupt_written_circular_buffer),
+ *         the circular buffer's interrupt write functions are used.
+ *
+ * \param[in] buffer The circular buffer to write to.
+ * \param[in] data The decoded byte to write to the circular buffer.
+ *
+ * \return true if the decoded byte was written to the circular buffer.
+ * \return false if the circular buffer is full.
+ */
+template<typename Buffer>
+auto push_decoded_byte( Buffer & buffer, std::uint8_t data ) noexcept -> bool
+{
+    if constexpr ( is_interrupt_written_circular_buffer_v<Buffer> ) {
+        if ( buffer.full_from_interrupt() ) {
+            return false;
+        } // if
+
+        buffer.push_from_interrupt( data );
+    } else {
+        if ( buffer.full() ) {
+            return false;
+        } // if
+
+        buffer.push( data );
+    } // else
+
+    return true;
+}
+
+/**
+ * \brief Write data to a framing encoder's downstream buffer.
+ *
+ * \tparam Buffer The type of downstream buffer to write to. If the downstream buffer is
+ *         a picolibrary::Reliable_Stream_Buffer, the write cannot fail.
+ * \tparam Data The types of the data to write to the downstream buffer.
+ *
+ * \param[in] buffer The downstream buffer to write to.
+ * \param[in] data The data to write to the downstream buffer.
+ *
+ * \return Nothing if the write succeeded.
+ * \return An error code if the write failed.
+ */
+template<typename Buffer, typename... Data>
+auto put_downstream( Buffer & buffer, Data... data ) noexcept -> Result<void>
+{
+    if constexpr ( std::is_base_of_v<Reliable_Stream_Buffer, Buffer> ) {
+        buffer.put( data... );
+
+        return {};
+    } else {
+        return buffer.put( data... );
+    } // else
+}
+
+/**
+ * \brief Flush a framing encoder's downstream buffer.
+ *
+ * \tparam Buffer The type of downstream buffer to flush. If the downstream buffer is a
+ *         picolibrary::Reliable_Stream_Buffer, the flush cannot fail.
+ *
+ * \param[in] buffer The downstream buffer to flush.
+ *
+ * \return Nothing if the flush succeeded.
+ * \return An error code if the flush failed.
+ */
+template<typename Buffer>
+auto flush_downstream( Buffer & buffer ) noexcept -> Result<void>
+{
+    if constexpr ( std::is_base_of_v<Reliable_Stream_Buffer, Buffer> ) {
+        buffer.flush();
+
+        return {};
+    } else {
+        return buffer.flush();
+    } // else
+}
+
+/**
+ * \brief Check if a type is a framing encoder downstream buffer.
+ *
+ * \tparam Buffer The type to check.
+ */
+template<typename Buffer>
+inline constexpr auto is_framing_downstream_buffer_v = std::is_base_of_v<Stream_Buffer, Buffer>
+                                                       or std::is_base_of_v<Reliable_Stream_Buffer, Buffer>;
+
+/**
+ * \brief Consistent Overhead Byte Stuffing (COBS) encoder I/O stream device access
+ *        buffer.
+ *
+ * Data written to the buffer is COBS encoded as it is written, and then written to the
+ * downstream buffer one COBS block (at most 255 bytes) at a time. Flushing the buffer
+ * completes the frame that is being encoded, writes the frame delimiter (0x00) to the
+ * downstream buffer, and then flushes the downstream buffer. Flushing the buffer when no
+ * data has been written since the previous frame was completed only flushes the
+ * downstream buffer.
+ *
+ * \tparam Downstream_Buffer The type of downstream buffer to write encoded data to
+ *         (picolibrary::Stream_Buffer or picolibrary::Reliable_Stream_Buffer, or a type
+ *         derived from either). Downstream writes to a
+ *         picolibrary::Reliable_Stream_Buffer cannot fail.
+ */
+template<typename Downstream_Buffer>
+class Basic_COBS_Encoder_Stream_Buffer final : public Stream_Buffer {
+  public:
+    static_assert( is_framing_downstream_buffer_v<Downstream_Buffer> );
+
+    /**
+     * \brief The type of downstream buffer encoded data is written to.
+     */
+    using Downstream = Downstream_Buffer;
+
+    using Stream_Buffer::put;
+
+    Basic_COBS_Encoder_Stream_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The downstream buffer to write encoded data to.
+     */
+    constexpr Basic_COBS_Encoder_Stream_Buffer( Downstream & buffer ) noexcept :
+        m_buffer{ &buffer }
+    {
+    }
+
+    Basic_COBS_Encoder_Stream_Buffer( Basic_COBS_Encoder_Stream_Buffer && ) = delete;
+
+    Basic_COBS_Encoder_Stream_Buffer( Basic_COBS_Encoder_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Basic_COBS_Encoder_Stream_Buffer() noexcept = default;
+
+    auto operator=( Basic_COBS_Encoder_Stream_Buffer && ) = delete;
+
+    auto operator=( Basic_COBS_Encoder_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Write a character to the put area of the buffer.
+     *
+     * \param[in] character The character to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        return encode( static_cast<std::uint8_t>( character ) );
+    }
+
+    /**
+     * \brief Write an unsigned byte to the put area of the buffer.
+     *
+     * \param[in] value The unsigned byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void> override final
+    {
+        return encode( value );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of unsigned bytes to write to the put area of
+     *            the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void> override final
+    {
+        for ( ; begin != end; ++begin ) {
+            auto result = encode( *begin );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // for
+
+        return {};
+    }
+
+    /**
+     * \brief Write a signed byte to the put area of the buffer.
+     *
+     * \param[in] value The signed byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void> override final
+    {
+        return encode( static_cast<std::uint8_t>( value ) );
+    }
+
+    /**
+     * \brief Complete the frame that is being encoded, and flush the downstream buffer.
+     *
+     * \return Nothing if the flush succeeded.
+     * \return An error code if the flush failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        if ( m_frame_started ) {
+            m_frame_started = false;
+
+            if ( not m_block_implicit ) {
+                auto result = write_block();
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            }     // if
+
+            m_block_implicit = false;
+
+            auto result = put_downstream( *m_buffer, std::uint8_t{ 0x00 } );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // if
+
+        return flush_downstream( *m_buffer );
+    }
+
+  private:
+    /**
+     * \brief The maximum number of data bytes in a COBS block.
+     */
+    static constexpr auto BLOCK_SIZE_MAX = std::size_t{ 254 };
+
+    /**
+     * \brief The downstream buffer to write encoded data to.
+     */
+    Downstream * m_buffer;
+
+    /**
+     * \brief The data bytes of the block that is being encoded.
+     */
+    Array<std::uint8_t, BLOCK_SIZE_MAX> m_block{};
+
+    /**
+     * \brief The number of data bytes in the block that is being encoded.
+     */
+    std::size_t m_size{};
+
+    /**
+     * \brief The frame that is being encoded has been started.
+     */
+    bool m_frame_started{};
+
+    /**
+     * \brief The block that is being encoded is empty and follows a maximum length
+     *        block, so it does not need to be written if the frame is completed.
+     */
+    bool m_block_implicit{};
+
+    /**
+     * \brief Encode a byte.
+     *
+     * \param[in] data The byte to encode.
+     *
+     * \return Nothing if encoding the byte succeeded.
+     * \return An error code if encoding the byte failed.
+     */
+    auto encode( std::uint8_t data ) noexcept -> Result<void>
+    {
+        m_frame_started  = true;
+        m_block_implicit = false;
+
+        if ( not data ) {
+            return write_block();
+        } // if
+
+        m_block[ m_size ] = data;
+        ++m_size;
+
+        if ( m_size == BLOCK_SIZE_MAX ) {
+            m_block_implicit = true;
+
+            return write_block();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write the block that is being encoded to the downstream buffer.
+     *
+     * \return Nothing if writing the block succeeded.
+     * \return An error code if writing the block failed.
+     */
+    auto write_block() noexcept -> Result<void>
+    {
+        auto const size = m_size;
+
+        m_size = 0;
+
+        {
+            auto result = put_downstream( *m_buffer, static_cast<std::uint8_t>( size + 1 ) );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }
+
+        return put_downstream( *m_buffer, m_block.begin(), m_block.begin() + size );
+    }
+};
+
+/**
+ * \brief COBS encoder I/O stream device access buffer that writes to a
+ *        picolibrary::Stream_Buffer.
+ */
+using COBS_Encoder_Stream_Buffer = Basic_COBS_Encoder_Stream_Buffer<Stream_Buffer>;
+
+/**
+ * \brief COBS encoder I/O stream device access buffer that writes to a
+ *        picolibrary::Reliable_Stream_Buffer.
+ */
+using Reliable_COBS_Encoder_Stream_Buffer = Basic_COBS_Encoder_Stream_Buffer<Reliable_Stream_Buffer>;
+
+/**
+ * \brief Consistent Overhead Byte Stuffing (COBS) decoder.
+ *
+ * Encoded data is fed to the decoder one byte at a time (e.g. from a receive interrupt),
+ * and the decoded data is written to a receive-side circular buffer as it is decoded.
+ * Empty frames between consecutive frame delimiters are ignored.
+ *
+ * \tparam Buffer The type of circular buffer to write decoded data to (must be a
+ *         picolibrary::Circular_Buffer with an element type of std::uint8_t).
+ */
+template<typename Buffer>
+class COBS_Decoder {
+  public:
+    static_assert( std::is_same_v<typename Buffer::Value, std::uint8_t> );
+
+    COBS_Decoder() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The circular buffer to write decoded data to.
+     */
+    constexpr COBS_Decoder( Buffer & buffer ) noexcept : m_buffer{ &buffer }
+    {
+    }
+
+    COBS_Decoder( COBS_Decoder && ) = delete;
+
+    COBS_Decoder( COBS_Decoder const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~COBS_Decoder() noexcept = default;
+
+    auto operator=( COBS_Decoder && ) = delete;
+
+    auto operator=( COBS_Decoder const & ) = delete;
+
+    /**
+     * \brief Get the number of decoded bytes that were written to the circular buffer for
+     *        the most recently completed or abandoned frame.
+     *
+     * \return The number of decoded bytes that were written to the circular buffer for the
+     *         most recently completed or abandoned frame.
+     */
+    constexpr auto frame_size() const noexcept -> std::size_t
+    {
+        return m_frame_size;
+    }
+
+    /**
+     * \brief Decode a byte.
+     *
+     * \param[in] data The byte to decode.
+     *
+     * \return true if the byte completed a frame.
+     * \return false if the byte did not complete a frame.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the circular buffer is
+     *         full. The remainder of the frame is discarded.
+     * \return picolibrary::Generic_Error::RUNTIME_ERROR if the frame is malformed.
+     *
+     * \attention If an error is reported, the picolibrary::COBS_Decoder::frame_size()
+     *            decoded bytes of the abandoned frame that were written to the circular
+     *            buffer must be discarded by the reader.
+     */
+    auto decode( std::uint8_t data ) noexcept -> Result<bool>
+    {
+        if ( not data ) {
+            if ( m_discarding ) {
+                m_discarding = false;
+
+                return false;
+            } // if
+
+            if ( not m_frame_started ) {
+                return false;
+            } // if
+
+            if ( m_remaining ) {
+                abandon();
+
+                return Generic_Error::RUNTIME_ERROR;
+            } // if
+
+            m_frame_size = m_size;
+            reset();
+
+            return true;
+        } // if
+
+        if ( m_discarding ) {
+            return false;
+        } // if
+
+        m_frame_started = true;
+
+        if ( not m_remaining ) {
+            if ( m_implicit_zero and not push( 0x00 ) ) {
+                abandon();
+                m_discarding = true;
+
+                return Generic_Error::INSUFFICIENT_CAPACITY;
+            } // if
+
+            m_remaining     = static_cast<std::uint_fast8_t>( data - 1 );
+            m_implicit_zero = data != 0xFF;
+
+            return false;
+        } // if
+
+        if ( not push( data ) ) {
+            abandon();
+            m_discarding = true;
+
+            return Generic_Error::INSUFFICIENT_CAPACITY;
+        } // if
+
+        --m_remaining;
+
+        return false;
+    }
+
+  private:
+    /**
+     * \brief The circular buffer to write decoded data to.
+     */
+    Buffer * m_buffer;
+
+    /**
+     * \brief The number of data bytes remaining in the block that is being decoded.
+     */
+    std::uint_fast8_t m_remaining{};
+
+    /**
+     * \brief The block that is being decoded is followed by an implicit zero if another
+     *        block follows it.
+     */
+    bool m_implicit_zero{};
+
+    /**
+     * \brief The frame that is being decoded has been started.
+     */
+    bool m_frame_started{};
+
+    /**
+     * \brief The remainder of the frame that is being decoded is being discarded.
+     */
+    bool m_discarding{};
+
+    /**
+     * \brief The number of decoded bytes that have been written to the circular buffer
+     *        for the frame that is being decoded.
+     */
+    std::size_t m_size{};
+
+    /**
+     * \brief The number of decoded bytes that were written to the circular buffer for the
+     *        most recently completed or abandoned frame.
+     */
+    std::size_t m_frame_size{};
+
+    /**
+     * \brief Write a decoded byte to the circular buffer.
+     *
+     * \param[in] data The decoded byte to write to the circular buffer.
+     *
+     * \return true if the decoded byte was written to the circular buffer.
+     * \return false if the circular buffer is full.
+     */
+    auto push( std::uint8_t data ) noexcept -> bool
+    {
+        if ( not push_decoded_byte( *m_buffer, data ) ) {
+            return false;
+        } // if
+
+        ++m_size;
+
+        return true;
+    }
+
+    /**
+     * \brief Abandon the frame that is being decoded.
+     */
+    void abandon() noexcept
+    {
+        m_frame_size = m_size;
+        reset();
+    }
+
+    /**
+     * \brief Reset the frame decoding state.
+     */
+    void reset() noexcept
+    {
+        m_remaining     = 0;
+        m_implicit_zero = false;
+        m_frame_started = false;
+        m_size          = 0;
+    }
+};
+
+/**
+ * \brief Serial Line Internet Protocol (SLIP, RFC 1055) encoder I/O stream device access
+ *        buffer.
+ *
+ * Data written to the buffer is SLIP escaped into a small local chunk as it is written,
+ * and each chunk is written to the downstream buffer with a single block write. Flushing
+ * the buffer completes the frame that is being encoded, writes the frame delimiter (0xC0)
+ * to the downstream buffer, and then flushes the downstream buffer. Flushing the buffer
+ * when no data has been written since the previous frame was completed only flushes the
+ * downstream buffer.
+ *
+ * \tparam Downstream_Buffer The type of downstream buffer to write encoded data to
+ *         (picolibrary::Stream_Buffer or picolibrary::Reliable_Stream_Buffer, or a type
+ *         derived from either). Downstream writes to a
+ *         picolibrary::Reliable_Stream_Buffer cannot fail.
+ */
+template<typename Downstream_Buffer>
+class Basic_SLIP_Encoder_Stream_Buffer final : public Stream_Buffer {
+  public:
+    static_assert( is_framing_downstream_buffer_v<Downstream_Buffer> );
+
+    /**
+     * \brief The type of downstream buffer encoded data is written to.
+     */
+    using Downstream = Downstream_Buffer;
+
+    /**
+     * \brief Frame delimiter.
+     */
+    static constexpr auto END = std::uint8_t{ 0xC0 };
+
+    /**
+     * \brief Escape.
+     */
+    static constexpr auto ESC = std::uint8_t{ 0xDB };
+
+    /**
+     * \brief Escaped frame delimiter.
+     */
+    static constexpr auto ESC_END = std::uint8_t{ 0xDC };
+
+    /**
+     * \brief Escaped escape.
+     */
+    static constexpr auto ESC_ESC = std::uint8_t{ 0xDD };
+
+    using Stream_Buffer::put;
+
+    Basic_SLIP_Encoder_Stream_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The downstream buffer to write encoded data to.
+     */
+    constexpr Basic_SLIP_Encoder_Stream_Buffer( Downstream & buffer ) noexcept :
+        m_buffer{ &buffer }
+    {
+    }
+
+    Basic_SLIP_Encoder_Stream_Buffer( Basic_SLIP_Encoder_Stream_Buffer && ) = delete;
+
+    Basic_SLIP_Encoder_Stream_Buffer( Basic_SLIP_Encoder_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Basic_SLIP_Encoder_Stream_Buffer() noexcept = default;
+
+    auto operator=( Basic_SLIP_Encoder_Stream_Buffer && ) = delete;
+
+    auto operator=( Basic_SLIP_Encoder_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Write a character to the put area of the buffer.
+     *
+     * \param[in] character The character to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        return encode( &character, &character + 1 );
+    }
+
+    /**
+     * \brief Write a block of characters to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the put area
+     *            of the buffer.
+     * \param[in] end The end of the block of characters to write to the put area of the
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final
+    {
+        return encode( begin, end );
+    }
+
+    /**
+     * \brief Write an unsigned byte to the put area of the buffer.
+     *
+     * \param[in] value The unsigned byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void> override final
+    {
+        return encode( &value, &value + 1 );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of unsigned bytes to write to the put area of
+     *            the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void> override final
+    {
+        return encode( begin, end );
+    }
+
+    /**
+     * \brief Write a signed byte to the put area of the buffer.
+     *
+     * \param[in] value The signed byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void> override final
+    {
+        return encode( &value, &value + 1 );
+    }
+
+    /**
+     * \brief Write a block of signed bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of signed bytes to write to the put area of the
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t const * begin, std::int8_t const * end ) noexcept -> Result<void> override final
+    {
+        return encode( begin, end );
+    }
+
+    /**
+     * \brief Complete the frame that is being encoded, and flush the downstream buffer.
+     *
+     * \return Nothing if the flush succeeded.
+     * \return An error code if the flush failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        if ( m_frame_started ) {
+            m_frame_started = false;
+
+            auto result = put_downstream( *m_buffer, END );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // if
+
+        return flush_downstream( *m_buffer );
+    }
+
+  private:
+    /**
+     * \brief The size of the chunk that escaped data is accumulated in before it is
+     *        written to the downstream buffer.
+     */
+    static constexpr auto CHUNK_SIZE = std::size_t{ 32 };
+
+    /**
+     * \brief The downstream buffer to write encoded data to.
+     */
+    Downstream * m_buffer;
+
+    /**
+     * \brief The frame that is being encoded has been started.
+     */
+    bool m_frame_started{};
+
+    /**
+     * \brief Encode a block of bytes.
+     *
+     * Escaped data is accumulated in a local chunk, and the chunk is written to the
+     * downstream buffer when it is full and once the block has been encoded, so the
+     * downstream buffer is written to once per chunk instead of once per byte.
+     *
+     * \tparam Byte The type of byte to encode.
+     *
+     * \param[in] begin The beginning of the block of bytes to encode.
+     * \param[in] end The end of the block of bytes to encode.
+     *
+     * \return Nothing if encoding the block of bytes succeeded.
+     * \return An error code if encoding the block of bytes failed.
+     */
+    template<typename Byte>
+    auto encode( Byte const * begin, Byte const * end ) noexcept -> Result<void>
+    {
+        if ( begin == end ) {
+            return {};
+        } // if
+
+        m_frame_started = true;
+
+        auto chunk = Array<std::uint8_t, CHUNK_SIZE>{};
+        auto size  = std::size_t{ 0 };
+
+        for ( ; begin != end; ++begin ) {
+            auto const data = static_cast<std::uint8_t>( *begin );
+
+            switch ( data ) {
+                case END:
+                    chunk[ size++ ] = ESC;
+                    chunk[ size++ ] = ESC_END;
+                    break;
+                case ESC:
+                    chunk[ size++ ] = ESC;
+                    chunk[ size++ ] = ESC_ESC;
+                    break;
+                default: chunk[ size++ ] = data; break;
+            } // switch
+
+            if ( size > CHUNK_SIZE - 2 ) {
+                auto result = put_downstream( *m_buffer, chunk.begin(), chunk.begin() + size );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+
+                size = 0;
+            } // if
+        }     // for
+
+        if ( not size ) {
+            return {};
+        } // if
+
+        return put_downstream( *m_buffer, chunk.begin(), chunk.begin() + size );
+    }
+};
+
+/**
+ * \brief SLIP encoder I/O stream device access buffer that writes to a
+ *        picolibrary::Stream_Buffer.
+ */
+using SLIP_Encoder_Stream_Buffer = Basic_SLIP_Encoder_Stream_Buffer<Stream_Buffer>;
+
+/**
+ * \brief SLIP encoder I/O stream device access buffer that writes to a
+ *        picolibrary::Reliable_Stream_Buffer.
+ */
+using Reliable_SLIP_Encoder_Stream_Buffer = Basic_SLIP_Encoder_Stream_Buffer<Reliable_Stream_Buffer>;
+
+/**
+ * \brief Serial Line Internet Protocol (SLIP, RFC 1055) decoder.
+ *
+ * Encoded data is fed to the decoder one byte at a time (e.g. from a receive interrupt),
+ * and the decoded data is written to a receive-side circular buffer as it is decoded.
+ * Empty frames between consecutive frame delimiters are ignored.
+ *
+ * \tparam Buffer The type of circular buffer to write decoded data to (must be a
+ *         picolibrary::Circular_Buffer with an element type of std::uint8_t).
+ */
+template<typename Buffer>
+class SLIP_Decoder {
+  public:
+    static_assert( std::is_same_v<typename Buffer::Value, std::uint8_t> );
+
+    SLIP_Decoder() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The circular buffer to write decoded data to.
+     */
+    constexpr SLIP_Decoder( Buffer & buffer ) noexcept : m_buffer{ &buffer }
+    {
+    }
+
+    SLIP_Decoder( SLIP_Decoder && ) = delete;
+
+    SLIP_Decoder( SLIP_Decoder const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~SLIP_Decoder() noexcept = default;
+
+    auto operator=( SLIP_Decoder && ) = delete;
+
+    auto operator=( SLIP_Decoder const & ) = delete;
+
+    /**
+     * \brief Get the number of decoded bytes that were written to the circular buffer for
+     *        the most recently completed or abandoned frame.
+     *
+     * \return The number of decoded bytes that were written to the circular buffer for the
+     *         most recently completed or abandoned frame.
+     */
+    constexpr auto frame_size() const noexcept -> std::size_t
+    {
+        return m_frame_size;
+    }
+
+    /**
+     * \brief Decode a byte.
+     *
+     * \param[in] data The byte to decode.
+     *
+     * \return true if the byte completed a frame.
+     * \return false if the byte did not complete a frame.
+     * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if the circular buffer is
+     *         full. The remainder of the frame is discarded.
+     * \return picolibrary::Generic_Error::RUNTIME_ERROR if the frame contains an invalid
+     *         escape sequence. The remainder of the frame is discarded.
+     *
+     * \attention If an error is reported, the picolibrary::SLIP_Decoder::frame_size()
+     *            decoded bytes of the abandoned frame that were written to the circular
+     *            buffer must be discarded by the reader.
+     */
+    auto decode( std::uint8_t data ) noexcept -> Result<bool>
+    {
+        if ( data == SLIP_Encoder_Stream_Buffer::END ) {
+            if ( m_discarding ) {
+                m_discarding = false;
+
+                return false;
+            } // if
+
+            if ( m_escaping ) {
+                abandon();
+
+                return Generic_Error::RUNTIME_ERROR;
+            } // if
+
+            if ( not m_size ) {
+                return false;
+            } // if
+
+            m_frame_size = m_size;
+            m_size       = 0;
+
+            return true;
+        } // if
+
+        if ( m_discarding ) {
+            return false;
+        } // if
+
+        if ( m_escaping ) {
+            m_escaping = false;
+
+            switch ( data ) {
+                case SLIP_Encoder_Stream_Buffer::ESC_END:
+                    data = SLIP_Encoder_Stream_Buffer::END;
+                    break;
+                case SLIP_Encoder_Stream_Buffer::ESC_ESC:
+                    data = SLIP_Encoder_Stream_Buffer::ESC;
+                    break;
+                default:
+                    abandon();
+                    m_discarding = true;
+
+                    return Generic_Error::RUNTIME_ERROR;
+            } // switch
+        } else if ( data == SLIP_Encoder_Stream_Buffer::ESC ) {
+            m_escaping = true;
+
+            return false;
+        } // else if
+
+        if ( not push_decoded_byte( *m_buffer, data ) ) {
+            abandon();
+            m_discarding = true;
+
+            return Generic_Error::INSUFFICIENT_CAPACITY;
+        } // if
+
+        ++m_size;
+
+        return false;
+    }
+
+  private:
+    /**
+     * \brief The circular buffer to write decoded data to.
+     */
+    Buffer * m_buffer;
+
+    /**
+     * \brief The previous byte was an escape.
+     */
+    bool m_escaping{};
+
+    /**
+     * \brief The remainder of the frame that is being decoded is being discarded.
+     */
+    bool m_discarding{};
+
+    /**
+     * \brief The number of decoded bytes that have been written to the circular buffer
+     *        for the frame that is being decoded.
+     */
+    std::size_t m_size{};
+
+    /**
+     * \brief The number of decoded bytes that were written to the circular buffer for the
+     *        most recently completed or abandoned frame.
+     */
+    std::size_t m_frame_size{};
+
+    /**
+     * \brief Abandon the frame that is being decoded.
+     */
+    void abandon() noexcept
+    {
+        m_frame_size = m_size;
+        m_size       = 0;
+        m_escaping   = false;
+    }
+};
+
+/**
+ * \brief Framed output stream.
+ *
+ * \tparam Encoder The type of framing encoder I/O stream device access buffer the stream
+ *         will be associated with (picolibrary::Basic_COBS_Encoder_Stream_Buffer or
+ *         picolibrary::Basic_SLIP_Encoder_Stream_Buffer). Flushing the stream completes
+ *         the frame that is being encoded.
+ */
+template<typename Encoder>
+class Framed_Output_Stream : public Static_Output_Stream<Encoder> {
+  public:
+    Framed_Output_Stream() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The downstream buffer to write encoded data to.
+     */
+    Framed_Output_Stream( typename Encoder::Downstream & buffer ) noexcept :
+        m_encoder{ buffer }
+    {
+        this->set_buffer( &m_encoder );
+    }
+
+    Framed_Output_Stream( Framed_Output_Stream && ) = delete;
+
+    Framed_Output_Stream( Framed_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Framed_Output_Stream() noexcept = default;
+
+    auto operator=( Framed_Output_Stream && ) = delete;
+
+    auto operator=( Framed_Output_Stream const & ) = delete;
+
+  private:
+    /**
+     * \brief The stream's I/O stream device access buffer.
+     */
+    Encoder m_encoder;
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_FRAMING_H
@@ -28,11 +28,13 @@
 #include <type_traits>
 
 #include "picolibrary/algorithm.h"
+#include "picolibrary/array.h"
 #include "picolibrary/error.h"
 #include "picolibrary/event.h"
 #include "picolibrary/fixed_capacity_vector.h"
 #include "picolibrary/precondition.h"
 #include "picolibrary/rom.h"
+#include "picolibrary/state_machine_tracer.h"
 
 namespace picolibrary {
 
@@ -327,6 +329,202 @@ class HSM {
         return hsm.event_ignored( event );
     }
 
+    /**
+     * \brief State hierarchy cache.
+     *
+     * A state hierarchy cache memoizes each state's superstate the first time it is
+     * discovered. State paths (the exit and entry paths of a state transition) can then be
+     * discovered without passing the discovery pseudo-event to state event handlers. Once
+     * the cache is full, uncached states are discovered by passing the discovery
+     * pseudo-event to their state event handlers.
+     *
+     * Since a state's superstate never changes, a state hierarchy cache can be shared by
+     * HSMs that share state event handlers.
+     */
+    class Hierarchy_Cache {
+      public:
+        /**
+         * \brief Cache entry.
+         */
+        struct Entry {
+            /**
+             * \brief The state event handler for the state.
+             */
+            State_Event_Handler_Pointer state;
+
+            /**
+             * \brief The state event handler for the state's superstate.
+             */
+            State_Event_Handler_Pointer superstate;
+        };
+
+        /**
+         * \brief Constructor.
+         *
+         * \param[in] begin The beginning of the cache's entry storage.
+         * \param[in] end The end of the cache's entry storage.
+         */
+        constexpr Hierarchy_Cache( Entry * begin, Entry * end ) noexcept :
+            m_begin{ begin },
+            m_end{ begin },
+            m_storage_end{ end }
+        {
+        }
+
+        Hierarchy_Cache( Hierarchy_Cache && ) = delete;
+
+        Hierarchy_Cache( Hierarchy_Cache const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Hierarchy_Cache() noexcept = default;
+
+        auto operator=( Hierarchy_Cache && ) = delete;
+
+        auto operator=( Hierarchy_Cache const & ) = delete;
+
+        /**
+         * \brief Get the number of cached states.
+         *
+         * \return The number of cached states.
+         */
+        constexpr auto size() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>( m_end - m_begin );
+        }
+
+        /**
+         * \brief Get the maximum number of cached states.
+         *
+         * \return The maximum number of cached states.
+         */
+        constexpr auto capacity() const noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>( m_storage_end - m_begin );
+        }
+
+        /**
+         * \brief Remove all cached states.
+         */
+        constexpr void clear() noexcept
+        {
+            m_end = m_begin;
+        }
+
+        /**
+         * \brief Look up a state's superstate.
+         *
+         * \param[in] state The state event handler for the state whose superstate is to
+         *            be looked up.
+         *
+         * \return The state event handler for the state's superstate if the state is
+         *         cached.
+         * \return nullptr if the state is not cached.
+         */
+        constexpr auto find( State_Event_Handler_Reference state ) const noexcept -> State_Event_Handler_Pointer
+        {
+            for ( auto entry = m_begin; entry != m_end; ++entry ) {
+                if ( entry->state == &state ) {
+                    return entry->superstate;
+                } // if
+            }     // for
+
+            return nullptr;
+        }
+
+        /**
+         * \brief Cache a state's superstate if the cache is not full.
+         *
+         * \param[in] state The state event handler for the state.
+         * \param[in] superstate The state event handler for the state's superstate.
+         */
+        constexpr void insert( State_Event_Handler_Reference state, State_Event_Handler_Reference superstate ) noexcept
+        {
+            if ( m_end == m_storage_end ) {
+                return;
+            } // if
+
+            m_end->state      = &state;
+            m_end->superstate = &superstate;
+
+            ++m_end;
+        }
+
+      protected:
+        /**
+         * \brief Constructor.
+         */
+        constexpr Hierarchy_Cache() noexcept = default;
+
+        /**
+         * \brief Set the cache's entry storage.
+         *
+         * \param[in] begin The beginning of the cache's entry storage.
+         * \param[in] end The end of the cache's entry storage.
+         */
+        constexpr void set_storage( Entry * begin, Entry * end ) noexcept
+        {
+            m_begin       = begin;
+            m_end         = begin;
+            m_storage_end = end;
+        }
+
+      private:
+        /**
+         * \brief The beginning of the cache's entry storage.
+         */
+        Entry * m_begin{};
+
+        /**
+         * \brief The end of the cached entries.
+         */
+        Entry * m_end{};
+
+        /**
+         * \brief The end of the cache's entry storage.
+         */
+        Entry * m_storage_end{};
+    };
+
+    /**
+     * \brief Fixed capacity state hierarchy cache.
+     *
+     * \tparam N The maximum number of cached states.
+     */
+    template<std::size_t N>
+    class Fixed_Capacity_Hierarchy_Cache final : public Hierarchy_Cache {
+      public:
+        static_assert( N > 0 );
+
+        /**
+         * \brief Constructor.
+         */
+        constexpr Fixed_Capacity_Hierarchy_Cache() noexcept
+        {
+            set_storage( m_entries.begin(), m_entries.end() );
+        }
+
+        Fixed_Capacity_Hierarchy_Cache( Fixed_Capacity_Hierarchy_Cache && ) = delete;
+
+        Fixed_Capacity_Hierarchy_Cache( Fixed_Capacity_Hierarchy_Cache const & ) = delete;
+
+        /**
+         * \brief Destructor.
+         */
+        ~Fixed_Capacity_Hierarchy_Cache() noexcept = default;
+
+        auto operator=( Fixed_Capacity_Hierarchy_Cache && ) = delete;
+
+        auto operator=( Fixed_Capacity_Hierarchy_Cache const & ) = delete;
+
+      private:
+        /**
+         * \brief The cache's entry storage.
+         */
+        Array<Entry, N> m_entries{};
+    };
+
     /**
      * \brief Report that an event has been handled.
      *
@@ -397,6 +595,22 @@ class HSM {
     {
     }
 
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] initial_pseudostate The state event handler for the initial pseudostate.
+     *            The state event handler for the initial pseudostate must trigger the
+     *            initial transition by calling picolibrary::HSM::transition_to().
+     * \param[in] hierarchy_cache The state hierarchy cache to use when discovering state
+     *            paths.
+     */
+    constexpr HSM( State_Event_Handler_Reference initial_pseudostate, Hierarchy_Cache & hierarchy_cache ) noexcept
+        :
+        m_hierarchy_cache{ &hierarchy_cache },
+        m_initial_pseudostate{ &initial_pseudostate }
+    {
+    }
+
     /**
      * \brief Constructor.
      *
@@ -456,6 +670,25 @@ class HSM {
         transition_from( top );
     }
 
+    /**
+     * \brief Enable binary tracing.
+     *
+     * \param[in] tracer The tracer to generate dispatch, transition, entry, exit, and
+     *            ignored event trace records with.
+     */
+    constexpr void enable_tracing( State_Machine_Trace::Tracer & tracer ) noexcept
+    {
+        m_tracer = &tracer;
+    }
+
+    /**
+     * \brief Disable binary tracing.
+     */
+    constexpr void disable_tracing() noexcept
+    {
+        m_tracer = nullptr;
+    }
+
     /**
      * \brief Dispatch an event to the event handler for the currently active state.
      *
@@ -470,21 +703,29 @@ class HSM {
     {
         PICOLIBRARY_EXPECT( m_current_state, Generic_Error::LOGIC_ERROR );
 
-        auto state = m_current_state;
-        for ( ;; ) {
+        trace( State_Machine_Trace::Record_Type::DISPATCH, m_current_state, event );
+
+        for ( auto state = m_current_state; state; ) {
             switch ( ( *state )( *this, event ) ) {
-                case Event_Handling_Result::EVENT_HANDLED: return;
+                case Event_Handling_Result::EVENT_HANDLED: state = nullptr; break;
                 case Event_Handling_Result::STATE_TRANSITION_TRIGGERED:
+                    trace( State_Machine_Trace::Record_Type::TRANSITION, state, event );
                     transition_from( state );
-                    return;
+                    state = nullptr;
+                    break;
                 case Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE:
                     state = m_superstate;
                     break;
-                case Event_Handling_Result::EVENT_IGNORED: return;
+                case Event_Handling_Result::EVENT_IGNORED:
+                    trace( State_Machine_Trace::Record_Type::IGNORED, state, event );
+                    state = nullptr;
+                    break;
                 default:
                     PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
             } // switch
         }     // for
+
+        trace( State_Machine_Trace::Record_Type::DISPATCH_COMPLETE, m_current_state, event );
     }
 
     /**
@@ -518,6 +759,34 @@ class HSM {
         return path.is_complete();
     }
 
+    /**
+     * \brief Populate the state hierarchy cache with a state and all of its superstates.
+     *
+     * Priming the cache with each leaf state at startup moves all state hierarchy
+     * discovery out of event dispatch.
+     *
+     * \pre the HSM was constructed with a state hierarchy cache
+     *
+     * \pre the state event handlers are well behaved
+     *
+     * \pre this function is not called from a state event handler
+     *
+     * \param[in] state The state event handler for the state to cache.
+     */
+    void prime_hierarchy_cache( State_Event_Handler_Reference state ) noexcept
+    {
+        PICOLIBRARY_EXPECT( m_hierarchy_cache, Generic_Error::LOGIC_ERROR );
+
+        auto const initial_pseudostate = m_initial_pseudostate;
+
+        auto superstate = &state;
+        while ( superstate != top ) {
+            superstate = discover_superstate( *superstate );
+        } // while
+
+        m_initial_pseudostate = initial_pseudostate;
+    }
+
   private:
     /**
      * \brief State path.
@@ -581,23 +850,16 @@ class HSM {
             m_is_complete = end == top;
             m_storage.push_back( &begin );
 
-            PICOLIBRARY_EXPECT(
-                ( begin )( hsm, DISCOVERY ) == Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE,
-                Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
-            while ( hsm.m_superstate != top ) {
-                if ( hsm.m_superstate == &end ) {
+            for ( auto superstate = hsm.discover_superstate( begin ); superstate != top;
+                  superstate      = hsm.discover_superstate( *superstate ) ) {
+                if ( superstate == &end ) {
                     m_is_complete = true;
 
                     return;
                 } // if
 
-                m_storage.push_back( hsm.m_superstate );
-
-                PICOLIBRARY_EXPECT(
-                    ( *hsm.m_superstate )( hsm, DISCOVERY )
-                        == Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE,
-                    Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
-            } // while
+                m_storage.push_back( superstate );
+            } // for
         }
 
         /**
@@ -701,6 +963,18 @@ class HSM {
      */
     State_Event_Handler_Pointer m_current_state{};
 
+    /**
+     * \brief The state hierarchy cache to use when discovering state paths (nullptr if
+     *        state paths are always discovered by passing the discovery pseudo-event to
+     *        state event handlers).
+     */
+    Hierarchy_Cache * m_hierarchy_cache{};
+
+    /**
+     * \brief The tracer to generate trace records with (nullptr if tracing is disabled).
+     */
+    State_Machine_Trace::Tracer * m_tracer{};
+
     union {
         /**
          * \brief The state event handler for the initial pseudostate.
@@ -732,6 +1006,50 @@ class HSM {
         return Event_Handling_Result::EVENT_IGNORED;
     }
 
+    /**
+     * \brief Generate a trace record if tracing is enabled.
+     *
+     * \param[in] type The record type.
+     * \param[in] state The state event handler for the state the record applies to.
+     * \param[in] event The event the record applies to.
+     */
+    void trace( State_Machine_Trace::Record_Type type, State_Event_Handler_Pointer state, Event const & event ) noexcept
+    {
+        if ( m_tracer ) {
+            m_tracer->trace( type, State_Machine_Trace::state_id( state ), event.id() );
+        } // if
+    }
+
+    /**
+     * \brief Discover a state's superstate.
+     *
+     * \pre the state event handler is well behaved
+     *
+     * \param[in] state The state event handler for the state whose superstate is to be
+     *            discovered.
+     *
+     * \return The state event handler for the state's superstate.
+     */
+    auto discover_superstate( State_Event_Handler_Reference state ) noexcept -> State_Event_Handler_Pointer
+    {
+        if ( m_hierarchy_cache ) {
+            auto const superstate = m_hierarchy_cache->find( state );
+            if ( superstate ) {
+                return superstate;
+            } // if
+        }     // if
+
+        PICOLIBRARY_EXPECT(
+            ( state )( *this, DISCOVERY ) == Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE,
+            Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
+
+        if ( m_hierarchy_cache ) {
+            m_hierarchy_cache->insert( state, *m_superstate );
+        } // if
+
+        return m_superstate;
+    }
+
     /**
      * \brief Execute a state's entry actions.
      *
@@ -744,7 +1062,9 @@ class HSM {
     {
         switch ( ( state )( *this, ENTRY ) ) {
             case Event_Handling_Result::EVENT_HANDLED: [[fallthrough]];
-            case Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE: return;
+            case Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE:
+                trace( State_Machine_Trace::Record_Type::ENTRY, &state, ENTRY );
+                return;
             default:
                 PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
         } // switch
@@ -777,7 +1097,9 @@ class HSM {
     {
         switch ( ( state )( *this, EXIT ) ) {
             case Event_Handling_Result::EVENT_HANDLED: [[fallthrough]];
-            case Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE: return;
+            case Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE:
+                trace( State_Machine_Trace::Record_Type::EXIT, &state, EXIT );
+                return;
             default:
                 PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
         } // switch
@@ -25,9 +25,14 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
+#include "picolibrary/array.h"
+#include "picolibrary/error.h"
 #include "picolibrary/ip.h"
 #include "picolibrary/result.h"
+#include "picolibrary/stream.h"
 
 /**
  * \brief TCP over IP facilities.
@@ -499,6 +504,604 @@ class Server_Concept {
     void close() noexcept;
 };
 
+/**
+ * \brief Check if a socket reports its maximum segment size.
+ *
+ * \tparam Socket The socket to check.
+ */
+template<typename Socket, typename = void>
+struct has_maximum_segment_size : std::false_type {
+};
+
+/**
+ * \brief Check if a socket reports its maximum segment size.
+ *
+ * \tparam Socket The socket to check.
+ */
+template<typename Socket>
+struct has_maximum_segment_size<Socket, std::void_t<decltype( std::declval<Socket const &>().maximum_segment_size() )>> :
+    std::true_type {
+};
+
+/**
+ * \brief Check if a socket reports its maximum segment size.
+ *
+ * \tparam Socket The socket to check.
+ */
+template<typename Socket>
+inline constexpr auto has_maximum_segment_size_v = has_maximum_segment_size<Socket>::value;
+
+/**
+ * \brief Socket I/O stream device access buffer.
+ *
+ * Data written to the buffer is coalesced into segments instead of being written to the
+ * socket's transmit buffer one put at a time. A segment is written to the socket's
+ * transmit buffer when it reaches the segment size or when the buffer is flushed. The
+ * segment size is N, or the socket's maximum segment size if the socket reports one
+ * (picolibrary::IP::TCP::has_maximum_segment_size) and it is smaller than N. The socket's
+ * maximum segment size is read once, on the first put after construction or after the
+ * buffer is flushed, since reading it may require a device register read.
+ *
+ * \tparam Socket The type of socket to write to (must meet the requirements of
+ *         picolibrary::IP::TCP::Client_Concept or
+ *         picolibrary::IP::TCP::Server_Connection_Handler_Concept).
+ * \tparam N The maximum number of bytes to coalesce into a single segment.
+ *
+ * \attention The buffer deliberately implements a blocking write policy: if the socket is
+ *            in non-blocking mode, writing a segment to the socket's transmit buffer busy
+ *            waits (retrying on picolibrary::Generic_Error::WOULD_BLOCK) until the
+ *            socket's transmit buffer has accepted the entire segment. The stream buffer
+ *            interface cannot report partially accepted puts, and output streams treat
+ *            put errors as fatal, so picolibrary::Generic_Error::WOULD_BLOCK is not
+ *            reported to the caller. Since segments are coalesced, this wait occurs once
+ *            per segment instead of once per put. Applications that must not block
+ *            should use the socket's transmit() member function directly (e.g. using
+ *            picolibrary::Coroutine::transmit()).
+ *
+ * \attention Data that has not been written to the socket's transmit buffer is discarded
+ *            when the buffer is destroyed.
+ */
+template<typename Socket, std::size_t N>
+class Socket_Stream_Buffer final : public Stream_Buffer {
+  public:
+    static_assert( N > 0 );
+
+    using Stream_Buffer::put;
+
+    Socket_Stream_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] socket The socket to write to.
+     */
+    constexpr Socket_Stream_Buffer( Socket & socket ) noexcept : m_socket{ &socket }
+    {
+    }
+
+    Socket_Stream_Buffer( Socket_Stream_Buffer && ) = delete;
+
+    Socket_Stream_Buffer( Socket_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Socket_Stream_Buffer() noexcept = default;
+
+    auto operator=( Socket_Stream_Buffer && ) = delete;
+
+    auto operator=( Socket_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the amount of data that has yet to be written to the socket's transmit
+     *        buffer.
+     *
+     * \return The amount of data that has yet to be written to the socket's transmit
+     *         buffer.
+     */
+    constexpr auto pending() const noexcept -> std::size_t
+    {
+        return m_size;
+    }
+
+    /**
+     * \brief Get the segment size.
+     *
+     * \return The cached segment size if it has been read since the buffer was
+     *         constructed or last flushed.
+     * \return The socket's current segment size if the segment size has not been read
+     *         since the buffer was constructed or last flushed.
+     */
+    auto segment_size() const noexcept -> std::size_t
+    {
+        return m_segment_size ? m_segment_size : read_segment_size();
+    }
+
+    /**
+     * \brief Write a character to the put area of the buffer.
+     *
+     * \param[in] character The character to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        return append( static_cast<std::uint8_t>( character ) );
+    }
+
+    /**
+     * \brief Write a block of characters to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the put area
+     *            of the buffer.
+     * \param[in] end The end of the block of characters to write to the put area of the
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final
+    {
+        return append( begin, end );
+    }
+
+    /**
+     * \brief Write an unsigned byte to the put area of the buffer.
+     *
+     * \param[in] value The unsigned byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void> override final
+    {
+        return append( value );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of unsigned bytes to write to the put area of
+     *            the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void> override final
+    {
+        return append( begin, end );
+    }
+
+    /**
+     * \brief Write a signed byte to the put area of the buffer.
+     *
+     * \param[in] value The signed byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void> override final
+    {
+        return append( static_cast<std::uint8_t>( value ) );
+    }
+
+    /**
+     * \brief Write a block of signed bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of signed bytes to write to the put area of the
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t const * begin, std::int8_t const * end ) noexcept -> Result<void> override final
+    {
+        return append( begin, end );
+    }
+
+    /**
+     * \brief Write an array of segments to the put area of the buffer.
+     *
+     * The segments are coalesced in a single pass.
+     *
+     * \param[in] begin The beginning of the array of segments to write to the put area of
+     *            the buffer.
+     * \param[in] end The end of the array of segments to write to the put area of the
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept -> Result<void> override final
+    {
+        for ( ; begin != end; ++begin ) {
+            auto result = append( begin->begin, begin->end );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // for
+
+        return {};
+    }
+
+    /**
+     * \brief Write any data that is buffered in the put area of the buffer to the
+     *        socket's transmit buffer.
+     *
+     * \return Nothing if the flush succeeded.
+     * \return An error code if the flush failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        m_segment_size = 0;
+
+        return transmit();
+    }
+
+  private:
+    /**
+     * \brief The socket to write to.
+     */
+    Socket * m_socket;
+
+    /**
+     * \brief The segment that is being coalesced.
+     */
+    Array<std::uint8_t, N> m_segment{};
+
+    /**
+     * \brief The amount of data in the segment that is being coalesced.
+     */
+    std::size_t m_size{};
+
+    /**
+     * \brief The cached segment size (0 if the segment size has not been read since the
+     *        buffer was constructed or last flushed).
+     */
+    std::size_t m_segment_size{};
+
+    /**
+     * \brief Read the socket's segment size.
+     *
+     * \return The socket's segment size.
+     */
+    auto read_segment_size() const noexcept -> std::size_t
+    {
+        if constexpr ( has_maximum_segment_size_v<Socket> ) {
+            auto const maximum_segment_size = static_cast<std::size_t>(
+                m_socket->maximum_segment_size() );
+
+            return maximum_segment_size and maximum_segment_size < N ? maximum_segment_size : N;
+        } else {
+            return N;
+        } // else
+    }
+
+    /**
+     * \brief Get the segment size, reading the socket's segment size if it has not been
+     *        read since the buffer was constructed or last flushed.
+     *
+     * \return The segment size.
+     */
+    auto cached_segment_size() noexcept -> std::size_t
+    {
+        if ( not m_segment_size ) {
+            m_segment_size = read_segment_size();
+        } // if
+
+        return m_segment_size;
+    }
+
+    /**
+     * \brief Append a byte to the segment that is being coalesced.
+     *
+     * \param[in] value The byte to append to the segment that is being coalesced.
+     *
+     * \return Nothing if appending the byte succeeded.
+     * \return An error code if appending the byte failed.
+     */
+    auto append( std::uint8_t value ) noexcept -> Result<void>
+    {
+        m_segment[ m_size ] = value;
+        ++m_size;
+
+        if ( m_size >= cached_segment_size() ) {
+            return transmit();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Append a block of bytes to the segment that is being coalesced.
+     *
+     * \tparam Byte The type of byte to append.
+     *
+     * \param[in] begin The beginning of the block of bytes to append to the segment that
+     *            is being coalesced.
+     * \param[in] end The end of the block of bytes to append to the segment that is being
+     *            coalesced.
+     *
+     * \return Nothing if appending the block of bytes succeeded.
+     * \return An error code if appending the block of bytes failed.
+     */
+    template<typename Byte>
+    auto append( Byte const * begin, Byte const * end ) noexcept -> Result<void>
+    {
+        auto const size = cached_segment_size();
+
+        while ( begin != end ) {
+            for ( ; begin != end and m_size < size; ++begin, ++m_size ) {
+                m_segment[ m_size ] = static_cast<std::uint8_t>( *begin );
+            } // for
+
+            if ( m_size >= size ) {
+                auto result = transmit();
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            }     // if
+        }         // while
+
+        return {};
+    }
+
+    /**
+     * \brief Write the segment that is being coalesced to the socket's transmit buffer.
+     *
+     * If the socket is in non-blocking mode, this busy waits until the socket's transmit
+     * buffer has accepted the entire segment (see the class documentation).
+     *
+     * \return Nothing if writing the segment to the socket's transmit buffer succeeded.
+     * \return An error code if writing the segment to the socket's transmit buffer
+     *         failed. If writing the segment to the socket's transmit buffer fails, the
+     *         remainder of the segment is discarded.
+     */
+    auto transmit() noexcept -> Result<void>
+    {
+        auto       begin = static_cast<std::uint8_t const *>( m_segment.data() );
+        auto const end   = begin + m_size;
+
+        m_size = 0;
+
+        while ( begin != end ) {
+            auto result = m_socket->transmit( begin, end );
+            if ( result.is_error() ) {
+                if ( result.error() == Generic_Error::WOULD_BLOCK ) {
+                    continue;
+                } // if
+
+                return result.error();
+            } // if
+
+            begin = result.value();
+        } // while
+
+        return {};
+    }
+};
+
+/**
+ * \brief Socket output stream.
+ *
+ * \tparam Socket The type of socket to write to (must meet the requirements of
+ *         picolibrary::IP::TCP::Client_Concept or
+ *         picolibrary::IP::TCP::Server_Connection_Handler_Concept).
+ * \tparam N The maximum number of bytes to coalesce into a single segment.
+ */
+template<typename Socket, std::size_t N>
+class Socket_Output_Stream : public Static_Output_Stream<Socket_Stream_Buffer<Socket, N>> {
+  public:
+    Socket_Output_Stream() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] socket The socket to write to.
+     */
+    Socket_Output_Stream( Socket & socket ) noexcept : m_buffer{ socket }
+    {
+        this->set_buffer( &m_buffer );
+    }
+
+    Socket_Output_Stream( Socket_Output_Stream && ) = delete;
+
+    Socket_Output_Stream( Socket_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Socket_Output_Stream() noexcept = default;
+
+    auto operator=( Socket_Output_Stream && ) = delete;
+
+    auto operator=( Socket_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Get the amount of data that has yet to be written to the socket's transmit
+     *        buffer.
+     *
+     * \return The amount of data that has yet to be written to the socket's transmit
+     *         buffer.
+     */
+    constexpr auto pending() const noexcept -> std::size_t
+    {
+        return m_buffer.pending();
+    }
+
+  private:
+    /**
+     * \brief The stream's I/O stream device access buffer.
+     */
+    Socket_Stream_Buffer<Socket, N> m_buffer;
+};
+
+/**
+ * \brief Socket input buffer.
+ *
+ * Data is read from the socket's receive buffer in chunks of up to N bytes, and then
+ * handed out from the input buffer, so that small reads do not each require a socket
+ * receive buffer read.
+ *
+ * \tparam Socket The type of socket to read from (must meet the requirements of
+ *         picolibrary::IP::TCP::Client_Concept or
+ *         picolibrary::IP::TCP::Server_Connection_Handler_Concept).
+ * \tparam N The size of the chunks to read from the socket's receive buffer.
+ */
+template<typename Socket, std::size_t N>
+class Socket_Input_Buffer {
+  public:
+    static_assert( N > 0 );
+
+    Socket_Input_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] socket The socket to read from.
+     */
+    constexpr Socket_Input_Buffer( Socket & socket ) noexcept : m_socket{ &socket }
+    {
+    }
+
+    Socket_Input_Buffer( Socket_Input_Buffer && ) = delete;
+
+    Socket_Input_Buffer( Socket_Input_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Socket_Input_Buffer() noexcept = default;
+
+    auto operator=( Socket_Input_Buffer && ) = delete;
+
+    auto operator=( Socket_Input_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the amount of data that has been read from the socket's receive buffer
+     *        but has not been read from the input buffer.
+     *
+     * \return The amount of data that has been read from the socket's receive buffer but
+     *         has not been read from the input buffer.
+     */
+    constexpr auto buffered() const noexcept -> std::size_t
+    {
+        return m_end - m_begin;
+    }
+
+    /**
+     * \brief Read a byte.
+     *
+     * \param[out] value The byte read.
+     *
+     * \return Nothing if the read succeeded.
+     * \return An error code if the read failed. If the socket is in a non-blocking mode,
+     *         and no data is available, picolibrary::Generic_Error::WOULD_BLOCK is
+     *         returned.
+     */
+    auto get( std::uint8_t & value ) noexcept -> Result<void>
+    {
+        if ( not buffered() ) {
+            auto result = fill();
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // if
+
+        value = m_chunk[ m_begin ];
+        ++m_begin;
+
+        return {};
+    }
+
+    /**
+     * \brief Read a block of data.
+     *
+     * If the input buffer is empty and the block is at least N bytes long, data is read
+     * from the socket's receive buffer directly into the block.
+     *
+     * \param[out] begin The beginning of the block of data read.
+     * \param[out] end The end of the block of data read.
+     *
+     * \return The end of the data that was read if the read succeeded.
+     * \return An error code if the read failed. If the socket is in a non-blocking mode,
+     *         and no data is available, picolibrary::Generic_Error::WOULD_BLOCK is
+     *         returned.
+     */
+    auto get( std::uint8_t * begin, std::uint8_t * end ) noexcept -> Result<std::uint8_t *>
+    {
+        if ( begin == end ) {
+            return begin;
+        } // if
+
+        if ( not buffered() ) {
+            if ( static_cast<std::size_t>( end - begin ) >= N ) {
+                return m_socket->receive( begin, end );
+            } // if
+
+            auto result = fill();
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // if
+
+        for ( ; begin != end and m_begin != m_end; ++begin, ++m_begin ) {
+            *begin = m_chunk[ m_begin ];
+        } // for
+
+        return begin;
+    }
+
+  private:
+    /**
+     * \brief The socket to read from.
+     */
+    Socket * m_socket;
+
+    /**
+     * \brief The chunk that was read from the socket's receive buffer.
+     */
+    Array<std::uint8_t, N> m_chunk{};
+
+    /**
+     * \brief The position of the next byte to read from the chunk.
+     */
+    std::size_t m_begin{};
+
+    /**
+     * \brief The end of the chunk.
+     */
+    std::size_t m_end{};
+
+    /**
+     * \brief Read a chunk from the socket's receive buffer.
+     *
+     * \return Nothing if reading a chunk succeeded.
+     * \return An error code if reading a chunk failed.
+     */
+    auto fill() noexcept -> Result<void>
+    {
+        auto result = m_socket->receive( m_chunk.begin(), m_chunk.end() );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        m_begin = 0;
+        m_end   = static_cast<std::size_t>( result.value() - m_chunk.begin() );
+
+        if ( not m_end ) {
+            return Generic_Error::WOULD_BLOCK;
+        } // if
+
+        return {};
+    }
+};
+
 } // namespace picolibrary::IP::TCP
 
 #endif // PICOLIBRARY_IP_TCP_H
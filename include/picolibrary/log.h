@@ -0,0 +1,1176 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Log interface.
+ */
+
+#ifndef PICOLIBRARY_LOG_H
+#define PICOLIBRARY_LOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+#include "picolibrary/array.h"
+#include "picolibrary/circular_buffer.h"
+#include "picolibrary/format.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+
+#ifndef PICOLIBRARY_LOG_LEVEL
+/**
+ * \brief The default log level name string literal ("OFF", "ERROR", "WARN", "INFO",
+ *        "DEBUG", or "TRACE").
+ */
+#define PICOLIBRARY_LOG_LEVEL "INFO"
+#endif // PICOLIBRARY_LOG_LEVEL
+
+#ifndef PICOLIBRARY_LOG_MODULE_LEVELS
+/**
+ * \brief The comma separated list of "<module>=<level>" pairs used to override the
+ *        default log level for specific modules.
+ */
+#define PICOLIBRARY_LOG_MODULE_LEVELS ""
+#endif // PICOLIBRARY_LOG_MODULE_LEVELS
+
+/**
+ * \brief Logging facilities.
+ */
+namespace picolibrary::Log {
+
+/**
+ * \brief Deferred log record format string ID.
+ */
+using Format_String_ID = std::uint32_t;
+
+/**
+ * \brief The format string ID reserved for the dropped records record.
+ */
+constexpr auto DROPPED_RECORDS_FORMAT_STRING_ID = Format_String_ID{ 0 };
+
+/**
+ * \brief The format string used to decode the dropped records record.
+ */
+constexpr auto DROPPED_RECORDS_FORMAT_STRING = "<{} deferred log records dropped>";
+
+/**
+ * \brief Compute a format string's ID.
+ *
+ * The ID is the 32-bit FNV-1a hash of the format string. The hash is remapped if it
+ * collides with picolibrary::Log::DROPPED_RECORDS_FORMAT_STRING_ID.
+ *
+ * \param[in] format The null-terminated format string.
+ *
+ * \return The format string's ID.
+ */
+constexpr auto format_string_id( char const * format ) noexcept -> Format_String_ID
+{
+    auto hash = Format_String_ID{ 0x811C'9DC5 };
+
+    for ( ; *format; ++format ) {
+        hash ^= static_cast<std::uint8_t>( *format );
+        hash *= Format_String_ID{ 0x0100'0193 };
+    } // for
+
+    return hash != DROPPED_RECORDS_FORMAT_STRING_ID ? hash : Format_String_ID{ 1 };
+}
+
+/**
+ * \brief Deferred log record argument type.
+ */
+enum class Argument_Type : std::uint8_t {
+    CHAR,   ///< char.
+    UINT8,  ///< 8-bit unsigned integer.
+    INT8,   ///< 8-bit signed integer.
+    UINT16, ///< 16-bit unsigned integer.
+    INT16,  ///< 16-bit signed integer.
+    UINT32, ///< 32-bit unsigned integer.
+    INT32,  ///< 32-bit signed integer.
+    UINT64, ///< 64-bit unsigned integer.
+    INT64,  ///< 64-bit signed integer.
+};
+
+/**
+ * \brief Get a deferred log record argument type's size.
+ *
+ * \param[in] type The argument type.
+ *
+ * \return The number of bytes used to encode an argument of the specified type.
+ */
+constexpr auto argument_size( Argument_Type type ) noexcept -> std::uint_fast8_t
+{
+    switch ( type ) {
+        case Argument_Type::CHAR:
+        case Argument_Type::UINT8:
+        case Argument_Type::INT8: return 1;
+        case Argument_Type::UINT16:
+        case Argument_Type::INT16: return 2;
+        case Argument_Type::UINT32:
+        case Argument_Type::INT32: return 4;
+        case Argument_Type::UINT64:
+        case Argument_Type::INT64: return 8;
+    } // switch
+
+    return 0;
+}
+
+/**
+ * \brief Get the deferred log record argument type used to encode a type.
+ *
+ * \tparam T The type to encode.
+ *
+ * \return The deferred log record argument type used to encode the type.
+ */
+template<typename T>
+constexpr auto argument_type() noexcept -> Argument_Type
+{
+    static_assert(
+        std::is_integral_v<T> and not std::is_same_v<T, bool>,
+        "deferred log record arguments must be characters or integers" );
+
+    if constexpr ( std::is_same_v<T, char> ) {
+        return Argument_Type::CHAR;
+    } else if constexpr ( sizeof( T ) == 1 ) {
+        return std::is_signed_v<T> ? Argument_Type::INT8 : Argument_Type::UINT8;
+    } else if constexpr ( sizeof( T ) == 2 ) {
+        return std::is_signed_v<T> ? Argument_Type::INT16 : Argument_Type::UINT16;
+    } else if constexpr ( sizeof( T ) == 4 ) {
+        return std::is_signed_v<T> ? Argument_Type::INT32 : Argument_Type::UINT32;
+    } else {
+        static_assert( sizeof( T ) == 8, "unsupported deferred log record argument size" );
+
+        return std::is_signed_v<T> ? Argument_Type::INT64 : Argument_Type::UINT64;
+    } // else
+}
+
+/**
+ * \brief Deferred log.
+ *
+ * A deferred log stores a compact binary record for each log statement instead of
+ * formatting the log statement's text. A record consists of the following fields:
+ * - the number of bytes in the record following this field (1 byte)
+ * - the ID of the record's format string (see picolibrary::Log::format_string_id(),
+ *   4 bytes, little endian)
+ * - for each argument, the argument's type (see picolibrary::Log::Argument_Type, 1 byte)
+ *   followed by the argument's value (little endian)
+ *
+ * Records are stored in a circular buffer until they are drained to an output stream.
+ * Records that do not fit in the circular buffer are dropped, and the number of dropped
+ * records is written to the output stream, as a record with the
+ * picolibrary::Log::DROPPED_RECORDS_FORMAT_STRING_ID format string ID, the next time the
+ * deferred log is drained. Use picolibrary::Log::Decoder to reconstruct the text of the
+ * drained records.
+ *
+ * \attention A deferred log is not interrupt safe. If a deferred log is written to from
+ *            an interrupt context, all accesses to it from the main thread of execution
+ *            must be made inside an interrupt critical section.
+ *
+ * \tparam Size_Type The unsigned integer type used to track the number of bytes stored
+ *         in the deferred log's circular buffer.
+ * \tparam N The maximum number of bytes the deferred log's circular buffer is able to
+ *         hold (must be a power of two).
+ */
+template<typename Size_Type, Size_Type N>
+class Deferred_Log {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    Deferred_Log() noexcept = default;
+
+    Deferred_Log( Deferred_Log && ) = delete;
+
+    Deferred_Log( Deferred_Log const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Deferred_Log() noexcept = default;
+
+    auto operator=( Deferred_Log && ) = delete;
+
+    auto operator=( Deferred_Log const & ) = delete;
+
+    /**
+     * \brief Check if the deferred log is empty.
+     *
+     * \return true if the deferred log does not contain any records.
+     * \return false if the deferred log contains records.
+     */
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+        return m_buffer.empty();
+    }
+
+    /**
+     * \brief Get the number of records that have been dropped since the deferred log was
+     *        last drained.
+     *
+     * \return The number of records that have been dropped since the deferred log was
+     *         last drained.
+     */
+    auto dropped() const noexcept -> std::uint32_t
+    {
+        return m_dropped;
+    }
+
+    /**
+     * \brief Write a record to the deferred log.
+     *
+     * The format string is not stored in the record, and is never formatted on the
+     * device. Use PICOLIBRARY_FORMAT() to create the format string.
+     *
+     * \tparam Source The format string source.
+     * \tparam Types The types of the values to log.
+     *
+     * \param[in] string The format string and the values to log.
+     *
+     * \return true if the record was written to the deferred log.
+     * \return false if the record was dropped because the deferred log is full.
+     */
+    template<typename Source, typename... Types>
+    auto write( Format::String<Source, Types...> const & string ) noexcept -> bool
+    {
+        using String = Format::String<Source, Types...>;
+
+        constexpr auto analysis = String::analyze();
+
+        static_assert( analysis.is_valid, "malformed format string" );
+        static_assert(
+            analysis.replacement_fields == sizeof...( Types ),
+            "format string replacement field count does not match value count" );
+
+        constexpr auto id = format_string_id( Source::string() );
+
+        constexpr auto record_size = std::size_t{ 1 + sizeof( Format_String_ID )
+                                                  + ( 0 + ... + ( 1 + sizeof( Types ) ) ) };
+
+        static_assert( record_size - 1 <= std::numeric_limits<std::uint8_t>::max() );
+        static_assert( record_size <= N );
+
+        if ( static_cast<std::size_t>( m_buffer.max_size() - m_buffer.size() ) < record_size ) {
+            if ( m_dropped != std::numeric_limits<std::uint32_t>::max() ) {
+                ++m_dropped;
+            } // if
+
+            return false;
+        } // if
+
+        push( static_cast<std::uint8_t>( record_size - 1 ) );
+        push_value( id );
+        std::apply(
+            [ this ]( auto const &... values ) noexcept {
+                ( push_argument( values ), ... );
+            },
+            string.values() );
+
+        return true;
+    }
+
+    /**
+     * \brief Drain the deferred log's records to an output stream.
+     *
+     * \param[in] stream The output stream to drain the deferred log's records to.
+     *
+     * \return Nothing if draining the deferred log's records succeeded.
+     * \return An error code if draining the deferred log's records failed. If draining
+     *         the deferred log's records failed, records that have been removed from the
+     *         deferred log but not written to the stream are lost.
+     */
+    auto drain( Output_Stream & stream ) noexcept -> Result<void>
+    {
+        while ( not m_buffer.empty() ) {
+            auto chunk = Chunk{};
+
+            auto const result = stream.put( chunk.begin(), chunk.begin() + pop( chunk ) );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // while
+
+        if ( m_dropped ) {
+            auto const record = dropped_records_record();
+
+            auto const result = stream.put( record.begin(), record.end() );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            m_dropped = 0;
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Drain the deferred log's records to an output stream.
+     *
+     * \param[in] stream The output stream to drain the deferred log's records to.
+     */
+    void drain( Reliable_Output_Stream & stream ) noexcept
+    {
+        while ( not m_buffer.empty() ) {
+            auto chunk = Chunk{};
+
+            stream.put( chunk.begin(), chunk.begin() + pop( chunk ) );
+        } // while
+
+        if ( m_dropped ) {
+            auto const record = dropped_records_record();
+
+            stream.put( record.begin(), record.end() );
+
+            m_dropped = 0;
+        } // if
+    }
+
+  private:
+    /**
+     * \brief The number of bytes removed from the circular buffer and written to the
+     *        output stream at a time when draining the deferred log.
+     */
+    static constexpr auto CHUNK_SIZE = std::size_t{ 16 };
+
+    /**
+     * \brief Drain chunk.
+     */
+    using Chunk = Array<std::uint8_t, CHUNK_SIZE>;
+
+    /**
+     * \brief Dropped records record.
+     */
+    using Dropped_Records_Record =
+        Array<std::uint8_t, 1 + sizeof( Format_String_ID ) + 1 + sizeof( std::uint32_t )>;
+
+    /**
+     * \brief The circular buffer used to store records.
+     */
+    Circular_Buffer<std::uint8_t, Size_Type, N, Circular_Buffer_Use_Case::MAIN_READS_MAIN_WRITES> m_buffer{};
+
+    /**
+     * \brief The number of records that have been dropped since the deferred log was
+     *        last drained.
+     */
+    std::uint32_t m_dropped{ 0 };
+
+    /**
+     * \brief Insert a byte at the back of the circular buffer.
+     *
+     * \param[in] byte The byte to insert.
+     */
+    void push( std::uint8_t byte ) noexcept
+    {
+        m_buffer.push( BYPASS_PRECONDITION_EXPECTATION_CHECKS, byte );
+    }
+
+    /**
+     * \brief Insert a value's bytes (little endian) at the back of the circular buffer.
+     *
+     * \tparam T The type of value to insert.
+     *
+     * \param[in] value The value to insert.
+     */
+    template<typename T>
+    void push_value( T value ) noexcept
+    {
+        auto const unsigned_value = static_cast<std::make_unsigned_t<T>>( value );
+
+        for ( auto i = std::size_t{ 0 }; i < sizeof( T ); ++i ) {
+            push( static_cast<std::uint8_t>( unsigned_value >> ( i * std::numeric_limits<std::uint8_t>::digits ) ) );
+        } // for
+    }
+
+    /**
+     * \brief Insert an argument at the back of the circular buffer.
+     *
+     * \tparam T The type of argument to insert.
+     *
+     * \param[in] value The argument to insert.
+     */
+    template<typename T>
+    void push_argument( T value ) noexcept
+    {
+        push( static_cast<std::uint8_t>( argument_type<T>() ) );
+        push_value( value );
+    }
+
+    /**
+     * \brief Remove bytes from the front of the circular buffer.
+     *
+     * \param[out] chunk The chunk to store the removed bytes in.
+     *
+     * \return The number of bytes that were removed.
+     */
+    auto pop( Chunk & chunk ) noexcept -> std::size_t
+    {
+        auto n = std::size_t{ 0 };
+
+        for ( ; n < chunk.size() and not m_buffer.empty(); ++n ) {
+            chunk[ n ] = m_buffer.front();
+            m_buffer.pop();
+        } // for
+
+        return n;
+    }
+
+    /**
+     * \brief Generate the dropped records record.
+     *
+     * \return The dropped records record.
+     */
+    auto dropped_records_record() const noexcept -> Dropped_Records_Record
+    {
+        auto record = Dropped_Records_Record{};
+
+        record[ 0 ] = static_cast<std::uint8_t>( record.size() - 1 );
+
+        for ( auto i = std::size_t{ 0 }; i < sizeof( Format_String_ID ); ++i ) {
+            record[ 1 + i ] = static_cast<std::uint8_t>(
+                DROPPED_RECORDS_FORMAT_STRING_ID >> ( i * std::numeric_limits<std::uint8_t>::digits ) );
+        } // for
+
+        record[ 1 + sizeof( Format_String_ID ) ] = static_cast<std::uint8_t>( Argument_Type::UINT32 );
+
+        for ( auto i = std::size_t{ 0 }; i < sizeof( std::uint32_t ); ++i ) {
+            record[ 2 + sizeof( Format_String_ID ) + i ] = static_cast<std::uint8_t>(
+                m_dropped >> ( i * std::numeric_limits<std::uint8_t>::digits ) );
+        } // for
+
+        return record;
+    }
+};
+
+/**
+ * \brief Deferred log record decoder.
+ *
+ * The decoder is intended to be used on the host that receives the records drained from
+ * a picolibrary::Log::Deferred_Log. The decoder is given the format strings used by the
+ * device (the dictionary), and reconstructs the text of each record using the record's
+ * format string ID to look up the record's format string. The decoder supports the
+ * format string syntax supported by PICOLIBRARY_FORMAT(). Integers formatted using "{}"
+ * are formatted as decimal integers.
+ *
+ * Each decoded record is terminated with a newline. Records whose format string ID is not
+ * in the dictionary and records that do not match their format string are reported
+ * instead of being decoded.
+ */
+class Decoder {
+  public:
+    Decoder() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] begin The beginning of the dictionary.
+     * \param[in] end The end of the dictionary.
+     */
+    constexpr Decoder( char const * const * begin, char const * const * end ) noexcept :
+        m_begin{ begin },
+        m_end{ end }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Decoder( Decoder && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Decoder( Decoder const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Decoder() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Decoder && expression ) noexcept -> Decoder & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Decoder const & expression ) noexcept -> Decoder & = default;
+
+    /**
+     * \brief Decode records.
+     *
+     * \param[in] stream The output stream to write the decoded records to.
+     * \param[in] begin The beginning of the block of record bytes to decode.
+     * \param[in] end The end of the block of record bytes to decode.
+     *
+     * \return The beginning of the trailing incomplete record (end if the block does not
+     *         end with an incomplete record) if decoding succeeded. The bytes of the
+     *         incomplete record should be decoded once the rest of the record has been
+     *         received.
+     * \return An error code if decoding failed.
+     */
+    auto decode( Output_Stream & stream, std::uint8_t const * begin, std::uint8_t const * end ) const noexcept
+        -> Result<std::uint8_t const *>
+    {
+        while ( begin != end ) {
+            auto const size = *begin;
+
+            if ( static_cast<std::size_t>( end - begin ) <= size ) {
+                break;
+            } // if
+
+            auto const result = decode_record( stream, begin + 1, begin + 1 + size );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            begin += 1 + size;
+        } // while
+
+        return begin;
+    }
+
+  private:
+    /**
+     * \brief Record argument.
+     */
+    struct Argument {
+        /**
+         * \brief The argument's type.
+         */
+        Argument_Type type;
+
+        /**
+         * \brief The argument's value.
+         */
+        std::uint64_t value;
+    };
+
+    /**
+     * \brief The beginning of the dictionary.
+     */
+    char const * const * m_begin;
+
+    /**
+     * \brief The end of the dictionary.
+     */
+    char const * const * m_end;
+
+    /**
+     * \brief Look up a format string.
+     *
+     * \param[in] id The format string's ID.
+     *
+     * \return The format string if the format string is in the dictionary.
+     * \return nullptr if the format string is not in the dictionary.
+     */
+    auto lookup( Format_String_ID id ) const noexcept -> char const *
+    {
+        if ( id == DROPPED_RECORDS_FORMAT_STRING_ID ) {
+            return DROPPED_RECORDS_FORMAT_STRING;
+        } // if
+
+        for ( auto format = m_begin; format != m_end; ++format ) {
+            if ( format_string_id( *format ) == id ) {
+                return *format;
+            } // if
+        }     // for
+
+        return nullptr;
+    }
+
+    /**
+     * \brief Extract an argument from a record.
+     *
+     * \param[in] begin The beginning of the argument.
+     * \param[in] end The end of the record.
+     * \param[out] argument The extracted argument.
+     *
+     * \return The end of the argument if the argument is well formed.
+     * \return nullptr if the argument is malformed.
+     */
+    static auto extract( std::uint8_t const * begin, std::uint8_t const * end, Argument & argument ) noexcept
+        -> std::uint8_t const *
+    {
+        if ( begin == end or *begin > static_cast<std::uint8_t>( Argument_Type::INT64 ) ) {
+            return nullptr;
+        } // if
+
+        argument.type = static_cast<Argument_Type>( *begin );
+        ++begin;
+
+        auto const size = argument_size( argument.type );
+
+        if ( static_cast<std::size_t>( end - begin ) < size ) {
+            return nullptr;
+        } // if
+
+        argument.value = 0;
+        for ( auto i = std::uint_fast8_t{ 0 }; i < size; ++i ) {
+            argument.value |= std::uint64_t{ begin[ i ] } << ( i * std::numeric_limits<std::uint8_t>::digits );
+        } // for
+
+        return begin + size;
+    }
+
+    /**
+     * \brief Parse a replacement field.
+     *
+     * \param[in] field The character following the replacement field's opening brace.
+     * \param[out] conversion The replacement field's conversion ('\0' if the replacement
+     *             field does not specify a conversion).
+     *
+     * \return The end of the replacement field if the replacement field is well formed.
+     * \return nullptr if the replacement field is malformed.
+     */
+    static auto parse( char const * field, char & conversion ) noexcept -> char const *
+    {
+        conversion = '\0';
+
+        if ( *field == ':' ) {
+            ++field;
+
+            switch ( *field ) {
+                case 'b':
+                case 'd':
+                case 'x': conversion = *field; break;
+                default: return nullptr;
+            } // switch
+
+            ++field;
+        } // if
+
+        if ( *field != '}' ) {
+            return nullptr;
+        } // if
+
+        return field + 1;
+    }
+
+    /**
+     * \brief Check if a record matches its format string.
+     *
+     * \param[in] format The record's format string.
+     * \param[in] begin The beginning of the record's arguments.
+     * \param[in] end The end of the record's arguments.
+     *
+     * \return true if the record matches its format string.
+     * \return false if the record does not match its format string.
+     */
+    static auto matches( char const * format, std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> bool
+    {
+        while ( *format ) {
+            if ( format[ 0 ] == '{' and format[ 1 ] == '{' ) {
+                format += 2;
+            } else if ( format[ 0 ] == '}' ) {
+                if ( format[ 1 ] != '}' ) {
+                    return false;
+                } // if
+
+                format += 2;
+            } else if ( format[ 0 ] == '{' ) {
+                auto conversion = char{};
+                auto argument   = Argument{};
+
+                format = parse( format + 1, conversion );
+                begin  = extract( begin, end, argument );
+
+                if ( not format or not begin ) {
+                    return false;
+                } // if
+            } else {
+                ++format;
+            } // else
+        }     // while
+
+        return begin == end;
+    }
+
+    /**
+     * \brief Write a formatted integer argument to a stream.
+     *
+     * \tparam Integer The argument's integer type.
+     *
+     * \param[in] stream The output stream to write the formatted argument to.
+     * \param[in] value The argument's value.
+     * \param[in] conversion The argument's replacement field conversion.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    template<typename Integer>
+    static auto print( Output_Stream & stream, std::uint64_t value, char conversion ) noexcept
+        -> Result<std::size_t>
+    {
+        auto const integer = static_cast<Integer>( static_cast<std::make_unsigned_t<Integer>>( value ) );
+
+        switch ( conversion ) {
+            case 'b': return Output_Formatter<Format::Bin<Integer>>{}.print( stream, integer );
+            case 'x': return Output_Formatter<Format::Hex<Integer>>{}.print( stream, integer );
+            default: return Output_Formatter<Format::Dec<Integer>>{}.print( stream, integer );
+        } // switch
+    }
+
+    /**
+     * \brief Write a formatted argument to a stream.
+     *
+     * \param[in] stream The output stream to write the formatted argument to.
+     * \param[in] argument The argument.
+     * \param[in] conversion The argument's replacement field conversion.
+     *
+     * \return The number of characters written to the stream if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    static auto print( Output_Stream & stream, Argument const & argument, char conversion ) noexcept
+        -> Result<std::size_t>
+    {
+        switch ( argument.type ) {
+            case Argument_Type::CHAR:
+                if ( not conversion ) {
+                    auto const result = stream.put( static_cast<char>( argument.value ) );
+                    if ( result.is_error() ) {
+                        return result.error();
+                    } // if
+
+                    return std::size_t{ 1 };
+                } // if
+
+                return print<char>( stream, argument.value, conversion );
+            case Argument_Type::UINT8: return print<std::uint8_t>( stream, argument.value, conversion );
+            case Argument_Type::INT8: return print<std::int8_t>( stream, argument.value, conversion );
+            case Argument_Type::UINT16:
+                return print<std::uint16_t>( stream, argument.value, conversion );
+            case Argument_Type::INT16: return print<std::int16_t>( stream, argument.value, conversion );
+            case Argument_Type::UINT32:
+                return print<std::uint32_t>( stream, argument.value, conversion );
+            case Argument_Type::INT32: return print<std::int32_t>( stream, argument.value, conversion );
+            case Argument_Type::UINT64:
+                return print<std::uint64_t>( stream, argument.value, conversion );
+            case Argument_Type::INT64: return print<std::int64_t>( stream, argument.value, conversion );
+        } // switch
+
+        return std::size_t{ 0 };
+    }
+
+    /**
+     * \brief Decode a record.
+     *
+     * \param[in] stream The output stream to write the decoded record to.
+     * \param[in] begin The beginning of the record (following the record's size).
+     * \param[in] end The end of the record.
+     *
+     * \return Nothing if decoding succeeded.
+     * \return An error code if decoding failed.
+     */
+    auto decode_record( Output_Stream & stream, std::uint8_t const * begin, std::uint8_t const * end ) const noexcept
+        -> Result<void>
+    {
+        if ( static_cast<std::size_t>( end - begin ) < sizeof( Format_String_ID ) ) {
+            return stream.put( "<malformed deferred log record>\n" );
+        } // if
+
+        auto id = Format_String_ID{ 0 };
+        for ( auto i = std::size_t{ 0 }; i < sizeof( Format_String_ID ); ++i ) {
+            id |= Format_String_ID{ begin[ i ] } << ( i * std::numeric_limits<std::uint8_t>::digits );
+        } // for
+        begin += sizeof( Format_String_ID );
+
+        auto format = lookup( id );
+
+        if ( not format ) {
+            auto const result = stream.print(
+                "<unknown deferred log format string ID ", Format::Hex{ id }, ">\n" );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            return {};
+        } // if
+
+        if ( not matches( format, begin, end ) ) {
+            return stream.put( "<malformed deferred log record>\n" );
+        } // if
+
+        while ( *format ) {
+            auto literal_end = format;
+            while ( *literal_end and *literal_end != '{' and *literal_end != '}' ) {
+                ++literal_end;
+            } // while
+
+            if ( literal_end != format ) {
+                auto const result = stream.put( format, literal_end );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+
+                format = literal_end;
+            } else if ( format[ 0 ] == format[ 1 ] ) {
+                auto const result = stream.put( format[ 0 ] );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+
+                format += 2;
+            } else {
+                auto conversion = char{};
+                auto argument   = Argument{};
+
+                format = parse( format + 1, conversion );
+                begin  = extract( begin, end, argument );
+
+                auto const result = print( stream, argument, conversion );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            } // else
+        }     // while
+
+        return stream.put( '\n' );
+    }
+};
+
+/**
+ * \brief Log level.
+ *
+ * Enumerators are prefixed so that they do not collide with commonly defined macros
+ * (e.g. DEBUG, or ERROR from <windows.h>).
+ */
+enum class Level : std::uint_fast8_t {
+    LEVEL_OFF,   ///< Off.
+    LEVEL_ERROR, ///< Error.
+    LEVEL_WARN,  ///< Warning.
+    LEVEL_INFO,  ///< Informational.
+    LEVEL_DEBUG, ///< Debug.
+    LEVEL_TRACE, ///< Trace.
+};
+
+/**
+ * \brief Check if a string matches a null-terminated string.
+ *
+ * \param[in] begin The beginning of the string.
+ * \param[in] end The end of the string.
+ * \param[in] string The null-terminated string.
+ *
+ * \return true if the strings match.
+ * \return false if the strings do not match.
+ */
+constexpr auto matches( char const * begin, char const * end, char const * string ) noexcept -> bool
+{
+    for ( ; begin != end; ++begin, ++string ) {
+        if ( *begin != *string ) {
+            return false;
+        } // if
+    }     // for
+
+    return not *string;
+}
+
+/**
+ * \brief Parse a log level name.
+ *
+ * \param[in] begin The beginning of the log level name.
+ * \param[in] end The end of the log level name.
+ * \param[out] level The parsed log level.
+ *
+ * \return true if the log level name is valid.
+ * \return false if the log level name is not valid.
+ */
+constexpr auto parse_level( char const * begin, char const * end, Level & level ) noexcept -> bool
+{
+    constexpr struct {
+        char const * name;
+        Level        level;
+    } levels[]{
+        // clang-format off
+
+        { "OFF",   Level::LEVEL_OFF   },
+        { "ERROR", Level::LEVEL_ERROR },
+        { "WARN",  Level::LEVEL_WARN  },
+        { "INFO",  Level::LEVEL_INFO  },
+        { "DEBUG", Level::LEVEL_DEBUG },
+        { "TRACE", Level::LEVEL_TRACE },
+
+        // clang-format on
+    };
+
+    for ( auto const & entry : levels ) {
+        if ( matches( begin, end, entry.name ) ) {
+            level = entry.level;
+
+            return true;
+        } // if
+    }     // for
+
+    return false;
+}
+
+/**
+ * \brief Look up a module's log level.
+ *
+ * \param[in] module_levels The null-terminated, comma separated list of
+ *            "<module>=<level>" pairs to search.
+ * \param[in] module The module's null-terminated name.
+ * \param[in] default_level The log level to use if the module is not in the list.
+ *
+ * \return The module's log level.
+ */
+constexpr auto module_level( char const * module_levels, char const * module, Level default_level ) noexcept
+    -> Level
+{
+    for ( auto entry = module_levels; *entry; ) {
+        auto name_end = entry;
+        while ( *name_end and *name_end != '=' and *name_end != ',' ) {
+            ++name_end;
+        } // while
+
+        auto const level_begin = *name_end == '=' ? name_end + 1 : name_end;
+
+        auto entry_end = level_begin;
+        while ( *entry_end and *entry_end != ',' ) {
+            ++entry_end;
+        } // while
+
+        auto level = default_level;
+        if ( matches( entry, name_end, module ) and parse_level( level_begin, entry_end, level ) ) {
+            return level;
+        } // if
+
+        entry = *entry_end ? entry_end + 1 : entry_end;
+    } // for
+
+    return default_level;
+}
+
+/**
+ * \brief Parse the default log level (see PICOLIBRARY_LOG_LEVEL).
+ *
+ * \param[out] level The parsed default log level.
+ *
+ * \return true if the default log level name is valid.
+ * \return false if the default log level name is not valid.
+ */
+constexpr auto parse_default_level( Level & level ) noexcept -> bool
+{
+    constexpr char const name[] = PICOLIBRARY_LOG_LEVEL;
+
+    return parse_level( name, name + sizeof( name ) - 1, level );
+}
+
+static_assert(
+    [] {
+        auto level = Level::LEVEL_OFF;
+        return parse_default_level( level );
+    }(),
+    "PICOLIBRARY_LOG_LEVEL is not a valid log level name" );
+
+/**
+ * \brief Get the default log level (see PICOLIBRARY_LOG_LEVEL).
+ *
+ * \return The default log level.
+ */
+constexpr auto default_level() noexcept -> Level
+{
+    auto level = Level::LEVEL_OFF;
+
+    static_cast<void>( parse_default_level( level ) );
+
+    return level;
+}
+
+/**
+ * \brief Check if a log level is enabled for a module.
+ *
+ * \param[in] level The log level.
+ * \param[in] module The module's null-terminated name.
+ *
+ * \return true if the log level is enabled for the module.
+ * \return false if the log level is not enabled for the module.
+ */
+constexpr auto is_enabled( Level level, char const * module ) noexcept -> bool
+{
+    return level != Level::LEVEL_OFF
+           and level <= module_level( PICOLIBRARY_LOG_MODULE_LEVELS, module, default_level() );
+}
+
+/**
+ * \brief Write a log statement to an output stream.
+ *
+ * \tparam Source The format string source.
+ * \tparam Types The types of the values to format.
+ *
+ * \param[in] stream The output stream to write the log statement to.
+ * \param[in] string The log statement's format string and values.
+ *
+ * \return Nothing if the write succeeded.
+ * \return An error code if the write failed.
+ */
+template<typename Source, typename... Types>
+auto write( Output_Stream & stream, Format::String<Source, Types...> const & string ) noexcept -> Result<void>
+{
+    auto const result = stream.print( string, '\n' );
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    return {};
+}
+
+/**
+ * \brief Write a log statement to an output stream.
+ *
+ * \tparam Source The format string source.
+ * \tparam Types The types of the values to format.
+ *
+ * \param[in] stream The output stream to write the log statement to.
+ * \param[in] string The log statement's format string and values.
+ */
+template<typename Source, typename... Types>
+void write( Reliable_Output_Stream & stream, Format::String<Source, Types...> const & string ) noexcept
+{
+    stream.print( string, '\n' );
+}
+
+/**
+ * \brief Write a log statement to a deferred log.
+ *
+ * \tparam Size_Type The unsigned integer type used to track the number of bytes stored
+ *         in the deferred log's circular buffer.
+ * \tparam N The maximum number of bytes the deferred log's circular buffer is able to
+ *         hold.
+ * \tparam Source The format string source.
+ * \tparam Types The types of the values to log.
+ *
+ * \param[in] log The deferred log to write the log statement to.
+ * \param[in] string The log statement's format string and values.
+ *
+ * \return true if the log statement was written to the deferred log.
+ * \return false if the log statement was dropped because the deferred log is full.
+ */
+template<typename Size_Type, Size_Type N, typename Source, typename... Types>
+auto write( Deferred_Log<Size_Type, N> & log, Format::String<Source, Types...> const & string ) noexcept -> bool
+{
+    return log.write( string );
+}
+
+} // namespace picolibrary::Log
+
+/**
+ * \brief Write a log statement if the log statement's level is enabled for the log
+ *        statement's module.
+ *
+ * If the log statement's level is not enabled, the log statement is discarded at compile
+ * time: its values are not evaluated and its format string is not placed in ROM. The log
+ * statement's format string is prefixed with the log statement's level (e.g. "[INFO] ").
+ *
+ * The level argument is only ever stringized or token pasted (to form the
+ * picolibrary::Log::Level enumerator), so it is never macro expanded. Log statements
+ * therefore work even if a level name is defined as a macro (e.g. DEBUG, or ERROR from
+ * <windows.h>).
+ *
+ * \param[in] level The log statement's level (ERROR, WARN, INFO, DEBUG, or TRACE).
+ * \param[in] module The log statement's module (string literal).
+ * \param[in] sink The output stream or deferred log to write the log statement to.
+ * \param[in] format The log statement's format string literal (see PICOLIBRARY_FORMAT()).
+ * \param[in] ... The values to format.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PICOLIBRARY_LOG( level, module, sink, format, ... )                               \
+    do {                                                                                  \
+        if constexpr ( ::picolibrary::Log::is_enabled(                                    \
+                           ::picolibrary::Log::Level::LEVEL_##level, module ) ) {         \
+            static_cast<void>( ::picolibrary::Log::write(                                 \
+                sink, PICOLIBRARY_FORMAT( "[" #level "] " format, ##__VA_ARGS__ ) ) );    \
+        }                                                                                 \
+    } while ( false )
+
+/**
+ * \brief Write an error log statement.
+ *
+ * \param[in] module The log statement's module (string literal).
+ * \param[in] sink The output stream or deferred log to write the log statement to.
+ * \param[in] format The log statement's format string literal (see PICOLIBRARY_FORMAT()).
+ * \param[in] ... The values to format.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PICOLIBRARY_LOG_ERROR( module, sink, format, ... ) \
+    PICOLIBRARY_LOG( ERROR, module, sink, format, ##__VA_ARGS__ )
+
+/**
+ * \brief Write a warning log statement.
+ *
+ * \param[in] module The log statement's module (string literal).
+ * \param[in] sink The output stream or deferred log to write the log statement to.
+ * \param[in] format The log statement's format string literal (see PICOLIBRARY_FORMAT()).
+ * \param[in] ... The values to format.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PICOLIBRARY_LOG_WARN( module, sink, format, ... ) \
+    PICOLIBRARY_LOG( WARN, module, sink, format, ##__VA_ARGS__ )
+
+/**
+ * \brief Write an informational log statement.
+ *
+ * \param[in] module The log statement's module (string literal).
+ * \param[in] sink The output stream or deferred log to write the log statement to.
+ * \param[in] format The log statement's format string literal (see PICOLIBRARY_FORMAT()).
+ * \param[in] ... The values to format.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PICOLIBRARY_LOG_INFO( module, sink, format, ... ) \
+    PICOLIBRARY_LOG( INFO, module, sink, format, ##__VA_ARGS__ )
+
+/**
+ * \brief Write a debug log statement.
+ *
+ * \param[in] module The log statement's module (string literal).
+ * \param[in] sink The output stream or deferred log to write the log statement to.
+ * \param[in] format The log statement's format string literal (see PICOLIBRARY_FORMAT()).
+ * \param[in] ... The values to format.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PICOLIBRARY_LOG_DEBUG( module, sink, format, ... ) \
+    PICOLIBRARY_LOG( DEBUG, module, sink, format, ##__VA_ARGS__ )
+
+/**
+ * \brief Write a trace log statement.
+ *
+ * \param[in] module The log statement's module (string literal).
+ * \param[in] sink The output stream or deferred log to write the log statement to.
+ * \param[in] format The log statement's format string literal (see PICOLIBRARY_FORMAT()).
+ * \param[in] ... The values to format.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define PICOLIBRARY_LOG_TRACE( module, sink, format, ... ) \
+    PICOLIBRARY_LOG( TRACE, module, sink, format, ##__VA_ARGS__ )
+
+#endif // PICOLIBRARY_LOG_H
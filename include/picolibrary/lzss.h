@@ -0,0 +1,685 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::LZSS interface.
+ */
+
+#ifndef PICOLIBRARY_LZSS_H
+#define PICOLIBRARY_LZSS_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/array.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+
+/**
+ * \brief Lempel-Ziv-Storer-Szymanski (LZSS) compression facilities.
+ *
+ * The compressed data format is a bit stream (most significant bit first) of tokens:
+ * - A literal token is a 1 tag bit followed by the 8 bit literal byte.
+ * - A back-reference token is a 0 tag bit followed by a WINDOW_BITS bit index field
+ *   (offset - 1) and a LOOKAHEAD_BITS bit count field (length - match length minimum).
+ * - A sync token is a back-reference token with all count field bits set. The remaining
+ *   bits of the byte that contains the end of a sync token are padding.
+ */
+namespace picolibrary::LZSS {
+
+/**
+ * \brief LZSS parameters.
+ *
+ * \tparam WINDOW_BITS The number of bits used to encode a back-reference's offset (the
+ *         window size is 2^WINDOW_BITS bytes).
+ * \tparam LOOKAHEAD_BITS The number of bits used to encode a back-reference's length.
+ */
+template<std::uint_fast8_t WINDOW_BITS, std::uint_fast8_t LOOKAHEAD_BITS>
+struct Parameters {
+    static_assert( WINDOW_BITS >= 8 and WINDOW_BITS <= 11 );
+    static_assert( LOOKAHEAD_BITS >= 2 and LOOKAHEAD_BITS < WINDOW_BITS );
+
+    /**
+     * \brief The window size.
+     */
+    static constexpr auto WINDOW_SIZE = std::size_t{ 1 } << WINDOW_BITS;
+
+    /**
+     * \brief The minimum back-reference length (the shortest back-reference that is
+     *        shorter than the equivalent literal tokens).
+     */
+    static constexpr auto MATCH_LENGTH_MIN = std::size_t{ ( 1 + WINDOW_BITS + LOOKAHEAD_BITS ) / 9 + 1 };
+
+    /**
+     * \brief The sync token count field.
+     */
+    static constexpr auto SYNC = ( std::uint_fast16_t{ 1 } << LOOKAHEAD_BITS ) - 1;
+
+    /**
+     * \brief The maximum back-reference length.
+     */
+    static constexpr auto MATCH_LENGTH_MAX = MATCH_LENGTH_MIN + SYNC - 1;
+};
+
+/**
+ * \brief LZSS encoder I/O stream device access buffer.
+ *
+ * Data written to the buffer is compressed and the compressed data is written to the
+ * downstream buffer. Data is buffered until a full lookahead (the maximum back-reference
+ * length) is available. Flushing the buffer compresses all buffered data, completes the
+ * current byte of compressed data with a sync token (if needed), and then flushes the
+ * downstream buffer, so that everything written before the flush can be decompressed.
+ *
+ * \tparam WINDOW_BITS The number of bits used to encode a back-reference's offset (the
+ *         window size is 2^WINDOW_BITS bytes, 256 B to 2 KiB).
+ * \tparam LOOKAHEAD_BITS The number of bits used to encode a back-reference's length.
+ */
+template<std::uint_fast8_t WINDOW_BITS, std::uint_fast8_t LOOKAHEAD_BITS = 4>
+class Encoder_Stream_Buffer final : public Stream_Buffer {
+  public:
+    /**
+     * \brief The LZSS parameters.
+     */
+    using Parameters = ::picolibrary::LZSS::Parameters<WINDOW_BITS, LOOKAHEAD_BITS>;
+
+    using Stream_Buffer::put;
+
+    Encoder_Stream_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The downstream buffer to write compressed data to.
+     */
+    constexpr Encoder_Stream_Buffer( Stream_Buffer & buffer ) noexcept : m_buffer{ &buffer }
+    {
+    }
+
+    Encoder_Stream_Buffer( Encoder_Stream_Buffer && ) = delete;
+
+    Encoder_Stream_Buffer( Encoder_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Encoder_Stream_Buffer() noexcept = default;
+
+    auto operator=( Encoder_Stream_Buffer && ) = delete;
+
+    auto operator=( Encoder_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Write a character to the put area of the buffer.
+     *
+     * \param[in] character The character to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        return compress( static_cast<std::uint8_t>( character ) );
+    }
+
+    /**
+     * \brief Write an unsigned byte to the put area of the buffer.
+     *
+     * \param[in] value The unsigned byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void> override final
+    {
+        return compress( value );
+    }
+
+    /**
+     * \brief Write a signed byte to the put area of the buffer.
+     *
+     * \param[in] value The signed byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void> override final
+    {
+        return compress( static_cast<std::uint8_t>( value ) );
+    }
+
+    /**
+     * \brief Compress all buffered data, complete the current byte of compressed data,
+     *        and flush the downstream buffer.
+     *
+     * \return Nothing if the flush succeeded.
+     * \return An error code if the flush failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        while ( m_lookahead_size ) {
+            auto result = write_token();
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // while
+
+        if ( m_bit_count ) {
+            {
+                auto result = write_bits( 0, 1 + WINDOW_BITS );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            }
+
+            {
+                auto result = write_bits( Parameters::SYNC, LOOKAHEAD_BITS );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            }
+
+            if ( m_bit_count ) {
+                auto result = write_bits( 0, 8 - m_bit_count );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            }     // if
+        }         // if
+
+        return m_buffer->flush();
+    }
+
+  private:
+    /**
+     * \brief The downstream buffer to write compressed data to.
+     */
+    Stream_Buffer * m_buffer;
+
+    /**
+     * \brief The window (data that has already been compressed).
+     */
+    Array<std::uint8_t, Parameters::WINDOW_SIZE> m_window{};
+
+    /**
+     * \brief The window position that the next compressed byte will be written to.
+     */
+    std::size_t m_window_head{};
+
+    /**
+     * \brief The number of bytes in the window.
+     */
+    std::size_t m_window_size{};
+
+    /**
+     * \brief The lookahead (data that has yet to be compressed).
+     */
+    Array<std::uint8_t, Parameters::MATCH_LENGTH_MAX> m_lookahead{};
+
+    /**
+     * \brief The number of bytes in the lookahead.
+     */
+    std::size_t m_lookahead_size{};
+
+    /**
+     * \brief The byte of compressed data that is being assembled.
+     */
+    std::uint8_t m_byte{};
+
+    /**
+     * \brief The number of bits in the byte of compressed data that is being assembled.
+     */
+    std::uint_fast8_t m_bit_count{};
+
+    /**
+     * \brief Compress a byte.
+     *
+     * \param[in] data The byte to compress.
+     *
+     * \return Nothing if compressing the byte succeeded.
+     * \return An error code if compressing the byte failed.
+     */
+    auto compress( std::uint8_t data ) noexcept -> Result<void>
+    {
+        m_lookahead[ m_lookahead_size ] = data;
+        ++m_lookahead_size;
+
+        if ( m_lookahead_size == Parameters::MATCH_LENGTH_MAX ) {
+            return write_token();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Get a byte that precedes the lookahead or is in the lookahead.
+     *
+     * \param[in] offset The distance to look back from the lookahead position.
+     * \param[in] position The lookahead position.
+     *
+     * \return The byte.
+     */
+    auto source( std::size_t offset, std::size_t position ) const noexcept -> std::uint8_t
+    {
+        if ( position >= offset ) {
+            return m_lookahead[ position - offset ];
+        } // if
+
+        return m_window[ ( m_window_head + Parameters::WINDOW_SIZE - ( offset - position ) )
+                         & ( Parameters::WINDOW_SIZE - 1 ) ];
+    }
+
+    /**
+     * \brief Compress the beginning of the lookahead into a token, and write the token.
+     *
+     * \return Nothing if writing the token succeeded.
+     * \return An error code if writing the token failed.
+     */
+    auto write_token() noexcept -> Result<void>
+    {
+        auto length = std::size_t{};
+        auto offset = std::size_t{};
+
+        for ( auto candidate = std::size_t{ 1 }; candidate <= m_window_size; ++candidate ) {
+            auto candidate_length = std::size_t{};
+            while ( candidate_length < m_lookahead_size
+                    and source( candidate, candidate_length ) == m_lookahead[ candidate_length ] ) {
+                ++candidate_length;
+            } // while
+
+            if ( candidate_length > length ) {
+                length = candidate_length;
+                offset = candidate;
+
+                if ( length == m_lookahead_size ) {
+                    break;
+                } // if
+            }     // if
+        }         // for
+
+        if ( length >= Parameters::MATCH_LENGTH_MIN ) {
+            auto result = write_bits( offset - 1, 1 + WINDOW_BITS );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            result = write_bits( length - Parameters::MATCH_LENGTH_MIN, LOOKAHEAD_BITS );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        } else {
+            length = 1;
+
+            auto result = write_bits( 0x100 | m_lookahead[ 0 ], 9 );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        } // else
+
+        consume( length );
+
+        return {};
+    }
+
+    /**
+     * \brief Move bytes from the beginning of the lookahead to the window.
+     *
+     * \param[in] length The number of bytes to move.
+     */
+    void consume( std::size_t length ) noexcept
+    {
+        for ( auto i = std::size_t{ 0 }; i < length; ++i ) {
+            m_window[ m_window_head ] = m_lookahead[ i ];
+            m_window_head             = ( m_window_head + 1 ) & ( Parameters::WINDOW_SIZE - 1 );
+        } // for
+
+        m_window_size = m_window_size + length < Parameters::WINDOW_SIZE
+                            ? m_window_size + length
+                            : Parameters::WINDOW_SIZE;
+
+        for ( auto i = length; i < m_lookahead_size; ++i ) {
+            m_lookahead[ i - length ] = m_lookahead[ i ];
+        } // for
+
+        m_lookahead_size -= length;
+    }
+
+    /**
+     * \brief Write bits to the downstream buffer.
+     *
+     * \param[in] value The bits to write (right aligned).
+     * \param[in] count The number of bits to write.
+     *
+     * \return Nothing if writing the bits succeeded.
+     * \return An error code if writing the bits failed.
+     */
+    auto write_bits( std::uint_fast16_t value, std::uint_fast8_t count ) noexcept -> Result<void>
+    {
+        while ( count ) {
+            --count;
+
+            m_byte = static_cast<std::uint8_t>( ( m_byte << 1 ) | ( ( value >> count ) & 0b1 ) );
+            ++m_bit_count;
+
+            if ( m_bit_count == 8 ) {
+                auto const byte = m_byte;
+
+                m_byte      = 0;
+                m_bit_count = 0;
+
+                auto result = m_buffer->put( byte );
+                if ( result.is_error() ) {
+                    return result.error();
+                } // if
+            }     // if
+        }         // while
+
+        return {};
+    }
+};
+
+/**
+ * \brief LZSS decoder I/O stream device access buffer.
+ *
+ * Compressed data written to the buffer is decompressed and the decompressed data is
+ * written to the downstream buffer. Flushing the buffer flushes the downstream buffer.
+ *
+ * \tparam WINDOW_BITS The number of bits used to encode a back-reference's offset (must
+ *         match the encoder).
+ * \tparam LOOKAHEAD_BITS The number of bits used to encode a back-reference's length
+ *         (must match the encoder).
+ */
+template<std::uint_fast8_t WINDOW_BITS, std::uint_fast8_t LOOKAHEAD_BITS = 4>
+class Decoder_Stream_Buffer final : public Stream_Buffer {
+  public:
+    /**
+     * \brief The LZSS parameters.
+     */
+    using Parameters = ::picolibrary::LZSS::Parameters<WINDOW_BITS, LOOKAHEAD_BITS>;
+
+    using Stream_Buffer::put;
+
+    Decoder_Stream_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The downstream buffer to write decompressed data to.
+     */
+    constexpr Decoder_Stream_Buffer( Stream_Buffer & buffer ) noexcept : m_buffer{ &buffer }
+    {
+    }
+
+    Decoder_Stream_Buffer( Decoder_Stream_Buffer && ) = delete;
+
+    Decoder_Stream_Buffer( Decoder_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Decoder_Stream_Buffer() noexcept = default;
+
+    auto operator=( Decoder_Stream_Buffer && ) = delete;
+
+    auto operator=( Decoder_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Write a character to the put area of the buffer.
+     *
+     * \param[in] character The character to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        return decompress( static_cast<std::uint8_t>( character ) );
+    }
+
+    /**
+     * \brief Write an unsigned byte to the put area of the buffer.
+     *
+     * \param[in] value The unsigned byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void> override final
+    {
+        return decompress( value );
+    }
+
+    /**
+     * \brief Write a signed byte to the put area of the buffer.
+     *
+     * \param[in] value The signed byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void> override final
+    {
+        return decompress( static_cast<std::uint8_t>( value ) );
+    }
+
+    /**
+     * \brief Flush the downstream buffer.
+     *
+     * \return Nothing if the flush succeeded.
+     * \return An error code if the flush failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        return m_buffer->flush();
+    }
+
+  private:
+    /**
+     * \brief Token field.
+     */
+    enum class Field : std::uint_fast8_t {
+        TAG,     ///< Tag.
+        LITERAL, ///< Literal byte.
+        INDEX,   ///< Back-reference index.
+        COUNT,   ///< Back-reference count.
+    };
+
+    /**
+     * \brief The downstream buffer to write decompressed data to.
+     */
+    Stream_Buffer * m_buffer;
+
+    /**
+     * \brief The window (data that has already been decompressed).
+     */
+    Array<std::uint8_t, Parameters::WINDOW_SIZE> m_window{};
+
+    /**
+     * \brief The window position that the next decompressed byte will be written to.
+     */
+    std::size_t m_window_head{};
+
+    /**
+     * \brief The token field that is being decoded.
+     */
+    Field m_field{ Field::TAG };
+
+    /**
+     * \brief The token field bits that have been decoded.
+     */
+    std::uint_fast16_t m_value{};
+
+    /**
+     * \brief The number of token field bits that have been decoded.
+     */
+    std::uint_fast8_t m_bit_count{};
+
+    /**
+     * \brief The back-reference index.
+     */
+    std::uint_fast16_t m_index{};
+
+    /**
+     * \brief Decompress a byte of compressed data.
+     *
+     * \param[in] data The byte of compressed data to decompress.
+     *
+     * \return Nothing if decompressing the byte succeeded.
+     * \return An error code if decompressing the byte failed.
+     */
+    auto decompress( std::uint8_t data ) noexcept -> Result<void>
+    {
+        for ( auto bit = std::uint_fast8_t{ 8 }; bit; ) {
+            --bit;
+
+            auto const value = static_cast<std::uint_fast16_t>( ( data >> bit ) & 0b1 );
+
+            if ( m_field == Field::TAG ) {
+                m_field     = value ? Field::LITERAL : Field::INDEX;
+                m_value     = 0;
+                m_bit_count = 0;
+
+                continue;
+            } // if
+
+            m_value = ( m_value << 1 ) | value;
+            ++m_bit_count;
+
+            switch ( m_field ) {
+                case Field::LITERAL:
+                    if ( m_bit_count == 8 ) {
+                        m_field = Field::TAG;
+
+                        auto result = write( static_cast<std::uint8_t>( m_value ) );
+                        if ( result.is_error() ) {
+                            return result.error();
+                        } // if
+                    }     // if
+                    break;
+                case Field::INDEX:
+                    if ( m_bit_count == WINDOW_BITS ) {
+                        m_field     = Field::COUNT;
+                        m_index     = m_value;
+                        m_value     = 0;
+                        m_bit_count = 0;
+                    } // if
+                    break;
+                case Field::COUNT:
+                    if ( m_bit_count == LOOKAHEAD_BITS ) {
+                        m_field = Field::TAG;
+
+                        if ( m_value == Parameters::SYNC ) {
+                            return {};
+                        } // if
+
+                        auto result = copy( m_index + 1, m_value + Parameters::MATCH_LENGTH_MIN );
+                        if ( result.is_error() ) {
+                            return result.error();
+                        } // if
+                    }     // if
+                    break;
+                default: break;
+            } // switch
+        }     // for
+
+        return {};
+    }
+
+    /**
+     * \brief Write a decompressed byte to the window and the downstream buffer.
+     *
+     * \param[in] data The decompressed byte.
+     *
+     * \return Nothing if writing the decompressed byte succeeded.
+     * \return An error code if writing the decompressed byte failed.
+     */
+    auto write( std::uint8_t data ) noexcept -> Result<void>
+    {
+        m_window[ m_window_head ] = data;
+        m_window_head             = ( m_window_head + 1 ) & ( Parameters::WINDOW_SIZE - 1 );
+
+        return m_buffer->put( data );
+    }
+
+    /**
+     * \brief Copy a back-reference.
+     *
+     * \param[in] offset The back-reference's offset.
+     * \param[in] length The back-reference's length.
+     *
+     * \return Nothing if copying the back-reference succeeded.
+     * \return An error code if copying the back-reference failed.
+     */
+    auto copy( std::size_t offset, std::size_t length ) noexcept -> Result<void>
+    {
+        for ( ; length; --length ) {
+            auto result = write( m_window[ ( m_window_head + Parameters::WINDOW_SIZE - offset )
+                                           & ( Parameters::WINDOW_SIZE - 1 ) ] );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+        }     // for
+
+        return {};
+    }
+};
+
+/**
+ * \brief LZSS compressing output stream.
+ *
+ * \tparam WINDOW_BITS The number of bits used to encode a back-reference's offset.
+ * \tparam LOOKAHEAD_BITS The number of bits used to encode a back-reference's length.
+ */
+template<std::uint_fast8_t WINDOW_BITS, std::uint_fast8_t LOOKAHEAD_BITS = 4>
+class Compressing_Output_Stream :
+    public Static_Output_Stream<Encoder_Stream_Buffer<WINDOW_BITS, LOOKAHEAD_BITS>> {
+  public:
+    Compressing_Output_Stream() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The downstream buffer to write compressed data to.
+     */
+    Compressing_Output_Stream( Stream_Buffer & buffer ) noexcept : m_encoder{ buffer }
+    {
+        this->set_buffer( &m_encoder );
+    }
+
+    Compressing_Output_Stream( Compressing_Output_Stream && ) = delete;
+
+    Compressing_Output_Stream( Compressing_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Compressing_Output_Stream() noexcept = default;
+
+    auto operator=( Compressing_Output_Stream && ) = delete;
+
+    auto operator=( Compressing_Output_Stream const & ) = delete;
+
+  private:
+    /**
+     * \brief The stream's I/O stream device access buffer.
+     */
+    Encoder_Stream_Buffer<WINDOW_BITS, LOOKAHEAD_BITS> m_encoder;
+};
+
+} // namespace picolibrary::LZSS
+
+#endif // PICOLIBRARY_LZSS_H
@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "picolibrary/bit_manipulation.h"
+#include "picolibrary/debounce.h"
 #include "picolibrary/gpio.h"
 
 /**
@@ -1580,6 +1581,376 @@ class Push_Pull_IO_Pin {
     }
 };
 
+/**
+ * \brief Port snapshot.
+ *
+ * A port snapshot reads the port's state once per scan, debounces it, and detects
+ * debounced state edges for all pins. Pins that are associated with a port snapshot (see
+ * picolibrary::Microchip::MCP23X08::Debounced_Input_Pin) answer state queries from the
+ * snapshot instead of reading the GPIO register.
+ *
+ * Interrupts are only used as a hint that the port's state is changing. Interrupt captures
+ * are never fed to the debouncer since a burst of interrupts caused by a bouncing input
+ * would otherwise be counted as consecutive stable samples. After an interrupt has been
+ * handled, the port should be scanned periodically until a scan is no longer pending.
+ *
+ * \tparam Caching_Driver The type of caching driver used to interact with a
+ *         MCP23008/MCP23S08.
+ * \tparam Debouncer The type of debouncer used to debounce the port's state (e.g.
+ *         picolibrary::Debounce::Multiple_Signals_Debouncer or
+ *         picolibrary::Debounce::Vertical_Counter_Debouncer).
+ */
+template<typename Caching_Driver, typename Debouncer = ::picolibrary::Debounce::Multiple_Signals_Debouncer<std::uint8_t, 4>>
+class Port_Snapshot {
+  public:
+    Port_Snapshot() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] caching_driver The caching driver used to interact with the
+     *            MCP23008/MCP23S08.
+     * \param[in] state The initial debounced state of the port.
+     */
+    constexpr Port_Snapshot( Caching_Driver & caching_driver, std::uint8_t state ) noexcept :
+        m_caching_driver{ &caching_driver },
+        m_sample{ state },
+        m_debouncer{ state }
+    {
+    }
+
+    Port_Snapshot( Port_Snapshot && ) = delete;
+
+    Port_Snapshot( Port_Snapshot const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Port_Snapshot() noexcept = default;
+
+    auto operator=( Port_Snapshot && ) = delete;
+
+    auto operator=( Port_Snapshot const & ) = delete;
+
+    /**
+     * \brief Get the caching driver used to interact with the MCP23008/MCP23S08.
+     *
+     * \return The caching driver used to interact with the MCP23008/MCP23S08.
+     */
+    constexpr auto caching_driver() const noexcept -> Caching_Driver &
+    {
+        return *m_caching_driver;
+    }
+
+    /**
+     * \brief Read the GPIO register and update the snapshot.
+     */
+    void scan() noexcept
+    {
+        update( m_caching_driver->read_gpio() );
+
+        m_scan_pending = m_sample != m_debouncer.state();
+    }
+
+    /**
+     * \brief Handle an interrupt by reading the INTF register and, if an interrupt is
+     *        pending, reading the INTCAP register (which clears the interrupt) and
+     *        marking a scan as pending.
+     *
+     * \attention The interrupt capture is discarded. The snapshot is only updated by
+     *            picolibrary::Microchip::MCP23X08::Port_Snapshot::scan().
+     *
+     * \return true if an interrupt was pending.
+     * \return false if an interrupt was not pending.
+     */
+    auto handle_interrupt() noexcept -> bool
+    {
+        if ( not m_caching_driver->read_intf() ) {
+            return false;
+        } // if
+
+        static_cast<void>( m_caching_driver->read_intcap() );
+
+        m_scan_pending = true;
+
+        return true;
+    }
+
+    /**
+     * \brief Check if a scan is pending (an interrupt has been handled and the most recent
+     *        port state sample has not yet been debounced).
+     *
+     * \return true if a scan is pending.
+     * \return false if a scan is not pending.
+     */
+    constexpr auto scan_pending() const noexcept -> bool
+    {
+        return m_scan_pending;
+    }
+
+    /**
+     * \brief Get the most recent (not debounced) port state sample.
+     *
+     * \return The most recent port state sample.
+     */
+    constexpr auto sample() const noexcept -> std::uint8_t
+    {
+        return m_sample;
+    }
+
+    /**
+     * \brief Get the debounced state of the port.
+     *
+     * \return The debounced state of the port.
+     */
+    constexpr auto state() const noexcept -> std::uint8_t
+    {
+        return m_debouncer.state();
+    }
+
+    /**
+     * \brief Get the pins whose debounced state transitioned from low to high during the
+     *        most recent snapshot update.
+     *
+     * \return The pins whose debounced state transitioned from low to high during the
+     *         most recent snapshot update.
+     */
+    constexpr auto rising_edges() const noexcept -> std::uint8_t
+    {
+        return m_rising_edges;
+    }
+
+    /**
+     * \brief Get the pins whose debounced state transitioned from high to low during the
+     *        most recent snapshot update.
+     *
+     * \return The pins whose debounced state transitioned from high to low during the
+     *         most recent snapshot update.
+     */
+    constexpr auto falling_edges() const noexcept -> std::uint8_t
+    {
+        return m_falling_edges;
+    }
+
+  private:
+    /**
+     * \brief The caching driver used to interact with the MCP23008/MCP23S08.
+     */
+    Caching_Driver * m_caching_driver;
+
+    /**
+     * \brief The most recent port state sample.
+     */
+    std::uint8_t m_sample;
+
+    /**
+     * \brief The port state debouncer.
+     */
+    Debouncer m_debouncer;
+
+    /**
+     * \brief The pins whose debounced state transitioned from low to high during the
+     *        most recent snapshot update.
+     */
+    std::uint8_t m_rising_edges{};
+
+    /**
+     * \brief The pins whose debounced state transitioned from high to low during the
+     *        most recent snapshot update.
+     */
+    std::uint8_t m_falling_edges{};
+
+    /**
+     * \brief The scan pending flag.
+     */
+    bool m_scan_pending{};
+
+    /**
+     * \brief Update the snapshot with a new port state sample.
+     *
+     * \param[in] sample The new port state sample.
+     */
+    constexpr void update( std::uint8_t sample ) noexcept
+    {
+        auto const previous_state = m_debouncer.state();
+
+        m_sample = sample;
+        m_debouncer.debounce( sample );
+
+        auto const changed = static_cast<std::uint8_t>( previous_state ^ m_debouncer.state() );
+
+        m_rising_edges  = changed & m_debouncer.state();
+        m_falling_edges = changed & previous_state;
+    }
+};
+
+/**
+ * \brief Debounced internally pulled-up input pin.
+ *
+ * The pin's state is answered from a port snapshot instead of reading the GPIO register.
+ *
+ * \tparam Caching_Driver The type of caching driver used to interact with a
+ *         MCP23008/MCP23S08.
+ * \tparam Debouncer The type of debouncer used by the port snapshot.
+ */
+template<typename Caching_Driver, typename Debouncer>
+class Debounced_Input_Pin {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Debounced_Input_Pin() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] port_snapshot The snapshot of the port the pin is a member of.
+     * \param[in] mask The mask identifying the pin.
+     */
+    constexpr Debounced_Input_Pin( Port_Snapshot<Caching_Driver, Debouncer> & port_snapshot, std::uint8_t mask ) noexcept :
+        m_port_snapshot{ &port_snapshot },
+        m_mask{ mask },
+        m_pin{ port_snapshot.caching_driver(), mask }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Debounced_Input_Pin( Debounced_Input_Pin && source ) noexcept = default;
+
+    Debounced_Input_Pin( Debounced_Input_Pin const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Debounced_Input_Pin() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Debounced_Input_Pin && expression ) noexcept -> Debounced_Input_Pin & = default;
+
+    auto operator=( Debounced_Input_Pin const & ) = delete;
+
+    /**
+     * \brief Initialize the pin's hardware.
+     *
+     * \param[in] initial_pull_up_state The initial state of the pin's internal pull-up
+     *            resistor.
+     */
+    void initialize( ::picolibrary::GPIO::Initial_Pull_Up_State initial_pull_up_state = ::picolibrary::GPIO::Initial_Pull_Up_State::DISABLED ) noexcept
+    {
+        m_pin.initialize( initial_pull_up_state );
+    }
+
+    /**
+     * \brief Check if the pin's internal pull-up resistor is disabled.
+     *
+     * \return true if the pin's internal pull-up resistor is disabled.
+     * \return false if the pin's internal pull-up resistor is not disabled.
+     */
+    auto pull_up_is_disabled() const noexcept -> bool
+    {
+        return m_pin.pull_up_is_disabled();
+    }
+
+    /**
+     * \brief Check if the pin's internal pull-up resistor is enabled.
+     *
+     * \return true if the pin's internal pull-up resistor is enabled.
+     * \return false if the pin's internal pull-up resistor is not enabled.
+     */
+    auto pull_up_is_enabled() const noexcept -> bool
+    {
+        return m_pin.pull_up_is_enabled();
+    }
+
+    /**
+     * \brief Disable the pin's internal pull-up resistor.
+     */
+    void disable_pull_up() noexcept
+    {
+        m_pin.disable_pull_up();
+    }
+
+    /**
+     * \brief Enable the pin's internal pull-up resistor.
+     */
+    void enable_pull_up() noexcept
+    {
+        m_pin.enable_pull_up();
+    }
+
+    /**
+     * \brief Check if the pin's debounced state is the low state.
+     *
+     * \return true if the pin's debounced state is the low state.
+     * \return false if the pin's debounced state is not the low state.
+     */
+    constexpr auto is_low() const noexcept -> bool
+    {
+        return not is_high();
+    }
+
+    /**
+     * \brief Check if the pin's debounced state is the high state.
+     *
+     * \return true if the pin's debounced state is the high state.
+     * \return false if the pin's debounced state is not the high state.
+     */
+    constexpr auto is_high() const noexcept -> bool
+    {
+        return m_port_snapshot->state() & m_mask;
+    }
+
+    /**
+     * \brief Check if the pin's debounced state transitioned from low to high during the
+     *        most recent port snapshot update.
+     *
+     * \return true if the pin's debounced state transitioned from low to high.
+     * \return false if the pin's debounced state did not transition from low to high.
+     */
+    constexpr auto rising_edge() const noexcept -> bool
+    {
+        return m_port_snapshot->rising_edges() & m_mask;
+    }
+
+    /**
+     * \brief Check if the pin's debounced state transitioned from high to low during the
+     *        most recent port snapshot update.
+     *
+     * \return true if the pin's debounced state transitioned from high to low.
+     * \return false if the pin's debounced state did not transition from high to low.
+     */
+    constexpr auto falling_edge() const noexcept -> bool
+    {
+        return m_port_snapshot->falling_edges() & m_mask;
+    }
+
+  private:
+    /**
+     * \brief The snapshot of the port the pin is a member of.
+     */
+    Port_Snapshot<Caching_Driver, Debouncer> * m_port_snapshot{};
+
+    /**
+     * \brief The mask identifying the pin.
+     */
+    std::uint8_t m_mask{};
+
+    /**
+     * \brief The pin.
+     */
+    Internally_Pulled_Up_Input_Pin<Caching_Driver> m_pin{};
+};
+
 } // namespace picolibrary::Microchip::MCP23X08
 
 #endif // PICOLIBRARY_MICROCHIP_MCP23X08_H
@@ -0,0 +1,899 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary rate limiting interface.
+ */
+
+#ifndef PICOLIBRARY_RATE_LIMITER_H
+#define PICOLIBRARY_RATE_LIMITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "picolibrary/array.h"
+#include "picolibrary/error.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Tick source concept.
+ *
+ * A tick source is typically implemented by a HIL on top of a free running hardware timer
+ * or a periodic (e.g. SysTick) interrupt.
+ */
+class Tick_Source_Concept {
+  public:
+    /**
+     * \brief The unsigned integer type used to store a tick count. Tick counts must wrap
+     *        around when the maximum value of this type is exceeded.
+     */
+    using Tick = std::uint32_t;
+
+    Tick_Source_Concept() = delete;
+
+    Tick_Source_Concept( Tick_Source_Concept && ) = delete;
+
+    Tick_Source_Concept( Tick_Source_Concept const & ) = delete;
+
+    ~Tick_Source_Concept() = delete;
+
+    auto operator=( Tick_Source_Concept && ) = delete;
+
+    auto operator=( Tick_Source_Concept const & ) = delete;
+
+    /**
+     * \brief Get the current tick count.
+     *
+     * \return The current tick count.
+     */
+    auto ticks() const noexcept -> Tick;
+};
+
+/**
+ * \brief Token bucket.
+ *
+ * The bucket holds up to a burst capacity of tokens, and is refilled with a fixed number
+ * of tokens every refill period. The bucket starts full.
+ *
+ * \tparam Tick_Source The type of tick source used to refill the bucket (must meet the
+ *         requirements of picolibrary::Tick_Source_Concept).
+ */
+template<typename Tick_Source>
+class Token_Bucket {
+  public:
+    /**
+     * \brief The unsigned integer type used to store a tick count.
+     */
+    using Tick = typename Tick_Source::Tick;
+
+    static_assert( std::is_unsigned_v<Tick> );
+
+    Token_Bucket() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \pre capacity > 0
+     * \pre refill_tokens > 0
+     * \pre refill_period > 0
+     *
+     * \param[in] tick_source The tick source used to refill the bucket.
+     * \param[in] capacity The maximum number of tokens the bucket can hold (the maximum
+     *            burst size).
+     * \param[in] refill_tokens The number of tokens added to the bucket every refill
+     *            period.
+     * \param[in] refill_period The refill period (in ticks).
+     */
+    Token_Bucket( Tick_Source & tick_source, std::size_t capacity, std::size_t refill_tokens, Tick refill_period ) noexcept
+        :
+        m_tick_source{ &tick_source },
+        m_capacity{ capacity },
+        m_refill_tokens{ refill_tokens },
+        m_refill_period{ refill_period },
+        m_tokens{ capacity },
+        m_refilled{ tick_source.ticks() }
+    {
+        PICOLIBRARY_EXPECT( capacity, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT( refill_tokens, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT( refill_period, Generic_Error::INVALID_ARGUMENT );
+    }
+
+    Token_Bucket( Token_Bucket && ) = delete;
+
+    Token_Bucket( Token_Bucket const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Token_Bucket() noexcept = default;
+
+    auto operator=( Token_Bucket && ) = delete;
+
+    auto operator=( Token_Bucket const & ) = delete;
+
+    /**
+     * \brief Get the maximum number of tokens the bucket can hold.
+     *
+     * \return The maximum number of tokens the bucket can hold.
+     */
+    constexpr auto capacity() const noexcept -> std::size_t
+    {
+        return m_capacity;
+    }
+
+    /**
+     * \brief Refill the bucket, and get the number of tokens in the bucket.
+     *
+     * \return The number of tokens in the bucket.
+     */
+    auto available() noexcept -> std::size_t
+    {
+        refill();
+
+        return m_tokens;
+    }
+
+    /**
+     * \brief Refill the bucket, and consume tokens if enough tokens are available.
+     *
+     * \param[in] tokens The number of tokens to consume.
+     *
+     * \return true if the tokens were consumed.
+     * \return false if not enough tokens were available (no tokens are consumed).
+     */
+    auto consume( std::size_t tokens = 1 ) noexcept -> bool
+    {
+        refill();
+
+        if ( tokens > m_tokens ) {
+            return false;
+        } // if
+
+        m_tokens -= tokens;
+
+        return true;
+    }
+
+  private:
+    /**
+     * \brief The tick source used to refill the bucket.
+     */
+    Tick_Source * m_tick_source;
+
+    /**
+     * \brief The maximum number of tokens the bucket can hold.
+     */
+    std::size_t m_capacity;
+
+    /**
+     * \brief The number of tokens added to the bucket every refill period.
+     */
+    std::size_t m_refill_tokens;
+
+    /**
+     * \brief The refill period (in ticks).
+     */
+    Tick m_refill_period;
+
+    /**
+     * \brief The number of tokens in the bucket.
+     */
+    std::size_t m_tokens;
+
+    /**
+     * \brief The tick count at the end of the most recent refill period.
+     */
+    Tick m_refilled;
+
+    /**
+     * \brief Refill the bucket.
+     */
+    void refill() noexcept
+    {
+        auto const now     = m_tick_source->ticks();
+        auto const periods = static_cast<std::size_t>( static_cast<Tick>( now - m_refilled ) / m_refill_period );
+
+        if ( not periods ) {
+            return;
+        } // if
+
+        if ( periods >= m_capacity or m_capacity - m_tokens <= periods * m_refill_tokens ) {
+            m_tokens   = m_capacity;
+            m_refilled = now;
+
+            return;
+        } // if
+
+        m_tokens += periods * m_refill_tokens;
+        m_refilled += static_cast<Tick>( periods * m_refill_period );
+    }
+};
+
+/**
+ * \brief Message rate limiter.
+ *
+ * A message is the data written to a stream between flushes. Each message consumes one
+ * token when its first byte is written. Messages that are written when no tokens are
+ * available are suppressed (dropped) instead of blocking the writer. The next message
+ * that is not suppressed is preceded by a summary of the suppressed messages
+ * ("<N messages suppressed>\n").
+ *
+ * \tparam Tick_Source The type of tick source used to refill the token bucket.
+ */
+template<typename Tick_Source>
+class Message_Rate_Limiter {
+  public:
+    /**
+     * \brief The maximum summary length.
+     */
+    static constexpr auto SUMMARY_LENGTH_MAX = std::size_t{ 48 };
+
+    Message_Rate_Limiter() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] bucket The token bucket messages consume tokens from.
+     */
+    constexpr Message_Rate_Limiter( Token_Bucket<Tick_Source> & bucket ) noexcept :
+        m_bucket{ &bucket }
+    {
+    }
+
+    Message_Rate_Limiter( Message_Rate_Limiter && ) = delete;
+
+    Message_Rate_Limiter( Message_Rate_Limiter const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Message_Rate_Limiter() noexcept = default;
+
+    auto operator=( Message_Rate_Limiter && ) = delete;
+
+    auto operator=( Message_Rate_Limiter const & ) = delete;
+
+    /**
+     * \brief Get the number of suppressed messages that have not been summarized.
+     *
+     * \return The number of suppressed messages that have not been summarized.
+     */
+    constexpr auto suppressed() const noexcept -> std::size_t
+    {
+        return m_suppressed;
+    }
+
+    /**
+     * \brief Check if data that is part of the current message should be forwarded. If
+     *        the data starts a message, a token is consumed.
+     *
+     * \return true if the data should be forwarded.
+     * \return false if the data should be dropped.
+     */
+    auto admit() noexcept -> bool
+    {
+        if ( not m_message_started ) {
+            m_message_started = true;
+            m_admitted        = m_bucket->consume();
+
+            if ( not m_admitted ) {
+                ++m_suppressed;
+            } // if
+        }     // if
+
+        return m_admitted;
+    }
+
+    /**
+     * \brief Complete the current message.
+     *
+     * \return true if the message was forwarded or no message was started.
+     * \return false if the message was suppressed.
+     */
+    auto complete() noexcept -> bool
+    {
+        auto const forwarded = not m_message_started or m_admitted;
+
+        m_message_started = false;
+
+        return forwarded;
+    }
+
+    /**
+     * \brief Write the summary of the suppressed messages (if any).
+     *
+     * \attention The suppressed message count is not reset. Once the summary has been
+     *            successfully written downstream, call
+     *            picolibrary::Message_Rate_Limiter::clear_suppressed().
+     *
+     * \param[out] begin The beginning of the block to write the summary to (must be able
+     *             to hold picolibrary::Message_Rate_Limiter::SUMMARY_LENGTH_MAX
+     *             characters).
+     *
+     * \return The end of the summary (begin if there are no suppressed messages).
+     */
+    auto summarize( char * begin ) noexcept -> char *
+    {
+        if ( not m_suppressed ) {
+            return begin;
+        } // if
+
+        auto digits = Array<char, 20>{};
+        auto count  = std::size_t{};
+        for ( auto value = m_suppressed; value; value /= 10 ) {
+            digits[ count ] = static_cast<char>( '0' + value % 10 );
+            ++count;
+        } // for
+
+        *begin++ = '<';
+        while ( count ) {
+            *begin++ = digits[ --count ];
+        } // while
+
+        for ( auto string = " messages suppressed>\n"; *string; ++string ) {
+            *begin++ = *string;
+        } // for
+
+        return begin;
+    }
+
+    /**
+     * \brief Reset the suppressed message count after the summary of the suppressed
+     *        messages has been successfully written downstream.
+     */
+    void clear_suppressed() noexcept
+    {
+        m_suppressed = 0;
+    }
+
+  private:
+    /**
+     * \brief The token bucket messages consume tokens from.
+     */
+    Token_Bucket<Tick_Source> * m_bucket;
+
+    /**
+     * \brief The current message has been started.
+     */
+    bool m_message_started{};
+
+    /**
+     * \brief The current message is being forwarded.
+     */
+    bool m_admitted{};
+
+    /**
+     * \brief The number of suppressed messages that have not been summarized.
+     */
+    std::size_t m_suppressed{};
+};
+
+/**
+ * \brief Rate limited I/O stream device access buffer.
+ *
+ * See picolibrary::Message_Rate_Limiter for the rate limiting policy. Flushing a
+ * suppressed message does not flush the downstream buffer.
+ *
+ * \tparam Tick_Source The type of tick source used to refill the token bucket.
+ */
+template<typename Tick_Source>
+class Rate_Limited_Stream_Buffer final : public Stream_Buffer {
+  public:
+    using Stream_Buffer::put;
+
+    Rate_Limited_Stream_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The downstream buffer to write messages to.
+     * \param[in] bucket The token bucket messages consume tokens from.
+     */
+    constexpr Rate_Limited_Stream_Buffer( Stream_Buffer & buffer, Token_Bucket<Tick_Source> & bucket ) noexcept
+        :
+        m_buffer{ &buffer },
+        m_limiter{ bucket }
+    {
+    }
+
+    Rate_Limited_Stream_Buffer( Rate_Limited_Stream_Buffer && ) = delete;
+
+    Rate_Limited_Stream_Buffer( Rate_Limited_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Rate_Limited_Stream_Buffer() noexcept = default;
+
+    auto operator=( Rate_Limited_Stream_Buffer && ) = delete;
+
+    auto operator=( Rate_Limited_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the number of suppressed messages that have not been summarized.
+     *
+     * \return The number of suppressed messages that have not been summarized.
+     */
+    constexpr auto suppressed() const noexcept -> std::size_t
+    {
+        return m_limiter.suppressed();
+    }
+
+    /**
+     * \brief Write a character to the put area of the buffer.
+     *
+     * \param[in] character The character to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded or the message is suppressed.
+     * \return An error code if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        return forward( [ character ]( Stream_Buffer & buffer ) noexcept {
+            return buffer.put( character );
+        } );
+    }
+
+    /**
+     * \brief Write a block of characters to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the put area
+     *            of the buffer.
+     * \param[in] end The end of the block of characters to write to the put area of the
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded or the message is suppressed.
+     * \return An error code if the write failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final
+    {
+        return forward( [ begin, end ]( Stream_Buffer & buffer ) noexcept {
+            return buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the put area of the buffer.
+     *
+     * \param[in] string The null-terminated string to write to the put area of the
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded or the message is suppressed.
+     * \return An error code if the write failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final
+    {
+        return forward( [ string ]( Stream_Buffer & buffer ) noexcept {
+            return buffer.put( string );
+        } );
+    }
+
+    /**
+     * \brief Write an unsigned byte to the put area of the buffer.
+     *
+     * \param[in] value The unsigned byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded or the message is suppressed.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void> override final
+    {
+        return forward( [ value ]( Stream_Buffer & buffer ) noexcept { return buffer.put( value ); } );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of unsigned bytes to write to the put area of
+     *            the buffer.
+     *
+     * \return Nothing if the write succeeded or the message is suppressed.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void> override final
+    {
+        return forward( [ begin, end ]( Stream_Buffer & buffer ) noexcept {
+            return buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a signed byte to the put area of the buffer.
+     *
+     * \param[in] value The signed byte to write to the put area of the buffer.
+     *
+     * \return Nothing if the write succeeded or the message is suppressed.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void> override final
+    {
+        return forward( [ value ]( Stream_Buffer & buffer ) noexcept { return buffer.put( value ); } );
+    }
+
+    /**
+     * \brief Write a block of signed bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of signed bytes to write to the put area of the
+     *            buffer.
+     *
+     * \return Nothing if the write succeeded or the message is suppressed.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t const * begin, std::int8_t const * end ) noexcept -> Result<void> override final
+    {
+        return forward( [ begin, end ]( Stream_Buffer & buffer ) noexcept {
+            return buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Complete the current message, and flush the downstream buffer if the message
+     *        was not suppressed.
+     *
+     * \return Nothing if the flush succeeded or the message was suppressed.
+     * \return An error code if the flush failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        if ( not m_limiter.complete() ) {
+            return {};
+        } // if
+
+        return m_buffer->flush();
+    }
+
+  private:
+    /**
+     * \brief The downstream buffer to write messages to.
+     */
+    Stream_Buffer * m_buffer;
+
+    /**
+     * \brief The message rate limiter.
+     */
+    Message_Rate_Limiter<Tick_Source> m_limiter;
+
+    /**
+     * \brief Forward a put to the downstream buffer if the current message is not
+     *        suppressed.
+     *
+     * \tparam Put The type of put to forward.
+     *
+     * \param[in] put The put to forward.
+     *
+     * \return Nothing if the put succeeded or the message is suppressed.
+     * \return An error code if the put failed.
+     */
+    template<typename Put>
+    auto forward( Put put ) noexcept -> Result<void>
+    {
+        if ( not m_limiter.admit() ) {
+            return {};
+        } // if
+
+        if ( m_limiter.suppressed() ) {
+            Array<char, Message_Rate_Limiter<Tick_Source>::SUMMARY_LENGTH_MAX> summary;
+
+            auto result = m_buffer->put( summary.begin(), m_limiter.summarize( summary.begin() ) );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            m_limiter.clear_suppressed();
+        } // if
+
+        return put( *m_buffer );
+    }
+};
+
+/**
+ * \brief Rate limited reliable I/O stream device access buffer.
+ *
+ * See picolibrary::Message_Rate_Limiter for the rate limiting policy. Flushing a
+ * suppressed message does not flush the downstream buffer.
+ *
+ * \tparam Tick_Source The type of tick source used to refill the token bucket.
+ */
+template<typename Tick_Source>
+class Rate_Limited_Reliable_Stream_Buffer final : public Reliable_Stream_Buffer {
+  public:
+    using Reliable_Stream_Buffer::put;
+
+    Rate_Limited_Reliable_Stream_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] buffer The downstream buffer to write messages to.
+     * \param[in] bucket The token bucket messages consume tokens from.
+     */
+    constexpr Rate_Limited_Reliable_Stream_Buffer( Reliable_Stream_Buffer & buffer, Token_Bucket<Tick_Source> & bucket ) noexcept
+        :
+        m_buffer{ &buffer },
+        m_limiter{ bucket }
+    {
+    }
+
+    Rate_Limited_Reliable_Stream_Buffer( Rate_Limited_Reliable_Stream_Buffer && ) = delete;
+
+    Rate_Limited_Reliable_Stream_Buffer( Rate_Limited_Reliable_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Rate_Limited_Reliable_Stream_Buffer() noexcept = default;
+
+    auto operator=( Rate_Limited_Reliable_Stream_Buffer && ) = delete;
+
+    auto operator=( Rate_Limited_Reliable_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Get the number of suppressed messages that have not been summarized.
+     *
+     * \return The number of suppressed messages that have not been summarized.
+     */
+    constexpr auto suppressed() const noexcept -> std::size_t
+    {
+        return m_limiter.suppressed();
+    }
+
+    /**
+     * \brief Write a character to the put area of the buffer.
+     *
+     * \param[in] character The character to write to the put area of the buffer.
+     */
+    void put( char character ) noexcept override final
+    {
+        forward( [ character ]( Reliable_Stream_Buffer & buffer ) noexcept {
+            buffer.put( character );
+        } );
+    }
+
+    /**
+     * \brief Write a block of characters to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of characters to write to the put area
+     *            of the buffer.
+     * \param[in] end The end of the block of characters to write to the put area of the
+     *            buffer.
+     */
+    void put( char const * begin, char const * end ) noexcept override final
+    {
+        forward( [ begin, end ]( Reliable_Stream_Buffer & buffer ) noexcept {
+            buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the put area of the buffer.
+     *
+     * \param[in] string The null-terminated string to write to the put area of the
+     *            buffer.
+     */
+    void put( char const * string ) noexcept override final
+    {
+        forward( [ string ]( Reliable_Stream_Buffer & buffer ) noexcept { buffer.put( string ); } );
+    }
+
+    /**
+     * \brief Write an unsigned byte to the put area of the buffer.
+     *
+     * \param[in] value The unsigned byte to write to the put area of the buffer.
+     */
+    void put( std::uint8_t value ) noexcept override final
+    {
+        forward( [ value ]( Reliable_Stream_Buffer & buffer ) noexcept { buffer.put( value ); } );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of unsigned bytes to write to the put area of
+     *            the buffer.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept override final
+    {
+        forward( [ begin, end ]( Reliable_Stream_Buffer & buffer ) noexcept {
+            buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a signed byte to the put area of the buffer.
+     *
+     * \param[in] value The signed byte to write to the put area of the buffer.
+     */
+    void put( std::int8_t value ) noexcept override final
+    {
+        forward( [ value ]( Reliable_Stream_Buffer & buffer ) noexcept { buffer.put( value ); } );
+    }
+
+    /**
+     * \brief Write a block of signed bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to the put
+     *            area of the buffer.
+     * \param[in] end The end of the block of signed bytes to write to the put area of the
+     *            buffer.
+     */
+    void put( std::int8_t const * begin, std::int8_t const * end ) noexcept override final
+    {
+        forward( [ begin, end ]( Reliable_Stream_Buffer & buffer ) noexcept {
+            buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Complete the current message, and flush the downstream buffer if the message
+     *        was not suppressed.
+     */
+    void flush() noexcept override final
+    {
+        if ( m_limiter.complete() ) {
+            m_buffer->flush();
+        } // if
+    }
+
+  private:
+    /**
+     * \brief The downstream buffer to write messages to.
+     */
+    Reliable_Stream_Buffer * m_buffer;
+
+    /**
+     * \brief The message rate limiter.
+     */
+    Message_Rate_Limiter<Tick_Source> m_limiter;
+
+    /**
+     * \brief Forward a put to the downstream buffer if the current message is not
+     *        suppressed.
+     *
+     * \tparam Put The type of put to forward.
+     *
+     * \param[in] put The put to forward.
+     */
+    template<typename Put>
+    void forward( Put put ) noexcept
+    {
+        if ( not m_limiter.admit() ) {
+            return;
+        } // if
+
+        if ( m_limiter.suppressed() ) {
+            Array<char, Message_Rate_Limiter<Tick_Source>::SUMMARY_LENGTH_MAX> summary;
+
+            m_buffer->put( summary.begin(), m_limiter.summarize( summary.begin() ) );
+
+            m_limiter.clear_suppressed();
+        } // if
+
+        put( *m_buffer );
+    }
+};
+
+/**
+ * \brief Write data to a stream socket's transmit buffer without exceeding a token
+ *        bucket's rate (one token per byte).
+ *
+ * \tparam Socket The type of socket to write to (must meet the requirements of
+ *         picolibrary::IP::TCP::Client_Concept or
+ *         picolibrary::IP::TCP::Server_Connection_Handler_Concept).
+ * \tparam Tick_Source The type of tick source used to refill the token bucket.
+ *
+ * \param[in] bucket The token bucket to consume tokens from.
+ * \param[in] socket The socket to write to.
+ * \param[in] begin The beginning of the block of data to write to the socket's transmit
+ *            buffer.
+ * \param[in] end The end of the block of data to write to the socket's transmit buffer.
+ *
+ * \return The end of the data that was written to the socket's transmit buffer if writing
+ *         data to the socket's transmit buffer succeeded. At most as many bytes as there
+ *         are tokens available are written.
+ * \return picolibrary::Generic_Error::WOULD_BLOCK if no tokens are available.
+ * \return An error code if the socket reported an error.
+ */
+template<typename Socket, typename Tick_Source>
+auto transmit( Token_Bucket<Tick_Source> & bucket, Socket & socket, std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    -> Result<std::uint8_t const *>
+{
+    auto const tokens = bucket.available();
+    if ( not tokens ) {
+        return Generic_Error::WOULD_BLOCK;
+    } // if
+
+    if ( static_cast<std::size_t>( end - begin ) > tokens ) {
+        end = begin + tokens;
+    } // if
+
+    auto result = socket.transmit( begin, end );
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    static_cast<void>( bucket.consume( static_cast<std::size_t>( result.value() - begin ) ) );
+
+    return result.value();
+}
+
+/**
+ * \brief Transmit a datagram without exceeding a token bucket's rate (one token per
+ *        byte).
+ *
+ * \tparam Socket The type of socket to transmit with (must meet the requirements of
+ *         picolibrary::IP::UDP::Socket_Concept).
+ * \tparam Tick_Source The type of tick source used to refill the token bucket.
+ * \tparam Endpoint The type of endpoint to transmit to.
+ *
+ * \param[in] bucket The token bucket to consume tokens from.
+ * \param[in] socket The socket to transmit with.
+ * \param[in] endpoint The endpoint to transmit the datagram to.
+ * \param[in] begin The beginning of the block of data to transmit.
+ * \param[in] end The end of the block of data to transmit.
+ *
+ * \return Nothing if the datagram was transmitted (the datagram's tokens are consumed).
+ * \return picolibrary::Generic_Error::EXCESSIVE_MESSAGE_SIZE if the datagram is larger
+ *         than the token bucket's capacity (the datagram can never be transmitted).
+ * \return picolibrary::Generic_Error::INSUFFICIENT_CAPACITY if not enough tokens are
+ *         available to transmit the datagram (the datagram should be dropped or
+ *         summarized).
+ * \return An error code if the socket reported an error (no tokens are consumed, e.g.
+ *         picolibrary::Generic_Error::WOULD_BLOCK if the datagram should be retried).
+ */
+template<typename Socket, typename Tick_Source, typename Endpoint>
+auto transmit(
+    Token_Bucket<Tick_Source> & bucket,
+    Socket &                    socket,
+    Endpoint const &            endpoint,
+    std::uint8_t const *        begin,
+    std::uint8_t const *        end ) noexcept -> Result<void>
+{
+    auto const size = static_cast<std::size_t>( end - begin );
+
+    if ( size > bucket.capacity() ) {
+        return Generic_Error::EXCESSIVE_MESSAGE_SIZE;
+    } // if
+
+    if ( size > bucket.available() ) {
+        return Generic_Error::INSUFFICIENT_CAPACITY;
+    } // if
+
+    auto result = socket.transmit( endpoint, begin, end );
+    if ( result.is_error() ) {
+        return result.error();
+    } // if
+
+    static_cast<void>( bucket.consume( size ) );
+
+    return {};
+}
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_RATE_LIMITER_H
@@ -0,0 +1,298 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Scheduler interface.
+ */
+
+#ifndef PICOLIBRARY_SCHEDULER_H
+#define PICOLIBRARY_SCHEDULER_H
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/active_object.h"
+#include "picolibrary/array.h"
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/error.h"
+#include "picolibrary/interrupt.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Cooperative (non-preemptive) run to completion active object scheduler.
+ *
+ * Each active object is assigned a unique priority level (0 is the highest priority).
+ * The scheduler tracks which active objects have events waiting to be processed with a
+ * ready set bitmap, so selecting the highest priority ready active object is a single
+ * find first set operation. Each scheduling step dispatches a single event, so a higher
+ * priority active object that becomes ready is run as soon as the event being processed
+ * has been processed.
+ *
+ * \tparam PRIORITIES The number of priority levels (must be in the range [1, 32]).
+ * \tparam Interrupt_Controller The type of interrupt controller used by the main thread
+ *         of execution to manipulate the interrupt enable state of any interrupts that
+ *         post events to the scheduler's active objects.
+ */
+template<std::uint_fast8_t PRIORITIES, typename Interrupt_Controller>
+class Scheduler final : public Active_Object_Scheduler {
+  public:
+    static_assert( PRIORITIES > 0 and PRIORITIES <= 32 );
+
+    Scheduler() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] interrupt_controller The interrupt controller used by the main thread of
+     *            execution to manipulate the interrupt enable state of interrupts that
+     *            post events to the scheduler's active objects.
+     */
+    Scheduler( Interrupt_Controller interrupt_controller ) noexcept :
+        m_interrupt_controller{ std::move( interrupt_controller ) }
+    {
+    }
+
+    Scheduler( Scheduler && ) = delete;
+
+    Scheduler( Scheduler const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Scheduler() noexcept = default;
+
+    auto operator=( Scheduler && ) = delete;
+
+    auto operator=( Scheduler const & ) = delete;
+
+    /**
+     * \brief Add an active object to the scheduler.
+     *
+     * \pre priority < PRIORITIES
+     * \pre no other active object has been assigned priority
+     *
+     * \tparam Active_Object The type of active object to add.
+     *
+     * \param[in] priority The active object's priority (0 is the highest priority).
+     * \param[in] active_object The active object to add.
+     */
+    template<typename Active_Object>
+    void add( Priority priority, Active_Object & active_object ) noexcept
+    {
+        PICOLIBRARY_EXPECT( priority < PRIORITIES, Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT( not m_tasks[ priority ].active_object, Generic_Error::LOGIC_ERROR );
+
+        m_tasks[ priority ] = Task{
+            &active_object,
+            []( void * object ) noexcept {
+                static_cast<void>( static_cast<Active_Object *>( object )->process_event() );
+            },
+            []( void const * object ) noexcept {
+                return static_cast<Active_Object const *>( object )->has_pending_events();
+            },
+        };
+
+        active_object.attach( *this, priority );
+
+        if ( active_object.has_pending_events() ) {
+            make_ready( priority );
+        } // if
+    }
+
+    /**
+     * \brief Check if any of the scheduler's active objects have events waiting to be
+     *        processed.
+     *
+     * \return true if any of the scheduler's active objects have events waiting to be
+     *         processed.
+     * \return false if none of the scheduler's active objects have events waiting to be
+     *         processed.
+     */
+    auto ready() const noexcept -> bool
+    {
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        return m_ready_set;
+    }
+
+    /**
+     * \brief Dispatch a single event to the highest priority active object that has
+     *        events waiting to be processed.
+     *
+     * \return true if an event was dispatched.
+     * \return false if none of the scheduler's active objects have events waiting to be
+     *         processed.
+     */
+    auto dispatch() noexcept -> bool
+    {
+        auto ready_set = Ready_Set{};
+
+        {
+            auto const guard = Interrupt::Critical_Section_Guard{
+                m_interrupt_controller, Interrupt::RESTORE_INTERRUPT_ENABLE_STATE
+            };
+
+            ready_set = m_ready_set;
+        }
+
+        if ( not ready_set ) {
+            return false;
+        } // if
+
+        auto const priority = lowest_bit_set( ready_set );
+        auto const & task   = m_tasks[ priority ];
+
+        task.process_event( task.active_object );
+
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        if ( not task.has_pending_events( task.active_object ) ) {
+            m_ready_set = static_cast<Ready_Set>( m_ready_set & ~ready_mask( priority ) );
+        } // if
+
+        return true;
+    }
+
+    /**
+     * \brief Execute a single scheduling step: dispatch a single event to the highest
+     *        priority active object that has events waiting to be processed, or call the
+     *        idle hook if none of the scheduler's active objects have events waiting to
+     *        be processed.
+     *
+     * \attention If the idle hook puts the microcontroller to sleep, events posted by
+     *            interrupts that occur after the ready check but before the
+     *            microcontroller goes to sleep will not be processed until the
+     *            microcontroller is woken up by another interrupt. The idle hook must
+     *            either tolerate this latency, or use a sleep mechanism that does not
+     *            sleep if an interrupt is pending.
+     *
+     * \tparam Idle_Hook The type of idle hook (a callable that takes no arguments, e.g.
+     *         a HIL sleep function).
+     *
+     * \param[in] idle_hook The idle hook.
+     */
+    template<typename Idle_Hook>
+    void schedule( Idle_Hook && idle_hook ) noexcept
+    {
+        if ( not dispatch() ) {
+            idle_hook();
+        } // if
+    }
+
+    /**
+     * \brief Run the scheduler (execute scheduling steps forever).
+     *
+     * \tparam Idle_Hook The type of idle hook (a callable that takes no arguments, e.g.
+     *         a HIL sleep function).
+     *
+     * \param[in] idle_hook The idle hook.
+     */
+    template<typename Idle_Hook>
+    [[noreturn]] void run( Idle_Hook idle_hook ) noexcept
+    {
+        for ( ;; ) { schedule( idle_hook ); } // for
+    }
+
+    /**
+     * \copydoc picolibrary::Active_Object_Scheduler::make_ready()
+     */
+    void make_ready( Priority priority ) noexcept override final
+    {
+        auto const guard = Interrupt::Critical_Section_Guard{ m_interrupt_controller,
+                                                              Interrupt::RESTORE_INTERRUPT_ENABLE_STATE };
+
+        make_ready_from_interrupt( priority );
+    }
+
+    /**
+     * \copydoc picolibrary::Active_Object_Scheduler::make_ready_from_interrupt()
+     */
+    void make_ready_from_interrupt( Priority priority ) noexcept override final
+    {
+        m_ready_set = static_cast<Ready_Set>( m_ready_set | ready_mask( priority ) );
+    }
+
+  private:
+    /**
+     * \brief Ready set bitmap (bit N is set if the active object with priority N has
+     *        events waiting to be processed).
+     */
+    using Ready_Set = std::conditional_t<
+        PRIORITIES <= 8,
+        std::uint8_t,
+        std::conditional_t<PRIORITIES <= 16, std::uint16_t, std::uint32_t>>;
+
+    /**
+     * \brief Scheduled active object.
+     */
+    struct Task {
+        /**
+         * \brief The active object (nullptr if no active object has been assigned the
+         *        priority).
+         */
+        void * active_object;
+
+        /**
+         * \brief Dispatch the event at the front of the active object's event queue.
+         */
+        void ( *process_event )( void * active_object ) noexcept;
+
+        /**
+         * \brief Check if the active object has events waiting to be processed.
+         */
+        bool ( *has_pending_events )( void const * active_object ) noexcept;
+    };
+
+    /**
+     * \brief The scheduled active objects (indexed by priority).
+     */
+    Array<Task, PRIORITIES> m_tasks{};
+
+    /**
+     * \brief The ready set.
+     */
+    Ready_Set volatile m_ready_set{ 0 };
+
+    /**
+     * \brief The interrupt controller used by the main thread of execution to manipulate
+     *        the interrupt enable state of interrupts that post events to the scheduler's
+     *        active objects.
+     */
+    mutable Interrupt_Controller m_interrupt_controller;
+
+    /**
+     * \brief Get a priority's ready set mask.
+     *
+     * \param[in] priority The priority.
+     *
+     * \return The priority's ready set mask.
+     */
+    static constexpr auto ready_mask( Priority priority ) noexcept -> Ready_Set
+    {
+        return static_cast<Ready_Set>( Ready_Set{ 1 } << priority );
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_SCHEDULER_H
@@ -0,0 +1,356 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Serialization interface.
+ */
+
+#ifndef PICOLIBRARY_SERIALIZATION_H
+#define PICOLIBRARY_SERIALIZATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "picolibrary/array.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+
+/**
+ * \brief Binary serialization facilities.
+ */
+namespace picolibrary::Serialization {
+
+/**
+ * \brief Byte order.
+ */
+enum class Byte_Order : std::uint_fast8_t {
+    BIG,    ///< Big endian (most significant byte first).
+    LITTLE, ///< Little endian (least significant byte first).
+};
+
+/**
+ * \brief Get the unsigned integer type used to serialize a type.
+ *
+ * \tparam T The type to get the unsigned integer type used to serialize for (must be an
+ *         integral or enum type).
+ */
+template<typename T, typename = void>
+struct serialized_type {
+    static_assert( std::is_integral_v<T> );
+
+    /**
+     * \brief The unsigned integer type used to serialize the type.
+     */
+    using Type = std::make_unsigned_t<T>;
+};
+
+/**
+ * \brief Get the unsigned integer type used to serialize a bool.
+ */
+template<>
+struct serialized_type<bool> {
+    /**
+     * \brief The unsigned integer type used to serialize a bool.
+     */
+    using Type = std::uint8_t;
+};
+
+/**
+ * \brief Get the unsigned integer type used to serialize an enum.
+ *
+ * \tparam T The enum to get the unsigned integer type used to serialize for.
+ */
+template<typename T>
+struct serialized_type<T, std::enable_if_t<std::is_enum_v<T>>> {
+    /**
+     * \brief The unsigned integer type used to serialize the enum.
+     */
+    using Type = typename serialized_type<std::underlying_type_t<T>>::Type;
+};
+
+/**
+ * \brief Get the unsigned integer type used to serialize a type.
+ *
+ * \tparam T The type to get the unsigned integer type used to serialize for.
+ */
+template<typename T>
+using serialized_type_t = typename serialized_type<T>::Type;
+
+/**
+ * \brief Serialize a value.
+ *
+ * \tparam ORDER The byte order to serialize the value in.
+ * \tparam T The type of value to serialize (must be an integral or enum type).
+ *
+ * \param[in] value The value to serialize.
+ * \param[out] begin The beginning of the block to write the serialized value to.
+ *
+ * \return The end of the serialized value.
+ */
+template<Byte_Order ORDER, typename T>
+constexpr auto serialize( T value, std::uint8_t * begin ) noexcept -> std::uint8_t *
+{
+    using Unsigned_Integer = serialized_type_t<T>;
+
+    auto const data = static_cast<Unsigned_Integer>( value );
+
+    for ( auto i = std::size_t{ 0 }; i < sizeof( Unsigned_Integer ); ++i ) {
+        auto const byte = ORDER == Byte_Order::BIG ? sizeof( Unsigned_Integer ) - 1 - i : i;
+
+        begin[ i ] = static_cast<std::uint8_t>( data >> ( byte * std::numeric_limits<std::uint8_t>::digits ) );
+    } // for
+
+    return begin + sizeof( Unsigned_Integer );
+}
+
+/**
+ * \brief Serialize a value.
+ *
+ * \tparam ORDER The byte order to serialize the value in.
+ * \tparam T The type of value to serialize (must be an integral or enum type).
+ *
+ * \param[in] value The value to serialize.
+ *
+ * \return The serialized value.
+ */
+template<Byte_Order ORDER, typename T>
+constexpr auto serialize( T value ) noexcept -> Array<std::uint8_t, sizeof( serialized_type_t<T> )>
+{
+    auto buffer = Array<std::uint8_t, sizeof( serialized_type_t<T> )>{};
+
+    serialize<ORDER>( value, buffer.data() );
+
+    return buffer;
+}
+
+/**
+ * \brief Deserialize a value.
+ *
+ * \tparam ORDER The byte order the value is serialized in.
+ * \tparam T The type of value to deserialize (must be an integral or enum type).
+ *
+ * \param[in] begin The beginning of the serialized value.
+ *
+ * \return The deserialized value.
+ */
+template<Byte_Order ORDER, typename T>
+constexpr auto deserialize( std::uint8_t const * begin ) noexcept -> T
+{
+    using Unsigned_Integer = serialized_type_t<T>;
+
+    auto data = Unsigned_Integer{};
+
+    for ( auto i = std::size_t{ 0 }; i < sizeof( Unsigned_Integer ); ++i ) {
+        auto const byte = ORDER == Byte_Order::BIG ? sizeof( Unsigned_Integer ) - 1 - i : i;
+
+        data |= static_cast<Unsigned_Integer>(
+            static_cast<Unsigned_Integer>( begin[ i ] ) << ( byte * std::numeric_limits<std::uint8_t>::digits ) );
+    } // for
+
+    return static_cast<T>( data );
+}
+
+/**
+ * \brief Get the class and value type of a pointer to data member.
+ *
+ * \tparam T The pointer to data member type.
+ */
+template<typename T>
+struct member_pointer_traits;
+
+/**
+ * \brief Get the class and value type of a pointer to data member.
+ *
+ * \tparam C The class.
+ * \tparam T The value type.
+ */
+template<typename C, typename T>
+struct member_pointer_traits<T C::*> {
+    /**
+     * \brief The class.
+     */
+    using Class = C;
+
+    /**
+     * \brief The value type.
+     */
+    using Value = T;
+};
+
+/**
+ * \brief Record layout.
+ *
+ * A record layout describes the fields of a record once, and generates code to serialize
+ * and deserialize the record. The fields are serialized in the order they are listed,
+ * with no padding. Offsets are computed at compile-time, so serialization and
+ * deserialization have no per-field branches.
+ *
+ * \tparam ORDER The byte order to serialize fields in.
+ * \tparam FIELD The first field (pointer to data member) to serialize.
+ * \tparam FIELDS The remaining fields (pointers to data members of the same class) to
+ *         serialize.
+ */
+template<Byte_Order ORDER, auto FIELD, auto... FIELDS>
+class Layout {
+  public:
+    /**
+     * \brief The record type.
+     */
+    using Record = typename member_pointer_traits<decltype( FIELD )>::Class;
+
+    static_assert( ( std::is_same_v<typename member_pointer_traits<decltype( FIELDS )>::Class, Record> and ... ) );
+
+    /**
+     * \brief The size of a serialized record.
+     */
+    static constexpr auto SIZE = ( sizeof( serialized_type_t<typename member_pointer_traits<decltype( FIELD )>::Value> )
+                                   + ... + sizeof( serialized_type_t<typename member_pointer_traits<decltype( FIELDS )>::Value> ) );
+
+    /**
+     * \brief The buffer type used to store a serialized record.
+     */
+    using Buffer = Array<std::uint8_t, SIZE>;
+
+    Layout() = delete;
+
+    /**
+     * \brief Serialize a record.
+     *
+     * \param[in] record The record to serialize.
+     * \param[out] begin The beginning of the block to write the serialized record to
+     *            (must be able to hold picolibrary::Serialization::Layout::SIZE bytes).
+     *
+     * \return The end of the serialized record.
+     */
+    static constexpr auto serialize( Record const & record, std::uint8_t * begin ) noexcept
+        -> std::uint8_t *
+    {
+        begin = ::picolibrary::Serialization::serialize<ORDER>( record.*FIELD, begin );
+        ( ( begin = ::picolibrary::Serialization::serialize<ORDER>( record.*FIELDS, begin ) ), ... );
+
+        return begin;
+    }
+
+    /**
+     * \brief Serialize a record.
+     *
+     * \param[in] record The record to serialize.
+     *
+     * \return The serialized record.
+     */
+    static constexpr auto serialize( Record const & record ) noexcept -> Buffer
+    {
+        auto buffer = Buffer{};
+
+        serialize( record, buffer.data() );
+
+        return buffer;
+    }
+
+    /**
+     * \brief Serialize a record and write it to a stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] stream The stream to write the serialized record to.
+     * \param[in] record The record to serialize.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    static auto serialize( Output_Stream & stream, Record const & record ) noexcept -> Result<void>
+    {
+        auto const buffer = serialize( record );
+
+        return stream.put( buffer.begin(), buffer.end() );
+    }
+
+    /**
+     * \brief Serialize a record and write it to a stream.
+     *
+     * \param[in] stream The stream to write the serialized record to.
+     * \param[in] record The record to serialize.
+     */
+    static void serialize( Reliable_Output_Stream & stream, Record const & record ) noexcept
+    {
+        auto const buffer = serialize( record );
+
+        stream.put( buffer.begin(), buffer.end() );
+    }
+
+    /**
+     * \brief Deserialize a record.
+     *
+     * \param[in] begin The beginning of the serialized record.
+     * \param[out] record The deserialized record.
+     *
+     * \return The end of the serialized record.
+     */
+    static constexpr auto deserialize( std::uint8_t const * begin, Record & record ) noexcept
+        -> std::uint8_t const *
+    {
+        begin = deserialize_field<FIELD>( begin, record );
+        ( ( begin = deserialize_field<FIELDS>( begin, record ) ), ... );
+
+        return begin;
+    }
+
+    /**
+     * \brief Deserialize a record.
+     *
+     * \param[in] begin The beginning of the serialized record.
+     *
+     * \return The deserialized record.
+     */
+    static constexpr auto deserialize( std::uint8_t const * begin ) noexcept -> Record
+    {
+        auto record = Record{};
+
+        deserialize( begin, record );
+
+        return record;
+    }
+
+  private:
+    /**
+     * \brief Deserialize a field.
+     *
+     * \tparam MEMBER The field to deserialize.
+     *
+     * \param[in] begin The beginning of the serialized field.
+     * \param[out] record The record to write the deserialized field to.
+     *
+     * \return The end of the serialized field.
+     */
+    template<auto MEMBER>
+    static constexpr auto deserialize_field( std::uint8_t const * begin, Record & record ) noexcept
+        -> std::uint8_t const *
+    {
+        using Value = typename member_pointer_traits<decltype( MEMBER )>::Value;
+
+        record.*MEMBER = ::picolibrary::Serialization::deserialize<ORDER, Value>( begin );
+
+        return begin + sizeof( serialized_type_t<Value> );
+    }
+};
+
+} // namespace picolibrary::Serialization
+
+#endif // PICOLIBRARY_SERIALIZATION_H
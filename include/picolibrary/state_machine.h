@@ -30,6 +30,7 @@
 #include "picolibrary/event.h"
 #include "picolibrary/precondition.h"
 #include "picolibrary/rom.h"
+#include "picolibrary/state_machine_tracer.h"
 
 namespace picolibrary {
 
@@ -343,6 +344,25 @@ class State_Machine {
         m_current_state = m_target_state;
     }
 
+    /**
+     * \brief Enable binary tracing.
+     *
+     * \param[in] tracer The tracer to generate dispatch, transition, entry, and exit trace
+     *            records with.
+     */
+    constexpr void enable_tracing( State_Machine_Trace::Tracer & tracer ) noexcept
+    {
+        m_tracer = &tracer;
+    }
+
+    /**
+     * \brief Disable binary tracing.
+     */
+    constexpr void disable_tracing() noexcept
+    {
+        m_tracer = nullptr;
+    }
+
     /**
      * \brief Dispatch an event to the event handler for the currently active state.
      *
@@ -357,16 +377,21 @@ class State_Machine {
     {
         PICOLIBRARY_EXPECT( m_current_state, Generic_Error::LOGIC_ERROR );
 
+        trace( State_Machine_Trace::Record_Type::DISPATCH, m_current_state, event );
+
         switch ( ( *m_current_state )( *this, event ) ) {
-            case Event_Handling_Result::EVENT_HANDLED: return;
+            case Event_Handling_Result::EVENT_HANDLED: break;
             case Event_Handling_Result::STATE_TRANSITION_TRIGGERED:
+                trace( State_Machine_Trace::Record_Type::TRANSITION, m_current_state, event );
                 exit( *m_current_state );
                 enter( *m_target_state );
                 m_current_state = m_target_state;
-                return;
+                break;
             default:
                 PICOLIBRARY_EXPECTATION_NOT_MET( Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
         } // switch
+
+        trace( State_Machine_Trace::Record_Type::DISPATCH_COMPLETE, m_current_state, event );
     }
 
     /**
@@ -423,6 +448,25 @@ class State_Machine {
         State_Event_Handler_Pointer m_target_state;
     };
 
+    /**
+     * \brief The tracer to generate trace records with (nullptr if tracing is disabled).
+     */
+    State_Machine_Trace::Tracer * m_tracer{};
+
+    /**
+     * \brief Generate a trace record if tracing is enabled.
+     *
+     * \param[in] type The record type.
+     * \param[in] state The state event handler for the state the record applies to.
+     * \param[in] event The event the record applies to.
+     */
+    void trace( State_Machine_Trace::Record_Type type, State_Event_Handler_Pointer state, Event const & event ) noexcept
+    {
+        if ( m_tracer ) {
+            m_tracer->trace( type, State_Machine_Trace::state_id( state ), event.id() );
+        } // if
+    }
+
     /**
      * \brief Execute a state's entry actions.
      *
@@ -436,6 +480,8 @@ class State_Machine {
         PICOLIBRARY_EXPECT(
             ( state )( *this, ENTRY ) == Event_Handling_Result::EVENT_HANDLED,
             Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
+
+        trace( State_Machine_Trace::Record_Type::ENTRY, &state, ENTRY );
     }
 
     /**
@@ -451,6 +497,8 @@ class State_Machine {
         PICOLIBRARY_EXPECT(
             ( state )( *this, EXIT ) == Event_Handling_Result::EVENT_HANDLED,
             Generic_Error::UNEXPECTED_EVENT_HANDLING_RESULT );
+
+        trace( State_Machine_Trace::Record_Type::EXIT, &state, EXIT );
     }
 };
 
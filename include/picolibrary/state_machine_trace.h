@@ -0,0 +1,513 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::State_Machine_Trace interface.
+ */
+
+#ifndef PICOLIBRARY_STATE_MACHINE_TRACE_H
+#define PICOLIBRARY_STATE_MACHINE_TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "picolibrary/array.h"
+#include "picolibrary/bit_manipulation.h"
+#include "picolibrary/circular_buffer.h"
+#include "picolibrary/event.h"
+#include "picolibrary/fixed_capacity_vector.h"
+#include "picolibrary/result.h"
+#include "picolibrary/serialization.h"
+#include "picolibrary/state_machine_tracer.h"
+#include "picolibrary/stream.h"
+
+/**
+ * \brief State machine binary tracing facilities.
+ */
+namespace picolibrary::State_Machine_Trace {
+
+/**
+ * \brief Trace record.
+ */
+struct Record {
+    /**
+     * \brief The record type.
+     */
+    Record_Type type;
+
+    /**
+     * \brief The ID of the event being dispatched (or the pseudo-event ID for entry and
+     *        exit records).
+     */
+    Event_ID event;
+
+    /**
+     * \brief The tick count when the record was generated.
+     */
+    std::uint32_t timestamp;
+
+    /**
+     * \brief The state the record applies to (see
+     *        picolibrary::State_Machine_Trace::state_id()).
+     */
+    State_ID state;
+};
+
+/**
+ * \brief Trace record binary layout (10 bytes on all targets, little endian).
+ */
+using Record_Layout = Serialization::
+    Layout<Serialization::Byte_Order::LITTLE, &Record::type, &Record::event, &Record::timestamp, &Record::state>;
+
+static_assert( Record_Layout::SIZE == 10 );
+
+/**
+ * \brief Trace ring buffer.
+ *
+ * Records are timestamped with a tick source, and stored in binary form. When the buffer
+ * is full, the oldest record is overwritten.
+ *
+ * \attention Traced state machines must only dispatch events from the main thread of
+ *            execution.
+ *
+ * \tparam Tick_Source The type of tick source used to timestamp records (must meet the
+ *         requirements of picolibrary::Tick_Source_Concept).
+ * \tparam Size_Type The unsigned integer type used to track the number of records in the
+ *         buffer.
+ * \tparam N The maximum number of records in the buffer (must be a power of two).
+ */
+template<typename Tick_Source, typename Size_Type, Size_Type N>
+class Buffer final : public Tracer {
+  public:
+    /**
+     * \brief The number of records in the buffer.
+     */
+    using Size = Size_Type;
+
+    Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] tick_source The tick source used to timestamp records.
+     */
+    constexpr Buffer( Tick_Source const & tick_source ) noexcept : m_tick_source{ &tick_source }
+    {
+    }
+
+    Buffer( Buffer && ) = delete;
+
+    Buffer( Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Buffer() noexcept = default;
+
+    auto operator=( Buffer && ) = delete;
+
+    auto operator=( Buffer const & ) = delete;
+
+    /**
+     * \copydoc picolibrary::State_Machine_Trace::Tracer::trace()
+     */
+    void trace( Record_Type type, State_ID state, Event_ID event ) noexcept override final
+    {
+        if ( m_records.full() ) {
+            m_records.pop();
+
+            ++m_overwritten;
+        } // if
+
+        m_records.push( Record{ type, event, static_cast<std::uint32_t>( m_tick_source->ticks() ), state } );
+    }
+
+    /**
+     * \brief Check if the buffer is empty.
+     *
+     * \return true if the buffer is empty.
+     * \return false if the buffer is not empty.
+     */
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+        return m_records.empty();
+    }
+
+    /**
+     * \brief Get the number of records in the buffer.
+     *
+     * \return The number of records in the buffer.
+     */
+    auto size() const noexcept -> Size
+    {
+        return m_records.size();
+    }
+
+    /**
+     * \brief Get the number of records that have been overwritten since the buffer was
+     *        constructed.
+     *
+     * \return The number of records that have been overwritten since the buffer was
+     *         constructed.
+     */
+    auto overwritten() const noexcept -> std::uint32_t
+    {
+        return m_overwritten;
+    }
+
+    /**
+     * \brief Access the oldest record in the buffer.
+     *
+     * \warning Calling this function on an empty buffer results in undefined behavior.
+     *
+     * \return The oldest record in the buffer.
+     */
+    auto front() const noexcept -> Record const &
+    {
+        return m_records.front();
+    }
+
+    /**
+     * \brief Remove the oldest record from the buffer.
+     *
+     * \pre not picolibrary::State_Machine_Trace::Buffer::empty()
+     */
+    void pop() noexcept
+    {
+        m_records.pop();
+    }
+
+    /**
+     * \brief Serialize the records in the buffer, write them to a stream, and remove them
+     *        from the buffer.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] stream The stream to write the serialized records to.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed (records that were not written remain in
+     *         the buffer).
+     */
+    auto flush( Output_Stream & stream ) noexcept -> Result<void>
+    {
+        while ( not m_records.empty() ) {
+            auto result = Record_Layout::serialize( stream, m_records.front() );
+            if ( result.is_error() ) {
+                return result.error();
+            } // if
+
+            m_records.pop();
+        } // while
+
+        return {};
+    }
+
+    /**
+     * \brief Serialize the records in the buffer, write them to a stream, and remove them
+     *        from the buffer.
+     *
+     * \param[in] stream The stream to write the serialized records to.
+     */
+    void flush( Reliable_Output_Stream & stream ) noexcept
+    {
+        while ( not m_records.empty() ) {
+            Record_Layout::serialize( stream, m_records.front() );
+
+            m_records.pop();
+        } // while
+    }
+
+  private:
+    /**
+     * \brief The tick source used to timestamp records.
+     */
+    Tick_Source const * m_tick_source;
+
+    /**
+     * \brief The records.
+     */
+    Circular_Buffer<Record, Size_Type, N, Circular_Buffer_Use_Case::MAIN_READS_MAIN_WRITES> m_records{};
+
+    /**
+     * \brief The number of records that have been overwritten since the buffer was
+     *        constructed.
+     */
+    std::uint32_t m_overwritten{};
+};
+
+/**
+ * \brief Trace analyzer.
+ *
+ * Consumes a sequence of records (e.g. records deserialized on a host using
+ * picolibrary::State_Machine_Trace::Record_Layout), and computes per-state residency
+ * times and a dispatch latency histogram.
+ *
+ * \tparam STATES The maximum number of distinct states to track.
+ */
+template<std::size_t STATES>
+class Analyzer {
+  public:
+    /**
+     * \brief The number of dispatch latency histogram bins.
+     */
+    static constexpr auto BINS = std::size_t{ std::numeric_limits<std::uint32_t>::digits + 1 };
+
+    /**
+     * \brief Dispatch latency histogram (bin 0 counts dispatches with a latency of 0
+     *        ticks, bin N counts dispatches with a latency in the range [2^(N-1),2^N)
+     *        ticks).
+     */
+    using Histogram = Array<std::uint32_t, BINS>;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Analyzer() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Analyzer( Analyzer && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Analyzer( Analyzer const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Analyzer() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Analyzer && expression ) noexcept -> Analyzer & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Analyzer const & expression ) noexcept -> Analyzer & = default;
+
+    /**
+     * \brief Analyze the next record in the sequence.
+     *
+     * \pre the number of distinct entered or exited states in the sequence does not
+     *      exceed STATES
+     *
+     * \param[in] record The next record in the sequence.
+     */
+    void analyze( Record const & record ) noexcept
+    {
+        switch ( record.type ) {
+            case Record_Type::DISPATCH:
+                m_dispatch_timestamp = record.timestamp;
+                m_dispatching        = true;
+                return;
+            case Record_Type::DISPATCH_COMPLETE:
+                if ( m_dispatching ) {
+                    auto const latency = static_cast<std::uint32_t>( record.timestamp - m_dispatch_timestamp );
+
+                    ++m_histogram[ latency ? highest_bit_set( latency ) + 1 : 0 ];
+
+                    m_dispatching = false;
+                } // if
+                ++m_dispatches;
+                return;
+            case Record_Type::TRANSITION: ++m_transitions; return;
+            case Record_Type::ENTRY: {
+                auto & statistics = find( record.state );
+
+                statistics.entry_timestamp = record.timestamp;
+                statistics.active          = true;
+                return;
+            }
+            case Record_Type::EXIT: {
+                auto & statistics = find( record.state );
+
+                if ( statistics.active ) {
+                    statistics.residency += static_cast<std::uint32_t>(
+                        record.timestamp - statistics.entry_timestamp );
+                    statistics.active = false;
+                } // if
+                return;
+            }
+            case Record_Type::IGNORED: ++m_ignored; return;
+        } // switch
+    }
+
+    /**
+     * \brief Get the total number of ticks a state was active for (completed visits
+     *        only).
+     *
+     * \param[in] state The state's trace ID.
+     *
+     * \return The total number of ticks the state was active for (0 if the state does
+     *         not appear in the analyzed sequence).
+     */
+    auto residency( State_ID state ) const noexcept -> std::uint32_t
+    {
+        for ( auto const & statistics : m_states ) {
+            if ( statistics.state == state ) {
+                return statistics.residency;
+            } // if
+        }     // for
+
+        return 0;
+    }
+
+    /**
+     * \brief Get the dispatch latency histogram.
+     *
+     * \return The dispatch latency histogram.
+     */
+    auto histogram() const noexcept -> Histogram const &
+    {
+        return m_histogram;
+    }
+
+    /**
+     * \brief Get the number of completed dispatches.
+     *
+     * \return The number of completed dispatches.
+     */
+    auto dispatches() const noexcept -> std::uint32_t
+    {
+        return m_dispatches;
+    }
+
+    /**
+     * \brief Get the number of state transitions.
+     *
+     * \return The number of state transitions.
+     */
+    auto transitions() const noexcept -> std::uint32_t
+    {
+        return m_transitions;
+    }
+
+    /**
+     * \brief Get the number of ignored events.
+     *
+     * \return The number of ignored events.
+     */
+    auto ignored() const noexcept -> std::uint32_t
+    {
+        return m_ignored;
+    }
+
+  private:
+    /**
+     * \brief State statistics.
+     */
+    struct State_Statistics {
+        /**
+         * \brief The state's trace ID.
+         */
+        State_ID state;
+
+        /**
+         * \brief The total number of ticks the state was active for.
+         */
+        std::uint32_t residency;
+
+        /**
+         * \brief The tick count when the state was last entered.
+         */
+        std::uint32_t entry_timestamp;
+
+        /**
+         * \brief The state's activity state.
+         */
+        bool active;
+    };
+
+    /**
+     * \brief The state statistics.
+     */
+    Fixed_Capacity_Vector<State_Statistics, STATES> m_states{};
+
+    /**
+     * \brief The dispatch latency histogram.
+     */
+    Histogram m_histogram{};
+
+    /**
+     * \brief The tick count when the event currently being dispatched was dispatched.
+     */
+    std::uint32_t m_dispatch_timestamp{};
+
+    /**
+     * \brief The number of completed dispatches.
+     */
+    std::uint32_t m_dispatches{};
+
+    /**
+     * \brief The number of state transitions.
+     */
+    std::uint32_t m_transitions{};
+
+    /**
+     * \brief The number of ignored events.
+     */
+    std::uint32_t m_ignored{};
+
+    /**
+     * \brief The dispatch state.
+     */
+    bool m_dispatching{};
+
+    /**
+     * \brief Get a state's statistics, adding the state if it has not been seen before.
+     *
+     * \param[in] state The state's trace ID.
+     *
+     * \return The state's statistics.
+     */
+    auto find( State_ID state ) noexcept -> State_Statistics &
+    {
+        for ( auto & statistics : m_states ) {
+            if ( statistics.state == state ) {
+                return statistics;
+            } // if
+        }     // for
+
+        m_states.push_back( State_Statistics{ state, 0, 0, false } );
+
+        return m_states.back();
+    }
+};
+
+} // namespace picolibrary::State_Machine_Trace
+
+#endif // PICOLIBRARY_STATE_MACHINE_TRACE_H
@@ -0,0 +1,135 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::State_Machine_Trace::Tracer interface.
+ */
+
+#ifndef PICOLIBRARY_STATE_MACHINE_TRACER_H
+#define PICOLIBRARY_STATE_MACHINE_TRACER_H
+
+#include <cstdint>
+
+#include "picolibrary/event.h"
+
+/**
+ * \brief State machine binary tracing facilities.
+ */
+namespace picolibrary::State_Machine_Trace {
+
+/**
+ * \brief Trace record type.
+ */
+enum class Record_Type : std::uint8_t {
+    DISPATCH,          ///< An event is about to be dispatched.
+    DISPATCH_COMPLETE, ///< An event's processing has run to completion.
+    TRANSITION,        ///< A state transition has been triggered.
+    ENTRY,             ///< A state's entry actions have been executed.
+    EXIT,              ///< A state's exit actions have been executed.
+    IGNORED,           ///< An event has been ignored.
+};
+
+/**
+ * \brief State trace ID.
+ *
+ * State trace IDs are 32 bits wide on all targets so that the binary trace record format
+ * does not depend on the target's pointer width.
+ */
+using State_ID = std::uint32_t;
+
+/**
+ * \brief Get a state's trace ID.
+ *
+ * A state's trace ID is the low 32 bits of the address of the state's event handler. On
+ * targets with 32-bit or narrower pointers this is the full address. On 64-bit targets,
+ * the event handlers of a single image are unique in their low 32 bits. A host can map
+ * trace IDs back to state names using the firmware image's symbol table.
+ *
+ * \tparam State_Event_Handler The state event handler type.
+ *
+ * \param[in] state The state event handler.
+ *
+ * \return The state's trace ID.
+ */
+template<typename State_Event_Handler>
+auto state_id( State_Event_Handler * state ) noexcept -> State_ID
+{
+    return static_cast<State_ID>( reinterpret_cast<std::uintptr_t>( state ) );
+}
+
+/**
+ * \brief State machine tracer interface.
+ */
+class Tracer {
+  public:
+    /**
+     * \brief Generate a trace record.
+     *
+     * \param[in] type The record type.
+     * \param[in] state The trace ID of the state the record applies to.
+     * \param[in] event The ID of the event the record applies to.
+     */
+    virtual void trace( Record_Type type, State_ID state, Event_ID event ) noexcept = 0;
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Tracer() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Tracer( Tracer && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Tracer( Tracer const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Tracer() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Tracer && expression ) noexcept -> Tracer & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Tracer const & expression ) noexcept -> Tracer & = default;
+};
+
+} // namespace picolibrary::State_Machine_Trace
+
+#endif // PICOLIBRARY_STATE_MACHINE_TRACER_H
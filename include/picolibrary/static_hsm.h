@@ -0,0 +1,639 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Static_HSM interface.
+ */
+
+#ifndef PICOLIBRARY_STATIC_HSM_H
+#define PICOLIBRARY_STATIC_HSM_H
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/array.h"
+#include "picolibrary/error.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary {
+
+/**
+ * \brief picolibrary::Static_HSM implicit "top" superstate (ultimate root of the state
+ *        hierarchy).
+ *
+ * \warning This state must never be the target of a state transition.
+ */
+struct Static_HSM_Top {
+};
+
+/**
+ * \brief Compile-time HSM.
+ *
+ * States are types, and the state hierarchy is declared by the state types:
+ * - Each state type must provide a Superstate member type alias that identifies the
+ *   state's superstate (picolibrary::Static_HSM_Top if the state is a highest level
+ *   state).
+ * - A state type may provide an Initial_State member type alias that identifies the
+ *   target of the state's nested initial transition (must be a substate of the state).
+ *
+ * State behavior is defined by overloads of the following derived class member functions
+ * (all are optional, and must be accessible to picolibrary::Static_HSM):
+ * - void on_entry( State ) noexcept: execute the state's entry actions
+ * - void on_exit( State ) noexcept: execute the state's exit actions
+ * - void on_initial_transition( State ) noexcept: execute any actions associated with the
+ *   state's nested initial transition
+ * - auto on_event( State state, Event const & event ) noexcept -> Event_Handling_Result:
+ *   handle an event, returning picolibrary::Static_HSM::event_handled(),
+ *   picolibrary::Static_HSM::transition_to<Target>( state ), or
+ *   picolibrary::Static_HSM::defer_event_handling_to_superstate()
+ *
+ * States that do not handle an event defer handling of the event to their superstate.
+ * Events that are not handled by any state are ignored.
+ *
+ * Since the state hierarchy is known at compile time, state transition exit and entry
+ * paths are generated at compile time, and dispatching an event selects the currently
+ * active state's handler chain with a single switch-like comparison chain that the
+ * compiler can inline. Use picolibrary::HSM if the state hierarchy is not known at
+ * compile time.
+ *
+ * \tparam Derived The derived class.
+ * \tparam States The types of the HSM's states.
+ */
+template<typename Derived, typename... States>
+class Static_HSM {
+  public:
+    static_assert( sizeof...( States ) > 0 );
+    static_assert( sizeof...( States ) < std::numeric_limits<std::uint_least8_t>::max() );
+
+    /**
+     * \brief Event handling result.
+     *
+     * \warning State event handlers should never construct event handling results
+     *          directly. Use picolibrary::Static_HSM::event_handled(),
+     *          picolibrary::Static_HSM::transition_to(), or
+     *          picolibrary::Static_HSM::defer_event_handling_to_superstate() instead.
+     */
+    enum class [[nodiscard]] Event_Handling_Result : std::uint_fast8_t{
+        EVENT_HANDLED,                         ///< Event handled.
+        STATE_TRANSITION_TRIGGERED,            ///< State transition triggered.
+        EVENT_HANDLING_DEFERRED_TO_SUPERSTATE, ///< Event handling deferred to superstate.
+    };
+
+    /**
+     * \brief Report that an event has been handled.
+     *
+     * \return Event handled event handling result.
+     */
+    static constexpr auto event_handled() noexcept -> Event_Handling_Result
+    {
+        return Event_Handling_Result::EVENT_HANDLED;
+    }
+
+    /**
+     * \brief Defer handling of an event to the handling state's superstate.
+     *
+     * \return Event handling deferred to superstate event handling result.
+     */
+    static constexpr auto defer_event_handling_to_superstate() noexcept
+        -> Event_Handling_Result
+    {
+        return Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE;
+    }
+
+    /**
+     * \brief Execute a state transition and any resulting nested initial transitions.
+     *
+     * \pre source is the currently active state or one of its superstates
+     *
+     * \tparam Target The target of the state transition.
+     * \tparam Source The source of the state transition.
+     *
+     * \param[in] source The source of the state transition (the state whose event
+     *            handler is triggering the state transition).
+     *
+     * \return State transition triggered event handling result.
+     */
+    template<typename Target, typename Source>
+    auto transition_to( Source source ) noexcept -> Event_Handling_Result
+    {
+        static_cast<void>( source );
+
+        static_assert( not std::is_same_v<Target, Static_HSM_Top> );
+
+        exit_to( index_of<Source>() );
+
+        if constexpr ( std::is_same_v<Target, Source> ) {
+            exit<Source>();
+            enter<Target>();
+        } else {
+            using Least_Common_Ancestor = typename Common_Ancestor<Source, Target>::Type;
+
+            exit_path<Source, Least_Common_Ancestor>();
+            enter_path<Least_Common_Ancestor, Target>();
+        } // else
+
+        execute_nested_initial_transitions<Target>();
+
+        return Event_Handling_Result::STATE_TRANSITION_TRIGGERED;
+    }
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Static_HSM() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Static_HSM( Static_HSM && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Static_HSM( Static_HSM const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_HSM() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_HSM && expression ) noexcept
+        -> Static_HSM & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_HSM const & expression ) noexcept
+        -> Static_HSM & = default;
+
+    /**
+     * \brief Execute the topmost initial transition and any resulting nested initial
+     *        transitions.
+     *
+     * Any actions associated with the topmost initial transition should be executed
+     * before this function is called.
+     *
+     * \pre this function has not been called previously
+     *
+     * \tparam Target The target of the topmost initial transition.
+     */
+    template<typename Target>
+    void execute_topmost_initial_transition() noexcept
+    {
+        static_assert( not std::is_same_v<Target, Static_HSM_Top> );
+
+        PICOLIBRARY_EXPECT( m_current_state == TOP, Generic_Error::LOGIC_ERROR );
+
+        enter_path<Static_HSM_Top, Target>();
+
+        execute_nested_initial_transitions<Target>();
+    }
+
+    /**
+     * \brief Dispatch an event to the event handlers for the currently active state and
+     *        its superstates.
+     *
+     * \pre picolibrary::Static_HSM::execute_topmost_initial_transition() has been called
+     *
+     * \tparam Event The type of event to dispatch.
+     *
+     * \param[in] event The event to dispatch.
+     */
+    template<typename Event>
+    void dispatch( Event const & event ) noexcept
+    {
+        PICOLIBRARY_EXPECT( m_current_state != TOP, Generic_Error::LOGIC_ERROR );
+
+        static_cast<void>(
+            ( ( m_current_state == index_of<States>()
+                    ? ( handle<States>( event ), true )
+                    : false )
+              or ... ) );
+    }
+
+    /**
+     * \brief Check if a state is the currently active state or one of its superstates.
+     *
+     * \tparam State The state to check.
+     *
+     * \return true if the state is the currently active state or one of its superstates.
+     * \return false if the state is neither the currently active state nor any of its
+     *         superstates.
+     */
+    template<typename State>
+    constexpr auto is_in() const noexcept -> bool
+    {
+        for ( auto state = m_current_state; state != TOP; state = SUPERSTATE[ state ] ) {
+            if ( state == index_of<State>() ) {
+                return true;
+            } // if
+        }     // for
+
+        return false;
+    }
+
+  private:
+    /**
+     * \brief State index.
+     */
+    using State_Index = std::uint_least8_t;
+
+    /**
+     * \brief The implicit "top" superstate's state index.
+     */
+    static constexpr auto TOP = static_cast<State_Index>( sizeof...( States ) );
+
+    /**
+     * \brief Check if a state is an ancestor of (or the same state as) another state.
+     *
+     * \tparam Ancestor The potential ancestor.
+     * \tparam State The state.
+     */
+    template<typename Ancestor, typename State>
+    struct Is_Ancestor_Or_Self :
+        std::bool_constant<
+            std::is_same_v<Ancestor, State>
+            or Is_Ancestor_Or_Self<Ancestor, typename State::Superstate>::value> {
+    };
+
+    /**
+     * \brief Check if a state is an ancestor of (or the same state as) the implicit "top"
+     *        superstate.
+     *
+     * \tparam Ancestor The potential ancestor.
+     */
+    template<typename Ancestor>
+    struct Is_Ancestor_Or_Self<Ancestor, Static_HSM_Top> :
+        std::is_same<Ancestor, Static_HSM_Top> {
+    };
+
+    /**
+     * \brief Get the nearest ancestor (or self) of a state that is also an ancestor (or
+     *        self) of another state.
+     *
+     * \tparam State The state whose ancestors are searched.
+     * \tparam Other The other state.
+     */
+    template<typename State, typename Other>
+    struct Common_Ancestor {
+        /**
+         * \brief The nearest common ancestor.
+         */
+        using Type = std::conditional_t<
+            Is_Ancestor_Or_Self<State, Other>::value,
+            State,
+            typename Common_Ancestor<typename State::Superstate, Other>::Type>;
+    };
+
+    /**
+     * \brief Get the nearest ancestor (or self) of the implicit "top" superstate that is
+     *        also an ancestor (or self) of another state.
+     *
+     * \tparam Other The other state.
+     */
+    template<typename Other>
+    struct Common_Ancestor<Static_HSM_Top, Other> {
+        /**
+         * \brief The nearest common ancestor.
+         */
+        using Type = Static_HSM_Top;
+    };
+
+    /**
+     * \brief Check if a state has entry actions.
+     *
+     * \tparam State The state to check.
+     */
+    template<typename State, typename = void>
+    struct Has_Entry_Actions : std::false_type {
+    };
+
+    /**
+     * \brief Check if a state has entry actions.
+     *
+     * \tparam State The state to check.
+     */
+    template<typename State>
+    struct Has_Entry_Actions<
+        State,
+        std::void_t<decltype( std::declval<Derived &>().on_entry( State{} ) )>> :
+        std::true_type {
+    };
+
+    /**
+     * \brief Check if a state has exit actions.
+     *
+     * \tparam State The state to check.
+     */
+    template<typename State, typename = void>
+    struct Has_Exit_Actions : std::false_type {
+    };
+
+    /**
+     * \brief Check if a state has exit actions.
+     *
+     * \tparam State The state to check.
+     */
+    template<typename State>
+    struct Has_Exit_Actions<
+        State,
+        std::void_t<decltype( std::declval<Derived &>().on_exit( State{} ) )>> :
+        std::true_type {
+    };
+
+    /**
+     * \brief Check if a state has nested initial transition actions.
+     *
+     * \tparam State The state to check.
+     */
+    template<typename State, typename = void>
+    struct Has_Initial_Transition_Actions : std::false_type {
+    };
+
+    /**
+     * \brief Check if a state has nested initial transition actions.
+     *
+     * \tparam State The state to check.
+     */
+    template<typename State>
+    struct Has_Initial_Transition_Actions<
+        State,
+        std::void_t<decltype( std::declval<Derived &>().on_initial_transition(
+            State{} ) )>> :
+        std::true_type {
+    };
+
+    /**
+     * \brief Check if a state has a nested initial transition.
+     *
+     * \tparam State The state to check.
+     */
+    template<typename State, typename = void>
+    struct Has_Initial_State : std::false_type {
+    };
+
+    /**
+     * \brief Check if a state has a nested initial transition.
+     *
+     * \tparam State The state to check.
+     */
+    template<typename State>
+    struct Has_Initial_State<State, std::void_t<typename State::Initial_State>> :
+        std::true_type {
+    };
+
+    /**
+     * \brief Check if a state has an event handler for a type of event.
+     *
+     * \tparam State The state to check.
+     * \tparam Event The type of event.
+     */
+    template<typename State, typename Event, typename = void>
+    struct Has_Event_Handler : std::false_type {
+    };
+
+    /**
+     * \brief Check if a state has an event handler for a type of event.
+     *
+     * \tparam State The state to check.
+     * \tparam Event The type of event.
+     */
+    template<typename State, typename Event>
+    struct Has_Event_Handler<
+        State,
+        Event,
+        std::void_t<decltype( std::declval<Derived &>().on_event(
+            State{}, std::declval<Event const &>() ) )>> :
+        std::true_type {
+    };
+
+    /**
+     * \brief Get a state's state index.
+     *
+     * \tparam State The state whose state index is to be got.
+     *
+     * \return The state's state index.
+     */
+    template<typename State>
+    static constexpr auto index_of() noexcept -> State_Index
+    {
+        if constexpr ( std::is_same_v<State, Static_HSM_Top> ) {
+            return TOP;
+        } else {
+            static_assert(
+                ( std::is_same_v<State, States> or ... ),
+                "State is not one of the HSM's states" );
+
+            constexpr bool matches[]{ std::is_same_v<State, States>... };
+
+            auto index = State_Index{ 0 };
+            while ( not matches[ index ] ) {
+                ++index;
+            } // while
+
+            return index;
+        } // else
+    }
+
+    /**
+     * \brief State index to superstate state index lookup table.
+     */
+    static constexpr auto SUPERSTATE = Array<State_Index, sizeof...( States )>{
+        index_of<typename States::Superstate>()...
+    };
+
+    /**
+     * \brief The currently active state's state index (picolibrary::Static_HSM::TOP if
+     *        the topmost initial transition has not been executed).
+     */
+    State_Index m_current_state{ TOP };
+
+    /**
+     * \brief Get a reference to the derived class.
+     *
+     * \return A reference to the derived class.
+     */
+    constexpr auto derived() noexcept -> Derived &
+    {
+        return static_cast<Derived &>( *this );
+    }
+
+    /**
+     * \brief Execute a state's entry actions.
+     *
+     * \tparam State The state whose entry actions are to be executed.
+     */
+    template<typename State>
+    void enter() noexcept
+    {
+        if constexpr ( Has_Entry_Actions<State>::value ) {
+            derived().on_entry( State{} );
+        } // if
+    }
+
+    /**
+     * \brief Execute a state's exit actions.
+     *
+     * \tparam State The state whose exit actions are to be executed.
+     */
+    template<typename State>
+    void exit() noexcept
+    {
+        if constexpr ( Has_Exit_Actions<State>::value ) {
+            derived().on_exit( State{} );
+        } // if
+    }
+
+    /**
+     * \brief Execute a state's exit actions.
+     *
+     * \param[in] state The state index of the state whose exit actions are to be
+     *            executed.
+     */
+    void exit( State_Index state ) noexcept
+    {
+        static_cast<void>(
+            ( ( state == index_of<States>() ? ( exit<States>(), true ) : false )
+              or ... ) );
+    }
+
+    /**
+     * \brief Exit the currently active state and its superstates until a state is
+     *        reached.
+     *
+     * \param[in] state The state index of the state at which to stop (the state is not
+     *            exited).
+     */
+    void exit_to( State_Index state ) noexcept
+    {
+        while ( m_current_state != state ) {
+            exit( m_current_state );
+
+            m_current_state = SUPERSTATE[ m_current_state ];
+        } // while
+    }
+
+    /**
+     * \brief Execute exit actions for a state and its superstates until an ancestor is
+     *        reached.
+     *
+     * \tparam State The state to exit first.
+     * \tparam Ancestor The ancestor at which to stop (the ancestor is not exited).
+     */
+    template<typename State, typename Ancestor>
+    void exit_path() noexcept
+    {
+        if constexpr ( not std::is_same_v<State, Ancestor> ) {
+            exit<State>();
+            exit_path<typename State::Superstate, Ancestor>();
+        } // if
+    }
+
+    /**
+     * \brief Execute entry actions for a state and its superstates below an ancestor,
+     *        outermost first.
+     *
+     * \tparam Ancestor The ancestor below which to start (the ancestor is not entered).
+     * \tparam State The state to enter last.
+     */
+    template<typename Ancestor, typename State>
+    void enter_path() noexcept
+    {
+        if constexpr ( not std::is_same_v<State, Ancestor> ) {
+            static_assert( not std::is_same_v<State, Static_HSM_Top> );
+
+            enter_path<Ancestor, typename State::Superstate>();
+            enter<State>();
+        } // if
+    }
+
+    /**
+     * \brief Execute a state's nested initial transition and any resulting nested initial
+     *        transitions.
+     *
+     * \tparam State The state that has been entered.
+     */
+    template<typename State>
+    void execute_nested_initial_transitions() noexcept
+    {
+        if constexpr ( Has_Initial_State<State>::value ) {
+            using Initial_State = typename State::Initial_State;
+
+            static_assert(
+                not std::is_same_v<Initial_State, State>
+                    and Is_Ancestor_Or_Self<State, Initial_State>::value,
+                "a state's initial state must be one of its substates" );
+
+            if constexpr ( Has_Initial_Transition_Actions<State>::value ) {
+                derived().on_initial_transition( State{} );
+            } // if
+
+            enter_path<State, Initial_State>();
+
+            execute_nested_initial_transitions<Initial_State>();
+        } else {
+            m_current_state = index_of<State>();
+        } // else
+    }
+
+    /**
+     * \brief Pass an event to the event handlers for a state and its superstates until
+     *        the event is handled or triggers a state transition.
+     *
+     * \tparam State The state to pass the event to first.
+     * \tparam Event The type of event to handle.
+     *
+     * \param[in] event The event to handle.
+     */
+    template<typename State, typename Event>
+    void handle( Event const & event ) noexcept
+    {
+        if constexpr ( not std::is_same_v<State, Static_HSM_Top> ) {
+            if constexpr ( Has_Event_Handler<State, Event>::value ) {
+                if ( derived().on_event( State{}, event )
+                     != Event_Handling_Result::EVENT_HANDLING_DEFERRED_TO_SUPERSTATE ) {
+                    return;
+                } // if
+            }     // if
+
+            handle<typename State::Superstate>( event );
+        } // if
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_STATIC_HSM_H
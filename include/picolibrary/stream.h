@@ -117,6 +117,25 @@ class Output_Formatter {
     auto print( Reliable_Output_Stream & stream, T const & value ) const noexcept -> std::size_t;
 };
 
+/**
+ * \brief Block of unsigned bytes that is one segment of a larger record (e.g. a header,
+ *        payload, or CRC).
+ *
+ * Arrays of segments are written to a stream with a single (gather) put, allowing the
+ * stream's device access buffer to write a complete record in a single operation.
+ */
+struct Stream_Segment {
+    /**
+     * \brief The beginning of the block of unsigned bytes.
+     */
+    std::uint8_t const * begin;
+
+    /**
+     * \brief The end of the block of unsigned bytes.
+     */
+    std::uint8_t const * end;
+};
+
 /**
  * \brief I/O stream device access buffer.
  */
@@ -247,6 +266,26 @@ class Stream_Buffer {
             begin, end, [ this ]( auto value ) noexcept { return put( value ); } );
     }
 
+    /**
+     * \brief Write a sequence of blocks of unsigned bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the sequence of blocks of unsigned bytes to write
+     *            to the put area of the buffer.
+     * \param[in] end The end of the sequence of blocks of unsigned bytes to write to the
+     *            put area of the buffer.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    virtual auto put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept
+        -> Result<void>
+    {
+        return ::picolibrary::for_each<Functor_Can_Fail_Discard_Functor>(
+            begin, end, [ this ]( auto segment ) noexcept {
+                return put( segment.begin, segment.end );
+            } );
+    }
+
     /**
      * \brief Write any data that is buffered in the put area of the buffer to the device.
      *
@@ -731,6 +770,33 @@ class Output_Stream : public Stream {
         return {};
     }
 
+    /**
+     * \brief Write a sequence of blocks of unsigned bytes to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the sequence of blocks of unsigned bytes to write
+     *            to the stream.
+     * \param[in] end The end of the sequence of blocks of unsigned bytes to write to the
+     *            stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( begin, end );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
     /**
      * \brief Write formatted output to the stream.
      *
@@ -981,6 +1047,21 @@ class Reliable_Stream_Buffer {
             begin, end, [ this ]( auto value ) noexcept { put( value ); } );
     }
 
+    /**
+     * \brief Write a sequence of blocks of unsigned bytes to the put area of the buffer.
+     *
+     * \param[in] begin The beginning of the sequence of blocks of unsigned bytes to write
+     *            to the put area of the buffer.
+     * \param[in] end The end of the sequence of blocks of unsigned bytes to write to the
+     *            put area of the buffer.
+     */
+    virtual void put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept
+    {
+        ::picolibrary::for_each( begin, end, [ this ]( auto segment ) noexcept {
+            put( segment.begin, segment.end );
+        } );
+    }
+
     /**
      * \brief Write any data that is buffered in the put area of the buffer to the device.
      */
@@ -1355,6 +1436,23 @@ class Reliable_Output_Stream : public Reliable_Stream {
         buffer()->put( begin, end );
     }
 
+    /**
+     * \brief Write a sequence of blocks of unsigned bytes to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the sequence of blocks of unsigned bytes to write
+     *            to the stream.
+     * \param[in] end The end of the sequence of blocks of unsigned bytes to write to the
+     *            stream.
+     */
+    void put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( begin, end );
+    }
+
     /**
      * \brief Write formatted output to the stream.
      *
@@ -1497,6 +1595,577 @@ class Reliable_Output_Stream : public Reliable_Stream {
     }
 };
 
+/**
+ * \brief Statically dispatched output stream.
+ *
+ * Statically dispatched output streams write unformatted output directly to a concrete
+ * I/O stream device access buffer type instead of through the picolibrary::Stream_Buffer
+ * or picolibrary::Reliable_Stream_Buffer virtual interface, allowing the compiler to
+ * inline the buffer's put and flush implementations. Since statically dispatched output
+ * streams are also picolibrary::Output_Stream or picolibrary::Reliable_Output_Stream
+ * objects, formatted output (picolibrary::Output_Formatter) works with both.
+ *
+ * \tparam Buffer The type of I/O stream device access buffer the stream will be
+ *         associated with. The buffer type must be final and must make all of the put
+ *         overloads that will be used visible.
+ */
+template<typename Buffer, typename = void>
+class Static_Output_Stream;
+
+/**
+ * \brief Statically dispatched output stream.
+ *
+ * \tparam Buffer The type of I/O stream device access buffer the stream will be
+ *         associated with.
+ */
+template<typename Buffer>
+class Static_Output_Stream<Buffer, std::enable_if_t<std::is_base_of_v<Stream_Buffer, Buffer>>> :
+    public Output_Stream {
+  public:
+    static_assert( std::is_final_v<Buffer> );
+
+    /**
+     * \brief Write a character to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] character The character to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( character );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a block of characters to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the block of characters to write to the stream.
+     * \param[in] end The end of the block of characters to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( begin, end );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a null-terminated string to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] string The null-terminated string to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( string );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+#ifdef PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] string The null-terminated ROM string to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( ROM::String string ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( string );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+#endif // PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write an unsigned byte to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] value The unsigned byte to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( value );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the
+     *            stream.
+     * \param[in] end The end of the block of unsigned bytes to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( begin, end );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a signed byte to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] value The signed byte to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( value );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a block of signed bytes to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to the stream.
+     * \param[in] end The end of the block of signed bytes to write to the stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( std::int8_t const * begin, std::int8_t const * end ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( begin, end );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write a sequence of blocks of unsigned bytes to the stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the sequence of blocks of unsigned bytes to write
+     *            to the stream.
+     * \param[in] end The end of the sequence of blocks of unsigned bytes to write to the
+     *            stream.
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->put( begin, end );
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Write any output that has been buffered to the device associated with the
+     *        stream.
+     *
+     * \pre picolibrary::Stream::is_nominal()
+     *
+     * \return Nothing if the write succeeded.
+     * \return An error code if the write failed.
+     */
+    auto flush() noexcept -> Result<void>
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        auto result = buffer()->flush();
+        if ( result.is_error() ) {
+            report_fatal_error();
+
+            return result.error();
+        } // if
+
+        return {};
+    }
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Static_Output_Stream() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Static_Output_Stream( Static_Output_Stream && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Static_Output_Stream( Static_Output_Stream const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Output_Stream() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_Output_Stream && expression ) noexcept
+        -> Static_Output_Stream & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_Output_Stream const & expression ) noexcept
+        -> Static_Output_Stream & = default;
+
+    /**
+     * \brief Get the I/O stream device access buffer associated with the I/O stream.
+     *
+     * \brief The I/O stream device access buffer associated with the I/O stream.
+     */
+    constexpr auto buffer() noexcept -> Buffer *
+    {
+        return static_cast<Buffer *>( Output_Stream::buffer() );
+    }
+
+    /**
+     * \brief Associate the I/O stream with an I/O stream device access buffer.
+     *
+     * \param[in] buffer The I/O stream device access buffer to associate the I/O stream
+     *            with.
+     */
+    constexpr void set_buffer( Buffer * buffer ) noexcept
+    {
+        Output_Stream::set_buffer( buffer );
+    }
+};
+
+/**
+ * \brief Statically dispatched reliable output stream.
+ *
+ * \tparam Buffer The type of reliable I/O stream device access buffer the stream will be
+ *         associated with.
+ */
+template<typename Buffer>
+class Static_Output_Stream<Buffer, std::enable_if_t<std::is_base_of_v<Reliable_Stream_Buffer, Buffer>>> :
+    public Reliable_Output_Stream {
+  public:
+    static_assert( std::is_final_v<Buffer> );
+
+    /**
+     * \brief Write a character to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] character The character to write to the stream.
+     */
+    void put( char character ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( character );
+    }
+
+    /**
+     * \brief Write a block of characters to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the block of characters to write to the stream.
+     * \param[in] end The end of the block of characters to write to the stream.
+     */
+    void put( char const * begin, char const * end ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( begin, end );
+    }
+
+    /**
+     * \brief Write a null-terminated string to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] string The null-terminated string to write to the stream.
+     */
+    void put( char const * string ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( string );
+    }
+
+#ifdef PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] string The null-terminated ROM string to write to the stream.
+     */
+    void put( ROM::String string ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( string );
+    }
+#endif // PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write an unsigned byte to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] value The unsigned byte to write to the stream.
+     */
+    void put( std::uint8_t value ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( value );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to the
+     *            stream.
+     * \param[in] end The end of the block of unsigned bytes to write to the stream.
+     */
+    void put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( begin, end );
+    }
+
+    /**
+     * \brief Write a signed byte to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] value The signed byte to write to the stream.
+     */
+    void put( std::int8_t value ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( value );
+    }
+
+    /**
+     * \brief Write a block of signed bytes to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to the stream.
+     * \param[in] end The end of the block of signed bytes to write to the stream.
+     */
+    void put( std::int8_t const * begin, std::int8_t const * end ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( begin, end );
+    }
+
+    /**
+     * \brief Write a sequence of blocks of unsigned bytes to the stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     *
+     * \param[in] begin The beginning of the sequence of blocks of unsigned bytes to write
+     *            to the stream.
+     * \param[in] end The end of the sequence of blocks of unsigned bytes to write to the
+     *            stream.
+     */
+    void put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->put( begin, end );
+    }
+
+    /**
+     * \brief Write any output that has been buffered to the device associated with the
+     *        stream.
+     *
+     * \pre picolibrary::Reliable_Stream::is_nominal()
+     */
+    void flush() noexcept
+    {
+        PICOLIBRARY_EXPECT( is_nominal(), Generic_Error::IO_STREAM_DEGRADED );
+
+        buffer()->flush();
+    }
+
+  protected:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Static_Output_Stream() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Static_Output_Stream( Static_Output_Stream && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Static_Output_Stream( Static_Output_Stream const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Static_Output_Stream() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_Output_Stream && expression ) noexcept
+        -> Static_Output_Stream & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Static_Output_Stream const & expression ) noexcept
+        -> Static_Output_Stream & = default;
+
+    /**
+     * \brief Get the I/O stream device access buffer associated with the I/O stream.
+     *
+     * \brief The I/O stream device access buffer associated with the I/O stream.
+     */
+    constexpr auto buffer() noexcept -> Buffer *
+    {
+        return static_cast<Buffer *>( Reliable_Output_Stream::buffer() );
+    }
+
+    /**
+     * \brief Associate the I/O stream with an I/O stream device access buffer.
+     *
+     * \param[in] buffer The I/O stream device access buffer to associate the I/O stream
+     *            with.
+     */
+    constexpr void set_buffer( Buffer * buffer ) noexcept
+    {
+        Reliable_Output_Stream::set_buffer( buffer );
+    }
+};
+
 /**
  * \brief Character output formatter.
  */
@@ -0,0 +1,361 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Table_Driven_State_Machine interface.
+ */
+
+#ifndef PICOLIBRARY_TABLE_DRIVEN_STATE_MACHINE_H
+#define PICOLIBRARY_TABLE_DRIVEN_STATE_MACHINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "picolibrary/error.h"
+#include "picolibrary/event.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Table driven (non-hierarchical) state machine.
+ *
+ * States are identified by state indices, and state machine behavior is defined by
+ * constant tables that can be placed in read-only memory:
+ * - A state transition table that has one row per state and one column per event ID. Each
+ *   entry specifies the action to execute (if any) and the state to transition to (or
+ *   picolibrary::Table_Driven_State_Machine::NO_TRANSITION) when the event is dispatched
+ *   while the state is the currently active state.
+ * - A state action table that has one entry per state. Each entry specifies the state's
+ *   entry and exit actions (if any).
+ *
+ * Dispatching an event is a single table lookup, and state transitions have the same
+ * semantics as picolibrary::State_Machine state transitions: the transition's action is
+ * executed, the currently active state's exit actions are executed, and the target
+ * state's entry actions are executed (state transitions whose target is the currently
+ * active state exit and re-enter the state). Events whose table entry does not specify an
+ * action or a state transition are ignored.
+ *
+ * A state machine is bound to a single event category, and the state transition table is
+ * indexed by event ID within that category. Events from other event categories are
+ * ignored.
+ */
+class Table_Driven_State_Machine {
+  public:
+    /**
+     * \brief State index.
+     */
+    using State = std::uint_least8_t;
+
+    /**
+     * \brief State transition table entry state index indicating that no state
+     *        transition occurs.
+     */
+    static constexpr auto NO_TRANSITION = std::numeric_limits<State>::max();
+
+    /**
+     * \brief Transition action function signature.
+     *
+     * \param[in] state_machine The state machine that the event was dispatched to.
+     * \param[in] event The event that triggered the action.
+     */
+    using Action = auto( Table_Driven_State_Machine & state_machine, Event const & event ) noexcept
+        -> void;
+
+    /**
+     * \brief Transition action function pointer.
+     */
+    using Action_Pointer = std::add_pointer_t<Action>;
+
+    /**
+     * \brief State entry/exit action function signature.
+     *
+     * \param[in] state_machine The state machine whose state is being entered/exited.
+     */
+    using State_Action = auto( Table_Driven_State_Machine & state_machine ) noexcept
+        -> void;
+
+    /**
+     * \brief State entry/exit action function pointer.
+     */
+    using State_Action_Pointer = std::add_pointer_t<State_Action>;
+
+    /**
+     * \brief State transition table entry.
+     */
+    struct Transition {
+        /**
+         * \brief The action to execute (nullptr if there is no action to execute).
+         */
+        Action_Pointer action;
+
+        /**
+         * \brief The state to transition to
+         *        (picolibrary::Table_Driven_State_Machine::NO_TRANSITION if no state
+         *        transition occurs).
+         */
+        State target_state;
+    };
+
+    /**
+     * \brief State action table entry.
+     */
+    struct State_Actions {
+        /**
+         * \brief The state's entry actions (nullptr if the state does not have entry
+         *        actions).
+         */
+        State_Action_Pointer entry;
+
+        /**
+         * \brief The state's exit actions (nullptr if the state does not have exit
+         *        actions).
+         */
+        State_Action_Pointer exit;
+    };
+
+  protected:
+    Table_Driven_State_Machine() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \pre each state transition table entry's target state is a valid state index or
+     *      picolibrary::Table_Driven_State_Machine::NO_TRANSITION
+     *
+     * \tparam STATES The number of states.
+     * \tparam EVENTS The number of event IDs.
+     *
+     * \param[in] category The event category whose events the state transition table is
+     *            indexed by.
+     * \param[in] transitions The state transition table (indexed by state index, then
+     *            event ID).
+     * \param[in] state_actions The state action table (indexed by state index).
+     */
+    template<std::size_t STATES, std::size_t EVENTS>
+    constexpr Table_Driven_State_Machine(
+        Event_Category const & category,
+        Transition const ( &transitions )[ STATES ][ EVENTS ],
+        State_Actions const ( &state_actions )[ STATES ] ) noexcept :
+        m_category{ &category },
+        m_transitions{ &transitions[ 0 ][ 0 ] },
+        m_state_actions{ state_actions },
+        m_states{ static_cast<State>( STATES ) },
+        m_events{ static_cast<Event_ID>( EVENTS ) }
+    {
+        static_assert( STATES < NO_TRANSITION );
+        static_assert( EVENTS <= std::numeric_limits<Event_ID>::max() );
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Table_Driven_State_Machine( Table_Driven_State_Machine && source ) noexcept =
+        default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Table_Driven_State_Machine( Table_Driven_State_Machine const & original ) noexcept =
+        default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Table_Driven_State_Machine() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Table_Driven_State_Machine && expression ) noexcept
+        -> Table_Driven_State_Machine & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Table_Driven_State_Machine const & expression ) noexcept
+        -> Table_Driven_State_Machine & = default;
+
+    /**
+     * \brief Execute the state machine's initial transition.
+     *
+     * Any actions associated with the initial transition should be executed before this
+     * function is called.
+     *
+     * \pre this function has not been called previously
+     * \pre initial_state is a valid state index
+     *
+     * \param[in] initial_state The target of the initial transition.
+     */
+    void execute_initial_transition( State initial_state ) noexcept
+    {
+        PICOLIBRARY_EXPECT(
+            m_current_state == NO_TRANSITION, Generic_Error::LOGIC_ERROR );
+        PICOLIBRARY_EXPECT( initial_state < m_states, Generic_Error::INVALID_ARGUMENT );
+
+        enter( initial_state );
+        m_current_state = initial_state;
+    }
+
+    /**
+     * \brief Dispatch an event to the state machine's currently active state.
+     *
+     * \pre picolibrary::Table_Driven_State_Machine::execute_initial_transition() has been
+     *      called
+     * \pre the event's ID is a valid state transition table event ID if the event is from
+     *      the state machine's event category
+     *
+     * \param[in] event The event to dispatch (ignored if the event is not from the state
+     *            machine's event category).
+     */
+    void dispatch( Event const & event ) noexcept
+    {
+        PICOLIBRARY_EXPECT(
+            m_current_state != NO_TRANSITION, Generic_Error::LOGIC_ERROR );
+
+        if ( &event.category() != m_category ) {
+            return;
+        } // if
+
+        PICOLIBRARY_EXPECT( event.id() < m_events, Generic_Error::INVALID_ARGUMENT );
+
+        auto const & transition =
+            m_transitions[ m_current_state * m_events + event.id() ];
+
+        if ( transition.action ) {
+            transition.action( *this, event );
+        } // if
+
+        if ( transition.target_state != NO_TRANSITION ) {
+            exit( m_current_state );
+            enter( transition.target_state );
+            m_current_state = transition.target_state;
+        } // if
+    }
+
+    /**
+     * \brief Get the event category whose events the state transition table is indexed
+     *        by.
+     *
+     * \return The event category whose events the state transition table is indexed by.
+     */
+    constexpr auto category() const noexcept -> Event_Category const &
+    {
+        return *m_category;
+    }
+
+    /**
+     * \brief Get the state machine's currently active state.
+     *
+     * \return The state machine's currently active state
+     *         (picolibrary::Table_Driven_State_Machine::NO_TRANSITION if the initial
+     *         transition has not been executed).
+     */
+    constexpr auto current_state() const noexcept -> State
+    {
+        return m_current_state;
+    }
+
+    /**
+     * \brief Check if a state is the state machine's currently active state.
+     *
+     * \param[in] state The state to check.
+     *
+     * \return true if the state is the state machine's currently active state.
+     * \return false if the state is not the state machine's currently active state.
+     */
+    constexpr auto is_in( State state ) const noexcept -> bool
+    {
+        return m_current_state == state;
+    }
+
+  private:
+    /**
+     * \brief The event category whose events the state transition table is indexed by.
+     */
+    Event_Category const * m_category;
+
+    /**
+     * \brief The state transition table.
+     */
+    Transition const * m_transitions;
+
+    /**
+     * \brief The state action table.
+     */
+    State_Actions const * m_state_actions;
+
+    /**
+     * \brief The number of states.
+     */
+    State m_states;
+
+    /**
+     * \brief The number of event IDs.
+     */
+    Event_ID m_events;
+
+    /**
+     * \brief The state machine's currently active state.
+     */
+    State m_current_state{ NO_TRANSITION };
+
+    /**
+     * \brief Execute a state's entry actions.
+     *
+     * \param[in] state The state whose entry actions are to be executed.
+     */
+    void enter( State state ) noexcept
+    {
+        auto const entry = m_state_actions[ state ].entry;
+        if ( entry ) {
+            entry( *this );
+        } // if
+    }
+
+    /**
+     * \brief Execute a state's exit actions.
+     *
+     * \param[in] state The state whose exit actions are to be executed.
+     */
+    void exit( State state ) noexcept
+    {
+        auto const exit = m_state_actions[ state ].exit;
+        if ( exit ) {
+            exit( *this );
+        } // if
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_TABLE_DRIVEN_STATE_MACHINE_H
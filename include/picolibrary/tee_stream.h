@@ -0,0 +1,637 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Tee_Stream_Buffer interface.
+ */
+
+#ifndef PICOLIBRARY_TEE_STREAM_H
+#define PICOLIBRARY_TEE_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "picolibrary/array.h"
+#include "picolibrary/circular_buffer.h"
+#include "picolibrary/error.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/result.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/stream.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Tee sink failure policy.
+ */
+enum class Tee_Failure_Policy : std::uint_fast8_t {
+    DROP,      ///< Ignore the sink's errors.
+    DEGRADE,   ///< Stop writing to the sink after its first error.
+    PROPAGATE, ///< Report the sink's errors.
+};
+
+/**
+ * \brief Tee sink.
+ */
+struct Tee_Sink {
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] sink_buffer The sink's I/O stream device access buffer.
+     * \param[in] sink_policy The sink's failure policy.
+     */
+    constexpr Tee_Sink( Stream_Buffer * sink_buffer, Tee_Failure_Policy sink_policy ) noexcept :
+        buffer{ sink_buffer },
+        policy{ sink_policy }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * Reliable sinks never fail, so they do not have a failure policy.
+     *
+     * \param[in] sink_buffer The sink's reliable I/O stream device access buffer.
+     */
+    constexpr Tee_Sink( Reliable_Stream_Buffer * sink_buffer ) noexcept :
+        reliable_buffer{ sink_buffer }
+    {
+    }
+
+    /**
+     * \brief The sink's I/O stream device access buffer (nullptr if the sink is
+     *        reliable).
+     */
+    Stream_Buffer * buffer{};
+
+    /**
+     * \brief The sink's reliable I/O stream device access buffer (nullptr if the sink is
+     *        not reliable).
+     */
+    Reliable_Stream_Buffer * reliable_buffer{};
+
+    /**
+     * \brief The sink's failure policy (ignored if the sink is reliable).
+     */
+    Tee_Failure_Policy policy{ Tee_Failure_Policy::DROP };
+};
+
+/**
+ * \brief Fan-out (tee) I/O stream device access buffer.
+ *
+ * Each put is forwarded, unchanged, to each of the tee's sinks (picolibrary::Stream_Buffer
+ * or picolibrary::Reliable_Stream_Buffer). Block puts (including
+ * gather puts) are forwarded as a single block put. Each sink's errors are handled
+ * according to the sink's failure policy:
+ * - picolibrary::Tee_Failure_Policy::DROP: the sink's errors are ignored
+ * - picolibrary::Tee_Failure_Policy::DEGRADE: the sink is degraded (skipped by all
+ *   subsequent puts and flushes) after its first error, until degradation is cleared
+ *   using picolibrary::Tee_Stream_Buffer::clear_degradation()
+ * - picolibrary::Tee_Failure_Policy::PROPAGATE: the sink's errors are reported (the put
+ *   or flush is still forwarded to the remaining sinks, and the first error is reported)
+ *
+ * \tparam N The number of sinks.
+ */
+template<std::size_t N>
+class Tee_Stream_Buffer final : public Stream_Buffer {
+  public:
+    Tee_Stream_Buffer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Sinks The sink types (must be picolibrary::Tee_Sink).
+     *
+     * \param[in] sinks The sinks.
+     */
+    template<typename... Sinks>
+    constexpr Tee_Stream_Buffer( Sinks... sinks ) noexcept : m_sinks{ sinks... }
+    {
+        static_assert( sizeof...( Sinks ) == N );
+        static_assert( ( std::is_same_v<Sinks, Tee_Sink> and ... ) );
+    }
+
+    Tee_Stream_Buffer( Tee_Stream_Buffer && ) = delete;
+
+    Tee_Stream_Buffer( Tee_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Tee_Stream_Buffer() noexcept = default;
+
+    auto operator=( Tee_Stream_Buffer && ) = delete;
+
+    auto operator=( Tee_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Check if a sink is degraded.
+     *
+     * \pre sink < N
+     *
+     * \param[in] sink The index of the sink to check.
+     *
+     * \return true if the sink is degraded.
+     * \return false if the sink is not degraded.
+     */
+    auto degraded( std::size_t sink ) const noexcept -> bool
+    {
+        PICOLIBRARY_EXPECT( sink < N, Generic_Error::OUT_OF_RANGE );
+
+        return m_degraded[ sink ];
+    }
+
+    /**
+     * \brief Clear all sink degradation.
+     */
+    void clear_degradation() noexcept
+    {
+        for ( auto & degraded : m_degraded ) {
+            degraded = false;
+        } // for
+    }
+
+    /**
+     * \brief Write a character to each sink.
+     *
+     * \param[in] character The character to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( char character ) noexcept -> Result<void> override final
+    {
+        return forward( [ character ]( auto & buffer ) noexcept {
+            return buffer.put( character );
+        } );
+    }
+
+    /**
+     * \brief Write a block of characters to each sink.
+     *
+     * \param[in] begin The beginning of the block of characters to write to each sink.
+     * \param[in] end The end of the block of characters to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( char const * begin, char const * end ) noexcept -> Result<void> override final
+    {
+        return forward( [ begin, end ]( auto & buffer ) noexcept {
+            return buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a null-terminated string to each sink.
+     *
+     * \param[in] string The null-terminated string to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( char const * string ) noexcept -> Result<void> override final
+    {
+        return forward( [ string ]( auto & buffer ) noexcept {
+            return buffer.put( string );
+        } );
+    }
+
+#ifdef PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+    /**
+     * \brief Write a null-terminated ROM string to each sink.
+     *
+     * \param[in] string The null-terminated ROM string to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( ROM::String string ) noexcept -> Result<void> override final
+    {
+        return forward( [ string ]( auto & buffer ) noexcept {
+            return buffer.put( string );
+        } );
+    }
+#endif // PICOLIBRARY_ROM_STRING_IS_HIL_DEFINED
+
+    /**
+     * \brief Write an unsigned byte to each sink.
+     *
+     * \param[in] value The unsigned byte to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( std::uint8_t value ) noexcept -> Result<void> override final
+    {
+        return forward( [ value ]( auto & buffer ) noexcept { return buffer.put( value ); } );
+    }
+
+    /**
+     * \brief Write a block of unsigned bytes to each sink.
+     *
+     * \param[in] begin The beginning of the block of unsigned bytes to write to each
+     *            sink.
+     * \param[in] end The end of the block of unsigned bytes to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( std::uint8_t const * begin, std::uint8_t const * end ) noexcept -> Result<void> override final
+    {
+        return forward( [ begin, end ]( auto & buffer ) noexcept {
+            return buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write a signed byte to each sink.
+     *
+     * \param[in] value The signed byte to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( std::int8_t value ) noexcept -> Result<void> override final
+    {
+        return forward( [ value ]( auto & buffer ) noexcept { return buffer.put( value ); } );
+    }
+
+    /**
+     * \brief Write a block of signed bytes to each sink.
+     *
+     * \param[in] begin The beginning of the block of signed bytes to write to each sink.
+     * \param[in] end The end of the block of signed bytes to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( std::int8_t const * begin, std::int8_t const * end ) noexcept -> Result<void> override final
+    {
+        return forward( [ begin, end ]( auto & buffer ) noexcept {
+            return buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Write an array of segments to each sink.
+     *
+     * \param[in] begin The beginning of the array of segments to write to each sink.
+     * \param[in] end The end of the array of segments to write to each sink.
+     *
+     * \return Nothing if the write succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the write failed.
+     */
+    auto put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept -> Result<void> override final
+    {
+        return forward( [ begin, end ]( auto & buffer ) noexcept {
+            return buffer.put( begin, end );
+        } );
+    }
+
+    /**
+     * \brief Flush each sink.
+     *
+     * \return Nothing if the flush succeeded.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink if the flush failed.
+     */
+    auto flush() noexcept -> Result<void> override final
+    {
+        return forward( []( auto & buffer ) noexcept { return buffer.flush(); } );
+    }
+
+  private:
+    /**
+     * \brief The sinks.
+     */
+    Array<Tee_Sink, N> m_sinks;
+
+    /**
+     * \brief The sink degradation flags.
+     */
+    Array<bool, N> m_degraded{};
+
+    /**
+     * \brief Forward an operation to each sink that is not degraded.
+     *
+     * \tparam Operation The operation to forward. The operation must take the form
+     *         picolibrary::Result<void>( picolibrary::Stream_Buffer & ) and the form
+     *         void( picolibrary::Reliable_Stream_Buffer & ).
+     *
+     * \param[in] operation The operation to forward.
+     *
+     * \return Nothing if no picolibrary::Tee_Failure_Policy::PROPAGATE sink reported an
+     *         error.
+     * \return The first error reported by a picolibrary::Tee_Failure_Policy::PROPAGATE
+     *         sink.
+     */
+    template<typename Operation>
+    auto forward( Operation operation ) noexcept -> Result<void>
+    {
+        auto propagated = Result<void>{};
+
+        for ( auto sink = std::size_t{ 0 }; sink < N; ++sink ) {
+            if ( m_degraded[ sink ] ) {
+                continue;
+            } // if
+
+            if ( m_sinks[ sink ].reliable_buffer ) {
+                operation( *m_sinks[ sink ].reliable_buffer );
+
+                continue;
+            } // if
+
+            auto result = operation( *m_sinks[ sink ].buffer );
+            if ( result.is_error() ) {
+                switch ( m_sinks[ sink ].policy ) {
+                    case Tee_Failure_Policy::DROP: break;
+                    case Tee_Failure_Policy::DEGRADE: m_degraded[ sink ] = true; break;
+                    case Tee_Failure_Policy::PROPAGATE:
+                        if ( not propagated.is_error() ) {
+                            propagated = result.error();
+                        } // if
+                        break;
+                } // switch
+            }     // if
+        }         // for
+
+        return propagated;
+    }
+};
+
+/**
+ * \brief picolibrary::Tee_Stream_Buffer deduction guide.
+ *
+ * \tparam Sinks The sink types.
+ */
+template<typename... Sinks>
+Tee_Stream_Buffer( Sinks... ) -> Tee_Stream_Buffer<sizeof...( Sinks )>;
+
+/**
+ * \brief Fan-out (tee) output stream.
+ *
+ * Formatted and unformatted output written to the stream is formatted once, and then
+ * forwarded to each of the stream's sinks (see picolibrary::Tee_Stream_Buffer).
+ *
+ * \tparam N The number of sinks.
+ */
+template<std::size_t N>
+class Tee_Output_Stream : public Static_Output_Stream<Tee_Stream_Buffer<N>> {
+  public:
+    Tee_Output_Stream() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Sinks The sink types (must be picolibrary::Tee_Sink).
+     *
+     * \param[in] sinks The sinks.
+     */
+    template<typename... Sinks>
+    constexpr Tee_Output_Stream( Sinks... sinks ) noexcept : m_buffer{ sinks... }
+    {
+        this->set_buffer( &m_buffer );
+    }
+
+    Tee_Output_Stream( Tee_Output_Stream && ) = delete;
+
+    Tee_Output_Stream( Tee_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Tee_Output_Stream() noexcept = default;
+
+    auto operator=( Tee_Output_Stream && ) = delete;
+
+    auto operator=( Tee_Output_Stream const & ) = delete;
+
+    /**
+     * \brief Check if a sink is degraded.
+     *
+     * \pre sink < N
+     *
+     * \param[in] sink The index of the sink to check.
+     *
+     * \return true if the sink is degraded.
+     * \return false if the sink is not degraded.
+     */
+    auto degraded( std::size_t sink ) const noexcept -> bool
+    {
+        return m_buffer.degraded( sink );
+    }
+
+    /**
+     * \brief Clear all sink degradation.
+     */
+    void clear_degradation() noexcept
+    {
+        m_buffer.clear_degradation();
+    }
+
+  private:
+    /**
+     * \brief The stream's I/O stream device access buffer.
+     */
+    Tee_Stream_Buffer<N> m_buffer;
+};
+
+/**
+ * \brief picolibrary::Tee_Output_Stream deduction guide.
+ *
+ * \tparam Sinks The sink types.
+ */
+template<typename... Sinks>
+Tee_Output_Stream( Sinks... ) -> Tee_Output_Stream<sizeof...( Sinks )>;
+
+/**
+ * \brief Circular (crash log) I/O stream device access buffer.
+ *
+ * Characters written to the buffer are stored in a circular buffer. When the buffer is
+ * full, the oldest character is overwritten, so the buffer always holds the most recently
+ * written output (e.g. for inclusion in a crash report). Writes never fail, so the buffer
+ * can be used as a reliable picolibrary::Tee_Stream_Buffer sink.
+ *
+ * \tparam Size_Type The unsigned integer type used to track the number of characters in
+ *         the buffer.
+ * \tparam N The maximum number of characters in the buffer (must be a power of two).
+ */
+template<typename Size_Type, Size_Type N>
+class Circular_Stream_Buffer final : public Reliable_Stream_Buffer {
+  public:
+    /**
+     * \brief Unsigned integer type used to track the number of characters in the buffer.
+     */
+    using Size = Size_Type;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Circular_Stream_Buffer() noexcept = default;
+
+    Circular_Stream_Buffer( Circular_Stream_Buffer && ) = delete;
+
+    Circular_Stream_Buffer( Circular_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Circular_Stream_Buffer() noexcept = default;
+
+    auto operator=( Circular_Stream_Buffer && ) = delete;
+
+    auto operator=( Circular_Stream_Buffer const & ) = delete;
+
+    /**
+     * \brief Check if the buffer is empty.
+     *
+     * \return true if the buffer is empty.
+     * \return false if the buffer is not empty.
+     */
+    auto empty() const noexcept -> bool
+    {
+        return m_characters.empty();
+    }
+
+    /**
+     * \brief Get the number of characters in the buffer.
+     *
+     * \return The number of characters in the buffer.
+     */
+    auto size() const noexcept -> Size
+    {
+        return m_characters.size();
+    }
+
+    /**
+     * \brief Get the number of characters that have been overwritten since the buffer was
+     *        last cleared.
+     *
+     * \return The number of characters that have been overwritten since the buffer was
+     *         last cleared.
+     */
+    auto overwritten() const noexcept -> std::uint_fast32_t
+    {
+        return m_overwritten;
+    }
+
+    /**
+     * \brief Get the oldest character in the buffer.
+     *
+     * \pre not empty()
+     *
+     * \return The oldest character in the buffer.
+     */
+    auto front() const noexcept -> char
+    {
+        return m_characters.front();
+    }
+
+    /**
+     * \brief Remove the oldest character from the buffer.
+     *
+     * \pre not empty()
+     */
+    void pop() noexcept
+    {
+        m_characters.pop();
+    }
+
+    /**
+     * \brief Remove all characters from the buffer.
+     */
+    void clear() noexcept
+    {
+        m_characters.clear();
+        m_overwritten = 0;
+    }
+
+    /**
+     * \brief Write a character to the buffer, overwriting the oldest character if the
+     *        buffer is full.
+     *
+     * \param[in] character The character to write to the buffer.
+     */
+    void put( char character ) noexcept override final
+    {
+        if ( m_characters.full() ) {
+            m_characters.pop();
+            ++m_overwritten;
+        } // if
+
+        m_characters.push( character );
+    }
+
+    using Reliable_Stream_Buffer::put;
+
+    /**
+     * \brief Write an unsigned byte to the buffer, overwriting the oldest character if the
+     *        buffer is full.
+     *
+     * \param[in] value The unsigned byte to write to the buffer.
+     */
+    void put( std::uint8_t value ) noexcept override final
+    {
+        put( static_cast<char>( value ) );
+    }
+
+    /**
+     * \brief Write a signed byte to the buffer, overwriting the oldest character if the
+     *        buffer is full.
+     *
+     * \param[in] value The signed byte to write to the buffer.
+     */
+    void put( std::int8_t value ) noexcept override final
+    {
+        put( static_cast<char>( value ) );
+    }
+
+    /**
+     * \brief Flush the buffer (does nothing).
+     */
+    void flush() noexcept override final
+    {
+    }
+
+  private:
+    /**
+     * \brief The buffered characters.
+     */
+    Circular_Buffer<char, Size_Type, N, Circular_Buffer_Use_Case::MAIN_READS_MAIN_WRITES> m_characters{};
+
+    /**
+     * \brief The number of characters that have been overwritten since the buffer was
+     *        last cleared.
+     */
+    std::uint_fast32_t m_overwritten{};
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_TEE_STREAM_H
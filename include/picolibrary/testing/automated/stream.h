@@ -79,6 +79,18 @@ class Mock_Stream_Buffer : public Stream_Buffer {
         return put( std::vector<std::int8_t>{ begin, end } );
     }
 
+    MOCK_METHOD( (Result<void>), put, (std::vector<std::vector<std::uint8_t>>));
+
+    auto put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept -> Result<void> override
+    {
+        auto segments = std::vector<std::vector<std::uint8_t>>{};
+        for ( ; begin != end; ++begin ) {
+            segments.emplace_back( begin->begin, begin->end );
+        } // for
+
+        return put( segments );
+    }
+
     MOCK_METHOD( (Result<void>), flush, (), ( noexcept, override ) );
 };
 
@@ -439,6 +451,18 @@ class Mock_Reliable_Stream_Buffer : public Reliable_Stream_Buffer {
         put( std::vector<std::int8_t>{ begin, end } );
     }
 
+    MOCK_METHOD( void, put, (std::vector<std::vector<std::uint8_t>>));
+
+    void put( Stream_Segment const * begin, Stream_Segment const * end ) noexcept override
+    {
+        auto segments = std::vector<std::vector<std::uint8_t>>{};
+        for ( ; begin != end; ++begin ) {
+            segments.emplace_back( begin->begin, begin->end );
+        } // for
+
+        put( segments );
+    }
+
     MOCK_METHOD( void, flush, (), ( noexcept, override ) );
 };
 
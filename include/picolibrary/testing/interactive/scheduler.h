@@ -0,0 +1,364 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Testing::Interactive::Scheduler interface.
+ */
+
+#ifndef PICOLIBRARY_TESTING_INTERACTIVE_SCHEDULER_H
+#define PICOLIBRARY_TESTING_INTERACTIVE_SCHEDULER_H
+
+#include <cstdint>
+#include <utility>
+
+#include "picolibrary/active_object.h"
+#include "picolibrary/error.h"
+#include "picolibrary/event.h"
+#include "picolibrary/format.h"
+#include "picolibrary/precondition.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/scheduler.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/utility.h"
+
+/**
+ * \brief Scheduler interactive testing facilities.
+ */
+namespace picolibrary::Testing::Interactive::Scheduler {
+
+/**
+ * \brief Benchmark event.
+ */
+enum class Benchmark_Event : Event_ID {
+    PING, ///< Ping.
+};
+
+/**
+ * \brief Benchmark event category.
+ */
+class Benchmark_Event_Category final : public Event_Category {
+  public:
+    /**
+     * \brief Get a reference to the benchmark event category instance.
+     *
+     * \return A reference to the benchmark event category instance.
+     */
+    static constexpr auto instance() noexcept -> Benchmark_Event_Category const &
+    {
+        return INSTANCE;
+    }
+
+    Benchmark_Event_Category( Benchmark_Event_Category && ) = delete;
+
+    Benchmark_Event_Category( Benchmark_Event_Category const & ) = delete;
+
+    auto operator=( Benchmark_Event_Category && ) = delete;
+
+    auto operator=( Benchmark_Event_Category const & ) = delete;
+
+    /**
+     * \brief Get the name of the benchmark event category.
+     *
+     * \return The name of the benchmark event category.
+     */
+#ifndef PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+    auto name() const noexcept -> ROM::String override final
+    {
+        return PICOLIBRARY_ROM_STRING( "::picolibrary::Testing::Interactive::Scheduler::Benchmark_Event" );
+    }
+#endif // PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+
+    /**
+     * \brief Get a benchmark event's description.
+     *
+     * \param[in] id The ID of the benchmark event whose description is to be got.
+     *
+     * \return The benchmark event's description.
+     */
+#ifndef PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+    auto event_description( Event_ID id ) const noexcept -> ROM::String override final
+    {
+        switch ( static_cast<Benchmark_Event>( id ) ) {
+            case Benchmark_Event::PING: return PICOLIBRARY_ROM_STRING( "PING" );
+        } // switch
+
+        return PICOLIBRARY_ROM_STRING( "UNKNOWN" );
+    }
+#endif // PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+
+  private:
+    /**
+     * \brief The benchmark event category instance.
+     */
+    static Benchmark_Event_Category const INSTANCE;
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Benchmark_Event_Category() noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Benchmark_Event_Category() noexcept = default;
+};
+
+/**
+ * \brief Benchmark statistics.
+ *
+ * \tparam Tick The tick source's tick count type.
+ */
+template<typename Tick>
+struct Benchmark_Statistics {
+    /**
+     * \brief The number of events that remain to be posted.
+     */
+    std::uint_fast32_t remaining{};
+
+    /**
+     * \brief The number of events that have been dispatched.
+     */
+    std::uint_fast32_t dispatched{};
+
+    /**
+     * \brief The tick count when the most recent event was posted.
+     */
+    Tick post_tick{};
+
+    /**
+     * \brief The sum of the dispatch latencies (ticks).
+     */
+    std::uint64_t latency_total{};
+
+    /**
+     * \brief The maximum dispatch latency (ticks).
+     */
+    Tick latency_max{};
+};
+
+/**
+ * \brief Benchmark active object.
+ *
+ * Each dispatched event records its dispatch latency (the time from the event being
+ * posted to the event being dispatched), and then posts an event to the active object's
+ * peer until the requested number of events have been posted.
+ *
+ * \tparam Interrupt_Controller The type of interrupt controller used by the main thread
+ *         of execution to manipulate the interrupt enable state of any interrupts that
+ *         post events to the active object.
+ * \tparam Tick_Source The type of tick source used to measure dispatch latency.
+ */
+template<typename Interrupt_Controller, typename Tick_Source>
+class Benchmark_Active_Object :
+    public Active_Object<Benchmark_Active_Object<Interrupt_Controller, Tick_Source>, sizeof( Simple_Event ), std::uint_fast8_t, 2, Interrupt_Controller> {
+  public:
+    /**
+     * \brief The tick source's tick count type.
+     */
+    using Tick = typename Tick_Source::Tick;
+
+    Benchmark_Active_Object() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] interrupt_controller The interrupt controller used by the main thread of
+     *            execution to manipulate the interrupt enable state of any interrupts
+     *            that post events to the active object.
+     * \param[in] tick_source The tick source used to measure dispatch latency.
+     * \param[in] statistics The benchmark statistics to update.
+     */
+    Benchmark_Active_Object(
+        Interrupt_Controller         interrupt_controller,
+        Tick_Source const &          tick_source,
+        Benchmark_Statistics<Tick> & statistics ) noexcept :
+        Benchmark_Active_Object::Active_Object{ std::move( interrupt_controller ) },
+        m_tick_source{ &tick_source },
+        m_statistics{ &statistics }
+    {
+    }
+
+    Benchmark_Active_Object( Benchmark_Active_Object && ) = delete;
+
+    Benchmark_Active_Object( Benchmark_Active_Object const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Benchmark_Active_Object() noexcept = default;
+
+    auto operator=( Benchmark_Active_Object && ) = delete;
+
+    auto operator=( Benchmark_Active_Object const & ) = delete;
+
+    /**
+     * \brief Set the active object's peer.
+     *
+     * \param[in] peer The active object to post events to.
+     */
+    void pair( Benchmark_Active_Object & peer ) noexcept
+    {
+        m_peer = &peer;
+    }
+
+    /**
+     * \brief Post an event and record the tick count it was posted at.
+     */
+    void ping() noexcept
+    {
+        --m_statistics->remaining;
+        m_statistics->post_tick = m_tick_source->ticks();
+
+        this->post( Simple_Event{ Benchmark_Event_Category::instance(),
+                                  to_underlying( Benchmark_Event::PING ) } );
+    }
+
+  private:
+    friend typename Benchmark_Active_Object::Active_Object;
+
+    /**
+     * \brief The tick source used to measure dispatch latency.
+     */
+    Tick_Source const * m_tick_source;
+
+    /**
+     * \brief The benchmark statistics to update.
+     */
+    Benchmark_Statistics<Tick> * m_statistics;
+
+    /**
+     * \brief The active object to post events to.
+     */
+    Benchmark_Active_Object * m_peer{};
+
+    /**
+     * \brief Dispatch an event.
+     */
+    void dispatch( Event const & ) noexcept
+    {
+        auto const latency = static_cast<Tick>( m_tick_source->ticks() - m_statistics->post_tick );
+
+        ++m_statistics->dispatched;
+        m_statistics->latency_total += latency;
+        if ( latency > m_statistics->latency_max ) {
+            m_statistics->latency_max = latency;
+        } // if
+
+        if ( m_statistics->remaining and m_peer ) {
+            m_peer->ping();
+        } // if
+    }
+};
+
+/**
+ * \brief Scheduler events per second and dispatch latency benchmark interactive test
+ *        helper.
+ *
+ * Two active objects (one at the highest priority level and one at the lowest priority
+ * level) post events to each other through a picolibrary::Scheduler until the requested
+ * number of events have been dispatched. The number of events dispatched per second, and
+ * the mean and maximum dispatch latency (the time from an event being posted to the event
+ * being dispatched, including the cost of reading the tick source) are then written to
+ * the output stream.
+ *
+ * \tparam Interrupt_Controller The type of interrupt controller used by the main thread
+ *         of execution to manipulate the interrupt enable state of any interrupts that
+ *         post events to the scheduler's active objects (must be copyable).
+ * \tparam Tick_Source The type of tick source used to measure time (must have a Tick
+ *         unsigned integer member type, and a ticks() const member function that returns
+ *         the current tick count).
+ * \tparam Delayer A nullary functor called to introduce a delay between benchmark runs.
+ *
+ * \param[in] stream The output stream to write the benchmark results to.
+ * \param[in] interrupt_controller The interrupt controller used by the main thread of
+ *            execution to manipulate the interrupt enable state of any interrupts that
+ *            post events to the scheduler's active objects.
+ * \param[in] tick_source The tick source used to measure time. The tick count must not
+ *            wrap around more than once during a benchmark run.
+ * \param[in] ticks_per_second The tick source's tick rate.
+ * \param[in] events The number of events to dispatch during each benchmark run (must be
+ *            greater than zero).
+ * \param[in] delay The nullary functor to call to introduce a delay between benchmark
+ *            runs.
+ *
+ * \pre events > 0
+ */
+template<typename Interrupt_Controller, typename Tick_Source, typename Delayer>
+[[noreturn]] void benchmark(
+    Reliable_Output_Stream & stream,
+    Interrupt_Controller     interrupt_controller,
+    Tick_Source              tick_source,
+    std::uint_fast32_t       ticks_per_second,
+    std::uint_fast32_t       events,
+    Delayer                  delay ) noexcept
+{
+    PICOLIBRARY_EXPECT( events, Generic_Error::INVALID_ARGUMENT );
+
+    using Tick = typename Tick_Source::Tick;
+
+    for ( ;; ) {
+        auto statistics = Benchmark_Statistics<Tick>{};
+
+        auto ping = Benchmark_Active_Object<Interrupt_Controller, Tick_Source>{ interrupt_controller,
+                                                                              tick_source,
+                                                                              statistics };
+        auto pong = Benchmark_Active_Object<Interrupt_Controller, Tick_Source>{ interrupt_controller,
+                                                                              tick_source,
+                                                                              statistics };
+
+        ping.pair( pong );
+        pong.pair( ping );
+
+        auto scheduler = ::picolibrary::Scheduler<32, Interrupt_Controller>{ interrupt_controller };
+
+        scheduler.add( 0, ping );
+        scheduler.add( 31, pong );
+
+        statistics.remaining = events;
+
+        auto const begin = tick_source.ticks();
+
+        ping.ping();
+
+        while ( scheduler.dispatch() ) {} // while
+
+        auto const elapsed = static_cast<Tick>( tick_source.ticks() - begin );
+
+        stream.print(
+            PICOLIBRARY_ROM_STRING( "events: " ),
+            Format::Dec{ statistics.dispatched },
+            PICOLIBRARY_ROM_STRING( ", elapsed (ticks): " ),
+            Format::Dec{ elapsed },
+            PICOLIBRARY_ROM_STRING( ", events/s: " ),
+            Format::Dec{ elapsed ? static_cast<std::uint64_t>( statistics.dispatched ) * ticks_per_second / elapsed
+                                 : std::uint64_t{ 0 } },
+            PICOLIBRARY_ROM_STRING( ", mean dispatch latency (ticks): " ),
+            Format::Dec{ statistics.dispatched ? statistics.latency_total / statistics.dispatched
+                                               : std::uint64_t{ 0 } },
+            PICOLIBRARY_ROM_STRING( ", max dispatch latency (ticks): " ),
+            Format::Dec{ statistics.latency_max },
+            '\n' );
+        stream.flush();
+
+        delay();
+    } // for
+}
+
+} // namespace picolibrary::Testing::Interactive::Scheduler
+
+#endif // PICOLIBRARY_TESTING_INTERACTIVE_SCHEDULER_H
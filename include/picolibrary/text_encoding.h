@@ -0,0 +1,531 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Text_Encoding interface.
+ */
+
+#ifndef PICOLIBRARY_TEXT_ENCODING_H
+#define PICOLIBRARY_TEXT_ENCODING_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "picolibrary/array.h"
+#include "picolibrary/error.h"
+#include "picolibrary/result.h"
+
+/**
+ * \brief Binary-to-text encoding facilities (RFC 4648 Base16 and Base64).
+ */
+namespace picolibrary::Text_Encoding {
+
+/**
+ * \brief Nibble to Base16 (hexadecimal) digit lookup table.
+ */
+inline constexpr auto BASE16_ENCODE_LOOKUP_TABLE = Array<char, 16>{
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+};
+
+/**
+ * \brief Sextet to Base64 character lookup table.
+ */
+inline constexpr auto BASE64_ENCODE_LOOKUP_TABLE = Array<char, 64>{
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/',
+};
+
+/**
+ * \brief Base64 padding character.
+ */
+constexpr auto BASE64_PADDING = char{ '=' };
+
+/**
+ * \brief Base64 character to sextet lookup table.
+ */
+using Base64_Decode_Lookup_Table = Array<std::uint8_t, 128>;
+
+/**
+ * \brief Base64 character to sextet lookup table invalid character entry.
+ */
+constexpr auto BASE64_INVALID_CHARACTER = std::uint8_t{ 0xFF };
+
+/**
+ * \brief Generate the Base64 character to sextet lookup table.
+ *
+ * \return The generated Base64 character to sextet lookup table.
+ */
+constexpr auto generate_base64_decode_lookup_table() noexcept -> Base64_Decode_Lookup_Table
+{
+    Base64_Decode_Lookup_Table lookup_table{};
+
+    for ( auto & entry : lookup_table ) {
+        entry = BASE64_INVALID_CHARACTER;
+    } // for
+
+    for ( auto sextet = std::uint_fast8_t{ 0 }; sextet < BASE64_ENCODE_LOOKUP_TABLE.size(); ++sextet ) {
+        lookup_table[ static_cast<std::uint8_t>( BASE64_ENCODE_LOOKUP_TABLE[ sextet ] ) ] = sextet;
+    } // for
+
+    return lookup_table;
+}
+
+/**
+ * \brief Base64 character to sextet lookup table.
+ */
+inline constexpr auto BASE64_DECODE_LOOKUP_TABLE = generate_base64_decode_lookup_table();
+
+/**
+ * \brief Get the number of characters required to Base16 encode data.
+ *
+ * \param[in] size The size of the data to encode.
+ *
+ * \return The number of characters required to Base16 encode the data.
+ */
+constexpr auto base16_encoded_size( std::size_t size ) noexcept -> std::size_t
+{
+    return size * 2;
+}
+
+/**
+ * \brief Get the number of characters required to Base64 encode data (including
+ *        padding).
+ *
+ * \param[in] size The size of the data to encode.
+ *
+ * \return The number of characters required to Base64 encode the data.
+ */
+constexpr auto base64_encoded_size( std::size_t size ) noexcept -> std::size_t
+{
+    return ( ( size + 2 ) / 3 ) * 4;
+}
+
+/**
+ * \brief Base16 encode data.
+ *
+ * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ *
+ * \param[in] begin The beginning of the data to encode.
+ * \param[in] end The end of the data to encode.
+ * \param[out] output The beginning of the block to write the encoded data to (must be
+ *             able to hold picolibrary::Text_Encoding::base16_encoded_size() characters).
+ *
+ * \return The end of the encoded data.
+ */
+template<typename Iterator>
+constexpr auto encode_base16( Iterator begin, Iterator end, char * output ) noexcept -> char *
+{
+    for ( ; begin != end; ++begin ) {
+        auto const byte = static_cast<std::uint8_t>( *begin );
+
+        output[ 0 ] = BASE16_ENCODE_LOOKUP_TABLE[ byte >> 4 ];
+        output[ 1 ] = BASE16_ENCODE_LOOKUP_TABLE[ byte & 0xF ];
+
+        output += 2;
+    } // for
+
+    return output;
+}
+
+/**
+ * \brief Base64 encode data.
+ *
+ * Data is encoded in 3 byte groups. If the data's size is not a multiple of 3, the final
+ * group is padded.
+ *
+ * \tparam Iterator Data iterator. Data must be convertible to std::uint8_t.
+ *
+ * \param[in] begin The beginning of the data to encode.
+ * \param[in] end The end of the data to encode.
+ * \param[out] output The beginning of the block to write the encoded data to (must be
+ *             able to hold picolibrary::Text_Encoding::base64_encoded_size() characters).
+ *
+ * \return The end of the encoded data.
+ */
+template<typename Iterator>
+constexpr auto encode_base64( Iterator begin, Iterator end, char * output ) noexcept -> char *
+{
+    while ( begin != end ) {
+        auto group = std::uint_fast32_t{ static_cast<std::uint8_t>( *begin ) } << 16;
+        auto bytes = std::uint_fast8_t{ 1 };
+
+        for ( ++begin; begin != end and bytes < 3; ++begin, ++bytes ) {
+            group |= std::uint_fast32_t{ static_cast<std::uint8_t>( *begin ) } << ( 16 - 8 * bytes );
+        } // for
+
+        output[ 0 ] = BASE64_ENCODE_LOOKUP_TABLE[ ( group >> 18 ) & 0x3F ];
+        output[ 1 ] = BASE64_ENCODE_LOOKUP_TABLE[ ( group >> 12 ) & 0x3F ];
+        output[ 2 ] = bytes > 1 ? BASE64_ENCODE_LOOKUP_TABLE[ ( group >> 6 ) & 0x3F ] : BASE64_PADDING;
+        output[ 3 ] = bytes > 2 ? BASE64_ENCODE_LOOKUP_TABLE[ group & 0x3F ] : BASE64_PADDING;
+
+        output += 4;
+    } // while
+
+    return output;
+}
+
+/**
+ * \brief Streaming Base16 decoder.
+ *
+ * Encoded data can be decoded directly from a sequence of received ranges. A digit pair
+ * split across ranges is carried over to the next range. Both upper and lower case
+ * digits are accepted.
+ */
+class Base16_Decoder {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Base16_Decoder() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Base16_Decoder( Base16_Decoder && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Base16_Decoder( Base16_Decoder const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Base16_Decoder() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Base16_Decoder && expression ) noexcept -> Base16_Decoder & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Base16_Decoder const & expression ) noexcept -> Base16_Decoder & = default;
+
+    /**
+     * \brief Get the maximum number of bytes decoding a range of characters can produce.
+     *
+     * \param[in] characters The number of characters in the range.
+     *
+     * \return The maximum number of bytes decoding the range can produce.
+     */
+    constexpr auto decoded_size_max( std::size_t characters ) const noexcept -> std::size_t
+    {
+        return ( characters + ( m_pending ? 1 : 0 ) ) / 2;
+    }
+
+    /**
+     * \brief Decode a range of characters.
+     *
+     * \tparam Iterator Character iterator. Characters must be convertible to
+     *         std::uint8_t.
+     *
+     * \param[in] begin The beginning of the range of characters to decode.
+     * \param[in] end The end of the range of characters to decode.
+     * \param[out] output The beginning of the block to write the decoded data to (must be
+     *             able to hold picolibrary::Text_Encoding::Base16_Decoder::decoded_size_max()
+     *             bytes).
+     *
+     * \return The end of the decoded data if decoding succeeded.
+     * \return picolibrary::Generic_Error::RUNTIME_ERROR if an invalid character was
+     *         encountered. The decoder must be reset before it is used again.
+     */
+    template<typename Iterator>
+    constexpr auto decode( Iterator begin, Iterator end, std::uint8_t * output ) noexcept
+        -> Result<std::uint8_t *>
+    {
+        for ( ; begin != end; ++begin ) {
+            auto const nibble = decode_digit( static_cast<std::uint8_t>( *begin ) );
+            if ( nibble > 0xF ) {
+                return Generic_Error::RUNTIME_ERROR;
+            } // if
+
+            if ( not m_pending ) {
+                m_high    = nibble;
+                m_pending = true;
+            } else {
+                *output = static_cast<std::uint8_t>( ( m_high << 4 ) | nibble );
+                ++output;
+
+                m_pending = false;
+            } // else
+        }     // for
+
+        return output;
+    }
+
+    /**
+     * \brief Complete decoding, and reset the decoder.
+     *
+     * \return Nothing if the encoded data was complete.
+     * \return picolibrary::Generic_Error::RUNTIME_ERROR if a digit pair was incomplete.
+     */
+    constexpr auto finish() noexcept -> Result<void>
+    {
+        auto const pending = m_pending;
+
+        reset();
+
+        if ( pending ) {
+            return Generic_Error::RUNTIME_ERROR;
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Reset the decoder.
+     */
+    constexpr void reset() noexcept
+    {
+        m_high    = 0;
+        m_pending = false;
+    }
+
+  private:
+    /**
+     * \brief The high nibble of the digit pair that is being decoded.
+     */
+    std::uint8_t m_high{};
+
+    /**
+     * \brief The high nibble of the digit pair that is being decoded has been received.
+     */
+    bool m_pending{};
+
+    /**
+     * \brief Decode a Base16 digit.
+     *
+     * \param[in] digit The digit to decode.
+     *
+     * \return The decoded nibble if the digit is valid.
+     * \return A value greater than 0xF if the digit is invalid.
+     */
+    static constexpr auto decode_digit( std::uint8_t digit ) noexcept -> std::uint8_t
+    {
+        if ( digit >= '0' and digit <= '9' ) {
+            return static_cast<std::uint8_t>( digit - '0' );
+        } // if
+
+        auto const letter = static_cast<std::uint8_t>( digit | 0x20 );
+        if ( letter >= 'a' and letter <= 'f' ) {
+            return static_cast<std::uint8_t>( letter - 'a' + 0xA );
+        } // if
+
+        return 0xFF;
+    }
+};
+
+/**
+ * \brief Streaming Base64 decoder.
+ *
+ * Encoded data can be decoded directly from a sequence of received ranges. A character
+ * group split across ranges is carried over to the next range. Encoded data must be
+ * padded. Once a padded group has been decoded, no additional characters are accepted
+ * until the decoder is finished or reset.
+ */
+class Base64_Decoder {
+  public:
+    /**
+     * \brief Constructor.
+     */
+    constexpr Base64_Decoder() noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] source The source of the move.
+     */
+    constexpr Base64_Decoder( Base64_Decoder && source ) noexcept = default;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] original The original to copy.
+     */
+    constexpr Base64_Decoder( Base64_Decoder const & original ) noexcept = default;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Base64_Decoder() noexcept = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Base64_Decoder && expression ) noexcept -> Base64_Decoder & = default;
+
+    /**
+     * \brief Assignment operator.
+     *
+     * \param[in] expression The expression to be assigned.
+     *
+     * \return The assigned to object.
+     */
+    constexpr auto operator=( Base64_Decoder const & expression ) noexcept -> Base64_Decoder & = default;
+
+    /**
+     * \brief Get the maximum number of bytes decoding a range of characters can produce.
+     *
+     * \param[in] characters The number of characters in the range.
+     *
+     * \return The maximum number of bytes decoding the range can produce.
+     */
+    constexpr auto decoded_size_max( std::size_t characters ) const noexcept -> std::size_t
+    {
+        return ( ( characters + m_characters ) / 4 ) * 3;
+    }
+
+    /**
+     * \brief Decode a range of characters.
+     *
+     * \tparam Iterator Character iterator. Characters must be convertible to
+     *         std::uint8_t.
+     *
+     * \param[in] begin The beginning of the range of characters to decode.
+     * \param[in] end The end of the range of characters to decode.
+     * \param[out] output The beginning of the block to write the decoded data to (must be
+     *             able to hold picolibrary::Text_Encoding::Base64_Decoder::decoded_size_max()
+     *             bytes).
+     *
+     * \return The end of the decoded data if decoding succeeded.
+     * \return picolibrary::Generic_Error::RUNTIME_ERROR if an invalid character, misplaced
+     *         padding, or a character following padding was encountered. The decoder must
+     *         be reset before it is used again.
+     */
+    template<typename Iterator>
+    constexpr auto decode( Iterator begin, Iterator end, std::uint8_t * output ) noexcept
+        -> Result<std::uint8_t *>
+    {
+        for ( ; begin != end; ++begin ) {
+            auto const character = static_cast<std::uint8_t>( *begin );
+
+            if ( m_complete ) {
+                return Generic_Error::RUNTIME_ERROR;
+            } // if
+
+            if ( character == BASE64_PADDING ) {
+                if ( m_characters < 2 ) {
+                    return Generic_Error::RUNTIME_ERROR;
+                } // if
+
+                ++m_padding;
+            } else {
+                auto const sextet = character < BASE64_DECODE_LOOKUP_TABLE.size()
+                                        ? BASE64_DECODE_LOOKUP_TABLE[ character ]
+                                        : BASE64_INVALID_CHARACTER;
+                if ( sextet == BASE64_INVALID_CHARACTER or m_padding ) {
+                    return Generic_Error::RUNTIME_ERROR;
+                } // if
+
+                m_group |= std::uint_fast32_t{ sextet } << ( 18 - 6 * m_characters );
+            } // else
+
+            if ( ++m_characters == 4 ) {
+                output[ 0 ] = static_cast<std::uint8_t>( m_group >> 16 );
+                output[ 1 ] = static_cast<std::uint8_t>( m_group >> 8 );
+                output[ 2 ] = static_cast<std::uint8_t>( m_group );
+
+                output += 3 - m_padding;
+
+                m_complete   = m_padding != 0;
+                m_group      = 0;
+                m_characters = 0;
+                m_padding    = 0;
+            } // if
+        }     // for
+
+        return output;
+    }
+
+    /**
+     * \brief Complete decoding, and reset the decoder.
+     *
+     * \return Nothing if the encoded data was complete.
+     * \return picolibrary::Generic_Error::RUNTIME_ERROR if a character group was
+     *         incomplete.
+     */
+    constexpr auto finish() noexcept -> Result<void>
+    {
+        auto const characters = m_characters;
+
+        reset();
+
+        if ( characters ) {
+            return Generic_Error::RUNTIME_ERROR;
+        } // if
+
+        return {};
+    }
+
+    /**
+     * \brief Reset the decoder.
+     */
+    constexpr void reset() noexcept
+    {
+        m_group      = 0;
+        m_characters = 0;
+        m_padding    = 0;
+        m_complete   = false;
+    }
+
+  private:
+    /**
+     * \brief The character group that is being decoded.
+     */
+    std::uint_fast32_t m_group{};
+
+    /**
+     * \brief The number of characters in the character group that is being decoded.
+     */
+    std::uint_fast8_t m_characters{};
+
+    /**
+     * \brief The number of padding characters in the character group that is being
+     *        decoded.
+     */
+    std::uint_fast8_t m_padding{};
+
+    /**
+     * \brief A padded character group has been decoded.
+     */
+    bool m_complete{};
+};
+
+} // namespace picolibrary::Text_Encoding
+
+#endif // PICOLIBRARY_TEXT_ENCODING_H
@@ -0,0 +1,564 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary timer interface.
+ */
+
+#ifndef PICOLIBRARY_TIMER_H
+#define PICOLIBRARY_TIMER_H
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "picolibrary/array.h"
+#include "picolibrary/error.h"
+#include "picolibrary/precondition.h"
+
+namespace picolibrary {
+
+/**
+ * \brief Software timer.
+ *
+ * When the timer expires, the timer's callback is called by the timer service the timer
+ * was started with.
+ *
+ * \attention A timer must not be moved or copied since a running timer is linked into
+ *            its timer service's timing wheel. Destroying a running timer stops it.
+ */
+class Timer {
+  public:
+    /**
+     * \brief Tick count.
+     */
+    using Tick = std::uint32_t;
+
+    /**
+     * \brief Timer expiration callback.
+     *
+     * \param[in] context The timer's callback context.
+     */
+    using Callback = void ( * )( void * context ) noexcept;
+
+    Timer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] callback The callback to call when the timer expires.
+     * \param[in] context The context to pass to the callback.
+     */
+    constexpr Timer( Callback callback, void * context ) noexcept :
+        m_callback{ callback },
+        m_context{ context }
+    {
+    }
+
+    /**
+     * \brief Constructor.
+     *
+     * \tparam Function The type of function object to call when the timer expires (must
+     *         be callable with no arguments).
+     *
+     * \param[in] function The function object to call when the timer expires (must
+     *            outlive the timer).
+     */
+    template<typename Function, typename = std::enable_if_t<not std::is_base_of_v<Timer, Function>>>
+    constexpr Timer( Function & function ) noexcept :
+        m_callback{ []( void * context ) noexcept { ( *static_cast<Function *>( context ) )(); } },
+        m_context{ &function }
+    {
+    }
+
+    Timer( Timer && ) = delete;
+
+    Timer( Timer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Timer() noexcept
+    {
+        unlink();
+    }
+
+    auto operator=( Timer && ) = delete;
+
+    auto operator=( Timer const & ) = delete;
+
+    /**
+     * \brief Check if the timer is running.
+     *
+     * \return true if the timer is running.
+     * \return false if the timer is not running.
+     */
+    auto is_running() const noexcept -> bool
+    {
+        return m_link;
+    }
+
+    /**
+     * \brief Get the tick count at which the timer will expire.
+     *
+     * \warning The value returned by this function is only meaningful while the timer is
+     *          running.
+     *
+     * \return The tick count at which the timer will expire.
+     */
+    auto expiration() const noexcept -> Tick
+    {
+        return m_expiration;
+    }
+
+    /**
+     * \brief Get the timer's period.
+     *
+     * \return The timer's period (0 if the timer is a one-shot timer).
+     */
+    auto period() const noexcept -> Tick
+    {
+        return m_period;
+    }
+
+  private:
+    template<std::uint_fast8_t, std::uint_fast8_t>
+    friend class Timer_Service;
+
+    /**
+     * \brief The callback to call when the timer expires.
+     */
+    Callback m_callback;
+
+    /**
+     * \brief The context to pass to the callback.
+     */
+    void * m_context;
+
+    /**
+     * \brief The next timer in the timing wheel slot the timer is linked into.
+     */
+    Timer * m_next{};
+
+    /**
+     * \brief The pointer that links the timer into a timing wheel slot (nullptr if the
+     *        timer is not running).
+     */
+    Timer ** m_link{};
+
+    /**
+     * \brief The tick count at which the timer will expire.
+     */
+    Tick m_expiration{};
+
+    /**
+     * \brief The timer's period (0 if the timer is a one-shot timer).
+     */
+    Tick m_period{};
+
+    /**
+     * \brief Link the timer into a timing wheel slot.
+     *
+     * \param[in] slot The timing wheel slot.
+     */
+    void link( Timer *& slot ) noexcept
+    {
+        m_next = slot;
+        m_link = &slot;
+
+        if ( m_next ) {
+            m_next->m_link = &m_next;
+        } // if
+
+        slot = this;
+    }
+
+    /**
+     * \brief Unlink the timer from the timing wheel slot it is linked into (if any).
+     */
+    void unlink() noexcept
+    {
+        if ( m_link ) {
+            *m_link = m_next;
+
+            if ( m_next ) {
+                m_next->m_link = m_link;
+            } // if
+
+            m_next = nullptr;
+            m_link = nullptr;
+        } // if
+    }
+
+    /**
+     * \brief Call the timer's callback.
+     */
+    void expire() noexcept
+    {
+        m_callback( m_context );
+    }
+};
+
+/**
+ * \brief Timer that posts a timeout event when it expires.
+ *
+ * \tparam Target The type of object to post the timeout event to (e.g. a
+ *         picolibrary::Active_Object derived class).
+ * \tparam Event The type of timeout event to post.
+ */
+template<typename Target, typename Event>
+class Event_Timer : public Timer {
+  public:
+    Event_Timer() = delete;
+
+    /**
+     * \brief Constructor.
+     *
+     * \param[in] target The object to post the timeout event to.
+     * \param[in] event The timeout event to post.
+     */
+    constexpr Event_Timer( Target & target, Event event ) noexcept :
+        Timer{ &post, this },
+        m_target{ &target },
+        m_event{ std::move( event ) }
+    {
+    }
+
+    Event_Timer( Event_Timer && ) = delete;
+
+    Event_Timer( Event_Timer const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Event_Timer() noexcept = default;
+
+    auto operator=( Event_Timer && ) = delete;
+
+    auto operator=( Event_Timer const & ) = delete;
+
+  private:
+    /**
+     * \brief The object to post the timeout event to.
+     */
+    Target * m_target;
+
+    /**
+     * \brief The timeout event to post.
+     */
+    Event m_event;
+
+    /**
+     * \brief Post the timeout event.
+     *
+     * \param[in] context The timer.
+     */
+    static void post( void * context ) noexcept
+    {
+        auto const timer = static_cast<Event_Timer *>( context );
+
+        timer->m_target->post( timer->m_event );
+    }
+};
+
+/**
+ * \brief Hierarchical timing wheel timer service.
+ *
+ * Starting a timer, stopping a timer, and advancing the service by a single tick are
+ * constant time operations (advancing by a single tick may cascade the timers in a single
+ * slot of each level to lower levels). Timer callbacks are called from
+ * picolibrary::Timer_Service::tick().
+ *
+ * The service can be ticked by a periodic tick, or can be run tickless by asking the
+ * service for the next deadline (see picolibrary::Timer_Service::next_deadline() and
+ * picolibrary::Timer_Service::sleep()).
+ *
+ * \attention The service and the timers started with it must only be used from a single
+ *            thread of execution (e.g. the main thread of execution).
+ *
+ * \tparam LEVELS The number of timing wheel levels.
+ * \tparam SLOT_BITS The number of bits of the tick count each level covers (each level has
+ *         2^SLOT_BITS slots). The longest timeout the service supports is
+ *         2^(LEVELS * SLOT_BITS) - 1 ticks.
+ */
+template<std::uint_fast8_t LEVELS, std::uint_fast8_t SLOT_BITS>
+class Timer_Service {
+  public:
+    static_assert( LEVELS > 0 );
+    static_assert( SLOT_BITS > 0 and SLOT_BITS < std::numeric_limits<Timer::Tick>::digits );
+    static_assert( LEVELS * SLOT_BITS <= std::numeric_limits<Timer::Tick>::digits );
+
+    /**
+     * \brief Tick count.
+     */
+    using Tick = Timer::Tick;
+
+    /**
+     * \brief The value returned by picolibrary::Timer_Service::next_deadline() when no
+     *        timers are running.
+     */
+    static constexpr auto NO_DEADLINE = std::numeric_limits<Tick>::max();
+
+    /**
+     * \brief Constructor.
+     */
+    constexpr Timer_Service() noexcept = default;
+
+    Timer_Service( Timer_Service && ) = delete;
+
+    Timer_Service( Timer_Service const & ) = delete;
+
+    /**
+     * \brief Destructor.
+     */
+    ~Timer_Service() noexcept
+    {
+        for ( auto & level : m_wheel ) {
+            for ( auto & slot : level ) {
+                while ( slot ) { slot->unlink(); } // while
+            }     // for
+        }         // for
+    }
+
+    auto operator=( Timer_Service && ) = delete;
+
+    auto operator=( Timer_Service const & ) = delete;
+
+    /**
+     * \brief Get the longest timeout the service supports.
+     *
+     * \return The longest timeout the service supports.
+     */
+    static constexpr auto max_timeout() noexcept -> Tick
+    {
+        return static_cast<Tick>( std::numeric_limits<Tick>::max()
+                                  >> ( std::numeric_limits<Tick>::digits - LEVELS * SLOT_BITS ) );
+    }
+
+    /**
+     * \brief Get the service's tick count.
+     *
+     * \return The service's tick count.
+     */
+    auto now() const noexcept -> Tick
+    {
+        return m_now;
+    }
+
+    /**
+     * \brief Start (or restart) a timer.
+     *
+     * \pre timeout > 0
+     * \pre timeout <= picolibrary::Timer_Service::max_timeout()
+     * \pre period <= picolibrary::Timer_Service::max_timeout()
+     *
+     * \param[in] timer The timer to start. If the timer is running, it is stopped before
+     *            being restarted.
+     * \param[in] timeout The number of ticks until the timer expires.
+     * \param[in] period The number of ticks between subsequent expirations (0 for a
+     *            one-shot timer).
+     */
+    void start( Timer & timer, Tick timeout, Tick period = 0 ) noexcept
+    {
+        PICOLIBRARY_EXPECT( timeout > 0 and timeout <= max_timeout(), Generic_Error::INVALID_ARGUMENT );
+        PICOLIBRARY_EXPECT( period <= max_timeout(), Generic_Error::INVALID_ARGUMENT );
+
+        timer.unlink();
+
+        timer.m_expiration = static_cast<Tick>( m_now + timeout );
+        timer.m_period     = period;
+
+        insert( timer );
+    }
+
+    /**
+     * \brief Stop a timer.
+     *
+     * \param[in] timer The timer to stop. Stopping a timer that is not running has no
+     *            effect.
+     */
+    void stop( Timer & timer ) noexcept
+    {
+        timer.unlink();
+    }
+
+    /**
+     * \brief Advance the service by a single tick, calling the callbacks of any timers
+     *        that expire.
+     */
+    void tick() noexcept
+    {
+        m_now = static_cast<Tick>( m_now + 1 );
+
+        for ( auto level = static_cast<std::uint_fast8_t>( LEVELS - 1 ); level > 0; --level ) {
+            if ( static_cast<Tick>( m_now & mask( level ) ) == 0 ) {
+                auto & slot = m_wheel[ level ][ slot_index( level, m_now ) ];
+
+                while ( slot ) {
+                    auto & timer = *slot;
+
+                    timer.unlink();
+
+                    insert( timer );
+                } // while
+            }     // if
+        }         // for
+
+        auto & slot = m_wheel[ 0 ][ slot_index( 0, m_now ) ];
+
+        while ( slot ) {
+            auto & timer = *slot;
+
+            timer.unlink();
+
+            if ( timer.m_period ) {
+                timer.m_expiration = static_cast<Tick>( timer.m_expiration + timer.m_period );
+
+                insert( timer );
+            } // if
+
+            timer.expire();
+        } // while
+    }
+
+    /**
+     * \brief Advance the service by multiple ticks, calling the callbacks of any timers
+     *        that expire.
+     *
+     * \param[in] ticks The number of ticks to advance the service by.
+     */
+    void advance( Tick ticks ) noexcept
+    {
+        for ( ; ticks; --ticks ) { tick(); } // for
+    }
+
+    /**
+     * \brief Get the number of ticks until the service next needs to be ticked.
+     *
+     * The next deadline is either the expiration of the next timer to expire, or the
+     * cascade of a higher level timing wheel slot (which occurs no later than the
+     * expiration of the timers in the slot).
+     *
+     * \return The number of ticks until the service next needs to be ticked.
+     * \return picolibrary::Timer_Service::NO_DEADLINE if no timers are running.
+     */
+    auto next_deadline() const noexcept -> Tick
+    {
+        auto deadline = NO_DEADLINE;
+
+        for ( auto level = std::uint_fast8_t{ 0 }; level < LEVELS; ++level ) {
+            auto const shift = static_cast<std::uint_fast8_t>( level * SLOT_BITS );
+            auto const base  = static_cast<Tick>( m_now >> shift );
+
+            for ( auto i = Tick{ 1 }; i <= SLOTS; ++i ) {
+                if ( m_wheel[ level ][ slot_index( level, static_cast<Tick>( ( base + i ) << shift ) ) ] ) {
+                    auto const ticks = static_cast<Tick>( ( ( base + i ) << shift ) - m_now );
+
+                    if ( ticks < deadline ) {
+                        deadline = ticks;
+                    } // if
+
+                    break;
+                } // if
+            }     // for
+        }         // for
+
+        return deadline;
+    }
+
+    /**
+     * \brief Sleep until the next deadline (tickless operation).
+     *
+     * \tparam Sleep_Hook The type of sleep hook to call.
+     *
+     * \param[in] sleep_hook The sleep hook (typically a HIL function that programs a
+     *            wakeup timer and enters a low power mode). The sleep hook is passed the
+     *            number of ticks until the next deadline
+     *            (picolibrary::Timer_Service::NO_DEADLINE if no timers are running), and
+     *            must return the number of ticks that elapsed while sleeping (which may
+     *            be less than the requested number of ticks if the sleep was interrupted
+     *            by another wakeup source).
+     */
+    template<typename Sleep_Hook>
+    void sleep( Sleep_Hook sleep_hook ) noexcept
+    {
+        advance( sleep_hook( next_deadline() ) );
+    }
+
+  private:
+    /**
+     * \brief The number of slots in each timing wheel level.
+     */
+    static constexpr auto SLOTS = Tick{ 1 } << SLOT_BITS;
+
+    /**
+     * \brief The timing wheel (indexed by level, then slot).
+     */
+    Array<Array<Timer *, SLOTS>, LEVELS> m_wheel{};
+
+    /**
+     * \brief The service's tick count.
+     */
+    Tick m_now{ 0 };
+
+    /**
+     * \brief Get the mask for the tick count bits below a level.
+     *
+     * \param[in] level The level.
+     *
+     * \return The mask for the tick count bits below the level.
+     */
+    static constexpr auto mask( std::uint_fast8_t level ) noexcept -> Tick
+    {
+        return static_cast<Tick>( ( Tick{ 1 } << ( level * SLOT_BITS ) ) - 1 );
+    }
+
+    /**
+     * \brief Get a tick count's slot index in a level.
+     *
+     * \param[in] level The level.
+     * \param[in] tick The tick count.
+     *
+     * \return The tick count's slot index in the level.
+     */
+    static constexpr auto slot_index( std::uint_fast8_t level, Tick tick ) noexcept -> Tick
+    {
+        return static_cast<Tick>( ( tick >> ( level * SLOT_BITS ) ) & ( SLOTS - 1 ) );
+    }
+
+    /**
+     * \brief Link a timer into the timing wheel slot for its expiration.
+     *
+     * \param[in] timer The timer.
+     */
+    void insert( Timer & timer ) noexcept
+    {
+        auto const delta = static_cast<Tick>( timer.m_expiration - m_now );
+
+        auto level = std::uint_fast8_t{ 0 };
+
+        while ( level + 1 < LEVELS and ( delta >> ( ( level + 1 ) * SLOT_BITS ) ) ) { ++level; } // while
+
+        timer.link( m_wheel[ level ][ slot_index( level, timer.m_expiration ) ] );
+    }
+};
+
+} // namespace picolibrary
+
+#endif // PICOLIBRARY_TIMER_H
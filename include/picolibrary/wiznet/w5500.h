@@ -29,6 +29,7 @@
 
 #include "picolibrary/array.h"
 #include "picolibrary/bit_manipulation.h"
+#include "picolibrary/serialization.h"
 #include "picolibrary/spi.h"
 #include "picolibrary/utility.h"
 
@@ -2671,12 +2672,12 @@ class Driver : public Communication_Controller {
      */
     auto read( Memory_Offset memory_offset, std::uint16_t ) const noexcept -> std::uint16_t
     {
-        Array<std::uint8_t, 2> buffer;
+        auto buffer = Array<std::uint8_t, 2>{};
 
         Communication_Controller::read( memory_offset, buffer.begin(), buffer.end() );
 
-        return static_cast<std::uint16_t>(
-            ( buffer[ 0 ] << std::numeric_limits<std::uint8_t>::digits ) | buffer[ 1 ] );
+        return Serialization::deserialize<Serialization::Byte_Order::BIG, std::uint16_t>(
+            buffer.data() );
     }
 
     /**
@@ -2732,10 +2733,7 @@ class Driver : public Communication_Controller {
      */
     void write( Memory_Offset memory_offset, std::uint16_t data ) noexcept
     {
-        auto const buffer = Array<std::uint8_t, 2>{
-            static_cast<std::uint8_t>( data >> std::numeric_limits<std::uint8_t>::digits ),
-            static_cast<std::uint8_t>( data ),
-        };
+        auto const buffer = Serialization::serialize<Serialization::Byte_Order::BIG>( data );
 
         Communication_Controller::write( memory_offset, buffer.begin(), buffer.end() );
     }
@@ -2803,7 +2801,7 @@ class Driver : public Communication_Controller {
     auto read( Socket_ID socket_id, Memory_Offset memory_offset, std::uint16_t ) const noexcept
         -> std::uint16_t
     {
-        Array<std::uint8_t, 2> buffer;
+        auto buffer = Array<std::uint8_t, 2>{};
 
         Communication_Controller::read(
             socket_id,
@@ -2812,8 +2810,8 @@ class Driver : public Communication_Controller {
             buffer.begin(),
             buffer.end() );
 
-        return static_cast<std::uint16_t>(
-            ( buffer[ 0 ] << std::numeric_limits<std::uint8_t>::digits ) | buffer[ 1 ] );
+        return Serialization::deserialize<Serialization::Byte_Order::BIG, std::uint16_t>(
+            buffer.data() );
     }
 
     /**
@@ -2908,10 +2906,7 @@ class Driver : public Communication_Controller {
      */
     void write( Socket_ID socket_id, Memory_Offset memory_offset, std::uint16_t data ) noexcept
     {
-        auto const buffer = Array<std::uint8_t, 2>{
-            static_cast<std::uint8_t>( data >> std::numeric_limits<std::uint8_t>::digits ),
-            static_cast<std::uint8_t>( data ),
-        };
+        auto const buffer = Serialization::serialize<Serialization::Byte_Order::BIG>( data );
 
         Communication_Controller::write(
             socket_id,
@@ -24,7 +24,6 @@
 #define PICOLIBRARY_WIZNET_W5500_IP_UDP_H
 
 #include <cstdint>
-#include <limits>
 
 #include "picolibrary/array.h"
 #include "picolibrary/error.h"
@@ -33,6 +32,7 @@
 #include "picolibrary/ipv4.h"
 #include "picolibrary/precondition.h"
 #include "picolibrary/result.h"
+#include "picolibrary/serialization.h"
 #include "picolibrary/utility.h"
 #include "picolibrary/wiznet/w5500.h"
 #include "picolibrary/wiznet/w5500/keys.h"
@@ -615,8 +615,8 @@ class Socket {
     static auto get_datagram_source_port( Datagram_Info const & datagram_info ) noexcept
         -> ::picolibrary::IP::UDP::Port
     {
-        return static_cast<std::uint16_t>(
-            ( datagram_info[ 4 ] << std::numeric_limits<std::uint8_t>::digits ) | datagram_info[ 5 ] );
+        return Serialization::deserialize<Serialization::Byte_Order::BIG, std::uint16_t>(
+            &datagram_info[ 4 ] );
     }
 
     /**
@@ -629,8 +629,8 @@ class Socket {
      */
     static auto get_datagram_data_size( Datagram_Info const & datagram_info ) noexcept -> std::uint16_t
     {
-        return static_cast<std::uint16_t>(
-            ( datagram_info[ 6 ] << std::numeric_limits<std::uint8_t>::digits ) | datagram_info[ 7 ] );
+        return Serialization::deserialize<Serialization::Byte_Order::BIG, std::uint16_t>(
+            &datagram_info[ 6 ] );
     }
 };
 
@@ -0,0 +1,246 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary active object automated test program.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/active_object.h"
+#include "picolibrary/event.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/testing/automated/event.h"
+#include "picolibrary/testing/automated/interrupt.h"
+
+namespace {
+
+using ::picolibrary::Active_Object;
+using ::picolibrary::Event;
+using ::picolibrary::Event_ID;
+using ::picolibrary::Event_Queue;
+using ::picolibrary::Result;
+using ::picolibrary::Simple_Event;
+using ::picolibrary::Testing::Automated::Mock_Event_Category;
+using ::picolibrary::Testing::Automated::Interrupt::Mock_Controller;
+using ::testing::InSequence;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class Counted_Event final : public Event {
+  public:
+    Counted_Event( Event_ID id, std::uint32_t payload, std::size_t & destructions ) noexcept :
+        Event{ Mock_Event_Category::instance(), id },
+        m_payload{ payload },
+        m_destructions{ &destructions }
+    {
+    }
+
+    Counted_Event( Counted_Event && source ) noexcept = default;
+
+    Counted_Event( Counted_Event const & original ) noexcept = default;
+
+    ~Counted_Event() noexcept override final
+    {
+        ++*m_destructions;
+    }
+
+    auto operator=( Counted_Event && ) = delete;
+
+    auto operator=( Counted_Event const & ) = delete;
+
+    auto payload() const noexcept -> std::uint32_t
+    {
+        return m_payload;
+    }
+
+#ifndef PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+    auto print_details( ::picolibrary::Output_Stream & ) const noexcept
+        -> Result<std::size_t> override final
+    {
+        return std::size_t{ 0 };
+    }
+
+    auto print_details( ::picolibrary::Reliable_Output_Stream & ) const noexcept
+        -> std::size_t override final
+    {
+        return 0;
+    }
+#endif // PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+
+    void print_details( std::ostream & ) const override final
+    {
+    }
+
+  private:
+    std::uint32_t m_payload;
+
+    std::size_t * m_destructions;
+};
+
+using Test_Event_Queue = Event_Queue<sizeof( Counted_Event ), std::uint_fast8_t, 4, Mock_Controller::Handle>;
+
+class Test_Active_Object :
+    public Active_Object<Test_Active_Object, sizeof( Counted_Event ), std::uint_fast8_t, 4, Mock_Controller::Handle> {
+  public:
+    Test_Active_Object( Mock_Controller & controller, std::ostream & stream ) noexcept :
+        Active_Object{ controller.handle() },
+        m_stream{ stream }
+    {
+    }
+
+  private:
+    friend Active_Object;
+
+    std::ostream & m_stream;
+
+    void dispatch( Event const & event ) noexcept
+    {
+        m_stream << static_cast<unsigned int>( event.id() ) << "-BEGIN;";
+
+        if ( event.id() == 1 ) {
+            post( Simple_Event{ Mock_Event_Category::instance(), 3 } );
+        } // if
+
+        m_stream << static_cast<unsigned int>( event.id() ) << "-END;";
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Event_Queue works properly.
+ */
+TEST( eventQueue, worksProperly )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto destructions = std::size_t{ 0 };
+
+    {
+        auto queue = Test_Event_Queue{ controller.handle() };
+
+        EXPECT_TRUE( queue.empty() );
+        EXPECT_EQ( queue.max_size(), 4 );
+
+        queue.post( Counted_Event{ 1, 0x1A2B3C4D, destructions } );
+        queue.post_from_interrupt( Simple_Event{ Mock_Event_Category::instance(), 2 } );
+        queue.post( Counted_Event{ 3, 0x5E6F7081, destructions } );
+
+        EXPECT_EQ( queue.size(), 3 );
+        EXPECT_FALSE( queue.full() );
+
+        queue.post_from_interrupt( Counted_Event{ 4, 0x92A3B4C5, destructions } );
+
+        EXPECT_TRUE( queue.full() );
+        EXPECT_TRUE( queue.full_from_interrupt() );
+
+        destructions = 0;
+
+        EXPECT_EQ( queue.front().id(), 1 );
+        EXPECT_EQ( static_cast<Counted_Event const &>( queue.front() ).payload(), 0x1A2B3C4D );
+
+        queue.pop();
+
+        EXPECT_EQ( destructions, 1 );
+        EXPECT_EQ( queue.front().id(), 2 );
+
+        queue.pop();
+
+        EXPECT_EQ( destructions, 1 );
+        EXPECT_EQ( queue.front().id(), 3 );
+
+        queue.post( Simple_Event{ Mock_Event_Category::instance(), 5 } );
+
+        EXPECT_EQ( queue.size_from_interrupt(), 3 );
+    }
+
+    EXPECT_EQ( destructions, 3 );
+}
+
+/**
+ * \brief Verify picolibrary::Event_Queue::post() executes in a critical section.
+ */
+TEST( eventQueue, postCriticalSection )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto queue = Test_Event_Queue{ controller.handle() };
+
+    {
+        auto const in_sequence = InSequence{};
+
+        EXPECT_CALL( controller, save_interrupt_enable_state() ).WillOnce( Return( 0x5C ) );
+        EXPECT_CALL( controller, disable_interrupt() );
+        EXPECT_CALL( controller, restore_interrupt_enable_state( 0x5C ) );
+
+        queue.post( Simple_Event{ Mock_Event_Category::instance(), 7 } );
+    }
+
+    ::testing::Mock::VerifyAndClearExpectations( &controller );
+}
+
+/**
+ * \brief Verify picolibrary::Active_Object processes events in order, with each event's
+ *        processing running to completion.
+ */
+TEST( activeObject, worksProperly )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto stream = std::ostringstream{};
+
+    auto active_object = Test_Active_Object{ controller, stream };
+
+    EXPECT_FALSE( active_object.has_pending_events() );
+    EXPECT_FALSE( active_object.process_event() );
+
+    active_object.post( Simple_Event{ Mock_Event_Category::instance(), 1 } );
+    active_object.post_from_interrupt( Simple_Event{ Mock_Event_Category::instance(), 2 } );
+
+    EXPECT_TRUE( active_object.has_pending_events() );
+    EXPECT_TRUE( active_object.process_event() );
+
+    EXPECT_EQ( stream.str(), "1-BEGIN;1-END;" );
+
+    active_object.process_events();
+
+    EXPECT_FALSE( active_object.has_pending_events() );
+    EXPECT_EQ( stream.str(), "1-BEGIN;1-END;2-BEGIN;2-END;3-BEGIN;3-END;" );
+}
+
+/**
+ * \brief Execute the picolibrary active object automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -22,6 +22,8 @@
  */
 
 #include <cstdint>
+#include <string_view>
+#include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -32,6 +34,7 @@ namespace {
 
 using ::picolibrary::Asynchronous_Serial::Reliable_Unbuffered_Output_Stream;
 using ::picolibrary::Testing::Automated::Asynchronous_Serial::Mock_Transmitter;
+using ::testing::InSequence;
 
 } // namespace
 
@@ -211,6 +214,29 @@ TEST( assignmentOperatorMove, worksProperlySelfAssignmentBufferSet )
     EXPECT_TRUE( stream.buffer_is_set() );
 }
 
+/**
+ * \brief Verify picolibrary::Asynchronous_Serial::Reliable_Unbuffered_Output_Stream
+ *        unformatted and formatted output works properly.
+ */
+TEST( output, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto transmitter = Mock_Transmitter<std::uint8_t>{};
+
+    auto stream = Reliable_Unbuffered_Output_Stream{ transmitter.handle() };
+
+    auto const string = std::string_view{ "tE6" };
+
+    EXPECT_CALL( transmitter, transmit( std::vector<std::uint8_t>{ string.begin(), string.end() } ) );
+    EXPECT_CALL( transmitter, transmit( 'K' ) );
+
+    stream.put( string.begin(), string.end() );
+    EXPECT_EQ( stream.print( 'K' ), 1 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
 /**
  * \brief Execute the picolibrary::Asynchronous_Serial::Reliable_Unbuffered_Output_Stream
  *        automated tests.
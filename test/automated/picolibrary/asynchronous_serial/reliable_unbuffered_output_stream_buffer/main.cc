@@ -22,16 +22,19 @@
  */
 
 #include <cstdint>
+#include <iterator>
 #include <string_view>
 #include <vector>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 #include "picolibrary/asynchronous_serial.h"
+#include "picolibrary/stream.h"
 #include "picolibrary/testing/automated/asynchronous_serial.h"
 
 namespace {
 
+using ::picolibrary::Stream_Segment;
 using ::picolibrary::Asynchronous_Serial::Reliable_Unbuffered_Output_Stream_Buffer;
 using ::picolibrary::Testing::Automated::Asynchronous_Serial::Mock_Transmitter;
 using ::testing::InSequence;
@@ -168,6 +171,37 @@ TEST( putSignedByteBlock, worksProperly )
     buffer.put( &*values.begin(), &*values.end() );
 }
 
+/**
+ * \brief Verify
+ *        picolibrary::Asynchronous_Serial::Reliable_Unbuffered_Output_Stream_Buffer::put(
+ *        picolibrary::Stream_Segment const *, picolibrary::Stream_Segment const * ) works
+ *        properly.
+ */
+TEST( putSegments, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto transmitter = Mock_Transmitter<std::uint8_t>{};
+
+    auto buffer = Reliable_Unbuffered_Output_Stream_Buffer{ transmitter.handle() };
+
+    auto const header  = std::vector<std::uint8_t>{ 0x7E, 0x04 };
+    auto const payload = std::vector<std::uint8_t>{ 0xB3, 0x1A, 0x62, 0xC8 };
+    auto const crc     = std::vector<std::uint8_t>{ 0x0F, 0xD5 };
+
+    EXPECT_CALL( transmitter, transmit( header ) );
+    EXPECT_CALL( transmitter, transmit( payload ) );
+    EXPECT_CALL( transmitter, transmit( crc ) );
+
+    Stream_Segment const segments[]{
+        { &*header.begin(), &*header.end() },
+        { &*payload.begin(), &*payload.end() },
+        { &*crc.begin(), &*crc.end() },
+    };
+
+    buffer.put( std::begin( segments ), std::end( segments ) );
+}
+
 /**
  * \brief Execute the
  *        picolibrary::Asynchronous_Serial::Reliable_Unbuffered_Output_Stream_Buffer
@@ -34,6 +34,7 @@ namespace {
 
 using ::picolibrary::highest_bit_set;
 using ::picolibrary::is_power_of_two;
+using ::picolibrary::lowest_bit_set;
 using ::picolibrary::mask;
 using ::picolibrary::reflect;
 using ::testing::TestWithParam;
@@ -326,6 +327,291 @@ highestBitSet_Test_Case<std::uint32_t> const highestBitSet32_TEST_CASES[]{
 
 INSTANTIATE_TEST_SUITE_P( testCases, highestBitSet32, ValuesIn( highestBitSet32_TEST_CASES ) );
 
+/**
+ * \brief picolibrary::lowest_bit_set() test case.
+ *
+ * \tparam T The type of unsigned integer the lookup will be performed on.
+ */
+template<typename T>
+struct lowestBitSet_Test_Case {
+    /**
+     * \brief The value whose lowest bit set is to be looked up (assumed to be non-zero).
+     */
+    T value;
+
+    /**
+     * \brief value's lowest bit set.
+     */
+    std::uint_fast8_t lowest_bit_set;
+};
+
+template<typename T>
+auto operator<<( std::ostream & stream, lowestBitSet_Test_Case<T> const & test_case )
+    -> std::ostream &
+{
+    // clang-format off
+
+    return stream << "{ "
+                  << ".value = 0b" << std::bitset<std::numeric_limits<T>::digits>{ test_case.value }
+                  << ", "
+                  << ".lowest_bit_set = " << std::dec << static_cast<std::uint_fast16_t>( test_case.lowest_bit_set )
+                  << " }";
+
+    // clang-format on
+}
+
+/**
+ * \brief picolibrary::lowest_bit_set() std::uint8_t test fixture.
+ */
+class lowestBitSet8 : public TestWithParam<lowestBitSet_Test_Case<std::uint8_t>> {
+};
+
+/**
+ * \brief Verify picolibrary::lowest_bit_set() works properly.
+ */
+TEST_P( lowestBitSet8, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( lowest_bit_set( test_case.value ), test_case.lowest_bit_set );
+}
+
+/**
+ * \brief picolibrary::lowest_bit_set() std::uint8_t test cases.
+ */
+lowestBitSet_Test_Case<std::uint8_t> const lowestBitSet8_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000001, 0 },
+    { 0b00000010, 1 },
+    { 0b00000100, 2 },
+    { 0b00001000, 3 },
+    { 0b00010000, 4 },
+    { 0b00100000, 5 },
+    { 0b01000000, 6 },
+    { 0b10000000, 7 },
+
+    { 0b00000001, 0 },
+    { 0b00000011, 0 },
+    { 0b00000111, 0 },
+    { 0b00001111, 0 },
+    { 0b00011111, 0 },
+    { 0b00111111, 0 },
+    { 0b01111111, 0 },
+    { 0b11111111, 0 },
+
+    { 0b00000110, 1 },
+    { 0b00001100, 2 },
+    { 0b00011101, 0 },
+    { 0b00111010, 1 },
+    { 0b01010110, 1 },
+    { 0b10111000, 3 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P( testCases, lowestBitSet8, ValuesIn( lowestBitSet8_TEST_CASES ) );
+
+/**
+ * \brief picolibrary::lowest_bit_set() std::uint16_t test fixture.
+ */
+class lowestBitSet16 : public TestWithParam<lowestBitSet_Test_Case<std::uint16_t>> {
+};
+
+/**
+ * \brief Verify picolibrary::lowest_bit_set() works properly.
+ */
+TEST_P( lowestBitSet16, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( lowest_bit_set( test_case.value ), test_case.lowest_bit_set );
+}
+
+/**
+ * \brief picolibrary::lowest_bit_set() std::uint16_t test cases.
+ */
+lowestBitSet_Test_Case<std::uint16_t> const lowestBitSet16_TEST_CASES[]{
+    // clang-format off
+
+    { 0b0000000000000001,  0 },
+    { 0b0000000000000010,  1 },
+    { 0b0000000000000100,  2 },
+    { 0b0000000000001000,  3 },
+    { 0b0000000000010000,  4 },
+    { 0b0000000000100000,  5 },
+    { 0b0000000001000000,  6 },
+    { 0b0000000010000000,  7 },
+    { 0b0000000100000000,  8 },
+    { 0b0000001000000000,  9 },
+    { 0b0000010000000000, 10 },
+    { 0b0000100000000000, 11 },
+    { 0b0001000000000000, 12 },
+    { 0b0010000000000000, 13 },
+    { 0b0100000000000000, 14 },
+    { 0b1000000000000000, 15 },
+
+    { 0b0000000000000001,  0 },
+    { 0b0000000000000011,  0 },
+    { 0b0000000000000111,  0 },
+    { 0b0000000000001111,  0 },
+    { 0b0000000000011111,  0 },
+    { 0b0000000000111111,  0 },
+    { 0b0000000001111111,  0 },
+    { 0b0000000011111111,  0 },
+    { 0b0000000111111111,  0 },
+    { 0b0000001111111111,  0 },
+    { 0b0000011111111111,  0 },
+    { 0b0000111111111111,  0 },
+    { 0b0001111111111111,  0 },
+    { 0b0011111111111111,  0 },
+    { 0b0111111111111111,  0 },
+    { 0b1111111111111111,  0 },
+
+    { 0b0000000000000110,  1 },
+    { 0b0000000000001100,  2 },
+    { 0b0000000000011101,  0 },
+    { 0b0000000000111010,  1 },
+    { 0b0000000001010110,  1 },
+    { 0b0000000010111000,  3 },
+    { 0b0000000111001111,  0 },
+    { 0b0000001100001010,  1 },
+    { 0b0000011000100010,  1 },
+    { 0b0000110000101101,  0 },
+    { 0b0001101010101011,  0 },
+    { 0b0010000000100010,  1 },
+    { 0b0110100010001110,  1 },
+    { 0b1010010001100100,  2 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P( testCases, lowestBitSet16, ValuesIn( lowestBitSet16_TEST_CASES ) );
+
+/**
+ * \brief picolibrary::lowest_bit_set() std::uint32_t test fixture.
+ */
+class lowestBitSet32 : public TestWithParam<lowestBitSet_Test_Case<std::uint32_t>> {
+};
+
+/**
+ * \brief Verify picolibrary::lowest_bit_set() works properly.
+ */
+TEST_P( lowestBitSet32, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    EXPECT_EQ( lowest_bit_set( test_case.value ), test_case.lowest_bit_set );
+}
+
+/**
+ * \brief picolibrary::lowest_bit_set() std::uint32_t test cases.
+ */
+lowestBitSet_Test_Case<std::uint32_t> const lowestBitSet32_TEST_CASES[]{
+    // clang-format off
+
+    { 0b00000000000000000000000000000001,  0 },
+    { 0b00000000000000000000000000000010,  1 },
+    { 0b00000000000000000000000000000100,  2 },
+    { 0b00000000000000000000000000001000,  3 },
+    { 0b00000000000000000000000000010000,  4 },
+    { 0b00000000000000000000000000100000,  5 },
+    { 0b00000000000000000000000001000000,  6 },
+    { 0b00000000000000000000000010000000,  7 },
+    { 0b00000000000000000000000100000000,  8 },
+    { 0b00000000000000000000001000000000,  9 },
+    { 0b00000000000000000000010000000000, 10 },
+    { 0b00000000000000000000100000000000, 11 },
+    { 0b00000000000000000001000000000000, 12 },
+    { 0b00000000000000000010000000000000, 13 },
+    { 0b00000000000000000100000000000000, 14 },
+    { 0b00000000000000001000000000000000, 15 },
+    { 0b00000000000000010000000000000000, 16 },
+    { 0b00000000000000100000000000000000, 17 },
+    { 0b00000000000001000000000000000000, 18 },
+    { 0b00000000000010000000000000000000, 19 },
+    { 0b00000000000100000000000000000000, 20 },
+    { 0b00000000001000000000000000000000, 21 },
+    { 0b00000000010000000000000000000000, 22 },
+    { 0b00000000100000000000000000000000, 23 },
+    { 0b00000001000000000000000000000000, 24 },
+    { 0b00000010000000000000000000000000, 25 },
+    { 0b00000100000000000000000000000000, 26 },
+    { 0b00001000000000000000000000000000, 27 },
+    { 0b00010000000000000000000000000000, 28 },
+    { 0b00100000000000000000000000000000, 29 },
+    { 0b01000000000000000000000000000000, 30 },
+    { 0b10000000000000000000000000000000, 31 },
+
+    { 0b00000000000000000000000000000001,  0 },
+    { 0b00000000000000000000000000000011,  0 },
+    { 0b00000000000000000000000000000111,  0 },
+    { 0b00000000000000000000000000001111,  0 },
+    { 0b00000000000000000000000000011111,  0 },
+    { 0b00000000000000000000000000111111,  0 },
+    { 0b00000000000000000000000001111111,  0 },
+    { 0b00000000000000000000000011111111,  0 },
+    { 0b00000000000000000000000111111111,  0 },
+    { 0b00000000000000000000001111111111,  0 },
+    { 0b00000000000000000000011111111111,  0 },
+    { 0b00000000000000000000111111111111,  0 },
+    { 0b00000000000000000001111111111111,  0 },
+    { 0b00000000000000000011111111111111,  0 },
+    { 0b00000000000000000111111111111111,  0 },
+    { 0b00000000000000001111111111111111,  0 },
+    { 0b00000000000000011111111111111111,  0 },
+    { 0b00000000000000111111111111111111,  0 },
+    { 0b00000000000001111111111111111111,  0 },
+    { 0b00000000000011111111111111111111,  0 },
+    { 0b00000000000111111111111111111111,  0 },
+    { 0b00000000001111111111111111111111,  0 },
+    { 0b00000000011111111111111111111111,  0 },
+    { 0b00000000111111111111111111111111,  0 },
+    { 0b00000001111111111111111111111111,  0 },
+    { 0b00000011111111111111111111111111,  0 },
+    { 0b00000111111111111111111111111111,  0 },
+    { 0b00001111111111111111111111111111,  0 },
+    { 0b00011111111111111111111111111111,  0 },
+    { 0b00111111111111111111111111111111,  0 },
+    { 0b01111111111111111111111111111111,  0 },
+    { 0b11111111111111111111111111111111,  0 },
+
+    { 0b00000000000000000000000000000110,  1 },
+    { 0b00000000000000000000000000001100,  2 },
+    { 0b00000000000000000000000000011101,  0 },
+    { 0b00000000000000000000000000111010,  1 },
+    { 0b00000000000000000000000001010110,  1 },
+    { 0b00000000000000000000000010111000,  3 },
+    { 0b00000000000000000000000111001111,  0 },
+    { 0b00000000000000000000001100001010,  1 },
+    { 0b00000000000000000000011000100010,  1 },
+    { 0b00000000000000000000110000101101,  0 },
+    { 0b00000000000000000001101010101011,  0 },
+    { 0b00000000000000000010000000100010,  1 },
+    { 0b00000000000000000110100010001110,  1 },
+    { 0b00000000000000001010010001100100,  2 },
+    { 0b00000000000000010111000001011110,  1 },
+    { 0b00000000000000111101111011010000,  4 },
+    { 0b00000000000001011000100010010011,  0 },
+    { 0b00000000000011110011110000011110,  1 },
+    { 0b00000000000100111100110101011111,  0 },
+    { 0b00000000001110011010101100101011,  0 },
+    { 0b00000000010011100011000000010111,  0 },
+    { 0b00000000100001101000111111111000,  3 },
+    { 0b00000001110111000101110101110110,  1 },
+    { 0b00000011010101101001010010100011,  0 },
+    { 0b00000101100110001011010011001001,  0 },
+    { 0b00001111111011011011010111010101,  0 },
+    { 0b00011000000110101110000101010101,  0 },
+    { 0b00111100111100011110010111001110,  1 },
+    { 0b01101110010000101011010001110110,  1 },
+    { 0b10010010100100101000001000111010,  1 },
+
+    // clang-format on
+};
+
+INSTANTIATE_TEST_SUITE_P( testCases, lowestBitSet32, ValuesIn( lowestBitSet32_TEST_CASES ) );
+
 /**
  * \brief picolibrary::mask() test case.
  *
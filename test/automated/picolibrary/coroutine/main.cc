@@ -0,0 +1,475 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Coroutine automated test program.
+ */
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/coroutine.h"
+#include "picolibrary/error.h"
+#include "picolibrary/ip.h"
+#include "picolibrary/ip/udp.h"
+#include "picolibrary/result.h"
+#include "picolibrary/timer.h"
+
+namespace {
+
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Result;
+using ::picolibrary::Timer_Service;
+using ::picolibrary::Coroutine::Executor;
+using ::picolibrary::Coroutine::Task;
+using ::picolibrary::Coroutine::Wake_Signal;
+using ::picolibrary::IP::Port;
+using ::picolibrary::IP::UDP::Endpoint;
+using ::picolibrary::IP::UDP::Reception_Result;
+
+class Fake_Socket {
+  public:
+    using Endpoint = std::uint16_t;
+
+    auto attempts() const noexcept -> std::uint_fast16_t
+    {
+        return m_attempts;
+    }
+
+    void set_connect_error( Generic_Error error ) noexcept
+    {
+        m_connect_error = error;
+    }
+
+    void set_connectable() noexcept
+    {
+        m_is_connectable = true;
+    }
+
+    void make_available( std::vector<std::uint8_t> data ) noexcept
+    {
+        m_available = std::move( data );
+    }
+
+    auto transmitted() const noexcept -> std::vector<std::uint8_t> const &
+    {
+        return m_transmitted;
+    }
+
+    void set_transmit_capacity( std::size_t capacity ) noexcept
+    {
+        m_transmit_capacity = capacity;
+    }
+
+    auto connect( Endpoint endpoint ) noexcept -> Result<void>
+    {
+        ++m_attempts;
+
+        if ( not m_is_connectable ) {
+            return std::exchange( m_connect_error, Generic_Error::WOULD_BLOCK );
+        } // if
+
+        m_endpoint = endpoint;
+
+        return {};
+    }
+
+    auto endpoint() const noexcept -> Endpoint
+    {
+        return m_endpoint;
+    }
+
+    auto transmit( std::uint8_t const * begin, std::uint8_t const * end ) noexcept
+        -> Result<std::uint8_t const *>
+    {
+        ++m_attempts;
+
+        if ( not m_transmit_capacity ) {
+            return Generic_Error::WOULD_BLOCK;
+        } // if
+
+        while ( begin != end and m_transmit_capacity ) {
+            m_transmitted.push_back( *begin );
+            ++begin;
+            --m_transmit_capacity;
+        } // while
+
+        return begin;
+    }
+
+    auto receive( std::uint8_t * begin, std::uint8_t * end ) noexcept -> Result<std::uint8_t *>
+    {
+        ++m_attempts;
+
+        if ( m_available.empty() ) {
+            return Generic_Error::OPERATION_TIMEOUT;
+        } // if
+
+        auto data = m_available.begin();
+        for ( ; begin != end and data != m_available.end(); ++begin, ++data ) {
+            *begin = *data;
+        } // for
+
+        m_available.erase( m_available.begin(), data );
+
+        return begin;
+    }
+
+  private:
+    std::uint_fast16_t m_attempts{};
+
+    Generic_Error m_connect_error{ Generic_Error::WOULD_BLOCK };
+
+    bool m_is_connectable{};
+
+    Endpoint m_endpoint{};
+
+    std::vector<std::uint8_t> m_available{};
+
+    std::vector<std::uint8_t> m_transmitted{};
+
+    std::size_t m_transmit_capacity{};
+};
+
+class Fake_UDP_Socket {
+  public:
+    void make_available( Endpoint endpoint, std::vector<std::uint8_t> datagram ) noexcept
+    {
+        m_endpoint  = endpoint;
+        m_datagram  = std::move( datagram );
+        m_available = true;
+    }
+
+    auto receive( std::uint8_t * begin, std::uint8_t * end ) noexcept -> Result<Reception_Result>
+    {
+        if ( not m_available ) {
+            return Generic_Error::WOULD_BLOCK;
+        } // if
+
+        m_available = false;
+
+        for ( auto data = m_datagram.begin(); begin != end and data != m_datagram.end(); ++begin, ++data ) {
+            *begin = *data;
+        } // for
+
+        return Reception_Result{ m_endpoint, begin };
+    }
+
+  private:
+    bool m_available{};
+
+    Endpoint m_endpoint{};
+
+    std::vector<std::uint8_t> m_datagram{};
+};
+
+auto echo( Wake_Signal & signal, Fake_Socket & socket, std::vector<std::string> & log ) -> Task
+{
+    std::uint8_t buffer[ 8 ];
+
+    auto const received = co_await ::picolibrary::Coroutine::receive(
+        signal, socket, buffer, buffer + sizeof( buffer ) );
+    if ( received.is_error() ) {
+        log.push_back( "receive error" );
+        co_return;
+    } // if
+
+    log.push_back( "received" );
+
+    for ( std::uint8_t const * begin = buffer; begin != received.value(); ) {
+        auto const transmitted = co_await ::picolibrary::Coroutine::transmit(
+            signal, socket, begin, received.value() );
+        if ( transmitted.is_error() ) {
+            log.push_back( "transmit error" );
+            co_return;
+        } // if
+
+        begin = transmitted.value();
+
+        log.push_back( "transmitted" );
+    } // for
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Coroutine::Executor parks coroutines until their wake signal
+ *        is notified, and does not retry parked operations until then.
+ */
+TEST( executor, parksUntilNotified )
+{
+    auto signal = Wake_Signal{};
+    auto socket = Fake_Socket{};
+    auto log    = std::vector<std::string>{};
+
+    auto executor = Executor<2>{};
+
+    executor.spawn( echo( signal, socket, log ) );
+
+    EXPECT_EQ( executor.tasks(), 1 );
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( socket.attempts(), 1 );
+
+    EXPECT_FALSE( executor.run_once() );
+    EXPECT_FALSE( executor.run_once() );
+    EXPECT_EQ( socket.attempts(), 1 );
+    EXPECT_TRUE( log.empty() );
+
+    signal.notify();
+
+    EXPECT_FALSE( executor.run_once() );
+    EXPECT_EQ( socket.attempts(), 2 );
+
+    EXPECT_FALSE( executor.run_once() );
+    EXPECT_EQ( socket.attempts(), 2 );
+
+    socket.make_available( { 0x4E, 0xA7, 0x19 } );
+    socket.set_transmit_capacity( 2 );
+    signal.notify();
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( log, ( std::vector<std::string>{ "received", "transmitted" } ) );
+    EXPECT_EQ( executor.tasks(), 1 );
+
+    signal.notify();
+
+    EXPECT_FALSE( executor.run_once() );
+
+    socket.set_transmit_capacity( 4 );
+    signal.notify();
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( log, ( std::vector<std::string>{ "received", "transmitted", "transmitted" } ) );
+    EXPECT_EQ( socket.transmitted(), ( std::vector<std::uint8_t>{ 0x4E, 0xA7, 0x19 } ) );
+    EXPECT_EQ( executor.tasks(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Coroutine::connect() only treats
+ *        picolibrary::Generic_Error::WOULD_BLOCK as would block, and reports other errors
+ *        to the awaiting coroutine.
+ */
+TEST( connect, worksProperly )
+{
+    auto signal = Wake_Signal{};
+    auto socket = Fake_Socket{};
+
+    auto results = std::vector<Result<void>>{};
+
+    auto executor = Executor<1>{};
+
+    auto const task = []( Wake_Signal & s, Fake_Socket & client, std::vector<Result<void>> & r ) -> Task {
+        r.push_back( co_await ::picolibrary::Coroutine::connect( s, client, 0x5D2C ) );
+        r.push_back( co_await ::picolibrary::Coroutine::connect( s, client, 0x91B3 ) );
+    };
+
+    executor.spawn( task( signal, socket, results ) );
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_TRUE( results.empty() );
+
+    socket.set_connect_error( Generic_Error::OPERATION_TIMEOUT );
+    signal.notify();
+
+    EXPECT_TRUE( executor.run_once() );
+    ASSERT_EQ( results.size(), 1 );
+    ASSERT_TRUE( results[ 0 ].is_error() );
+    EXPECT_EQ( results[ 0 ].error(), Generic_Error::OPERATION_TIMEOUT );
+
+    socket.set_connectable();
+    signal.notify();
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( executor.tasks(), 0 );
+    ASSERT_EQ( results.size(), 2 );
+    EXPECT_FALSE( results[ 1 ].is_error() );
+    EXPECT_EQ( socket.endpoint(), 0x91B3 );
+}
+
+/**
+ * \brief Verify picolibrary::Coroutine::receive() works properly with a UDP socket.
+ */
+TEST( receive, udpSocket )
+{
+    auto signal = Wake_Signal{};
+    auto socket = Fake_UDP_Socket{};
+
+    std::uint8_t buffer[ 4 ]{};
+
+    auto results = std::vector<Result<Reception_Result>>{};
+
+    auto executor = Executor<1>{};
+
+    auto const task = []( Wake_Signal &                            s,
+                          Fake_UDP_Socket &                        udp,
+                          std::uint8_t *                           b,
+                          std::uint8_t *                           e,
+                          std::vector<Result<Reception_Result>> & r ) -> Task {
+        r.push_back( co_await ::picolibrary::Coroutine::receive( s, udp, b, e ) );
+    };
+
+    executor.spawn( task( signal, socket, buffer, buffer + sizeof( buffer ), results ) );
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_TRUE( results.empty() );
+
+    socket.make_available( Endpoint{ Port{ 0x2F41 } }, { 0xA3, 0x5C } );
+    signal.notify();
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( executor.tasks(), 0 );
+    ASSERT_EQ( results.size(), 1 );
+    ASSERT_FALSE( results[ 0 ].is_error() );
+    EXPECT_EQ( results[ 0 ].value().endpoint, Endpoint{ Port{ 0x2F41 } } );
+    EXPECT_EQ( results[ 0 ].value().end, buffer + 2 );
+    EXPECT_EQ( buffer[ 0 ], 0xA3 );
+    EXPECT_EQ( buffer[ 1 ], 0x5C );
+}
+
+/**
+ * \brief Verify picolibrary::Coroutine::Executor runs multiple concurrent tasks
+ *        independently.
+ */
+TEST( executor, concurrentTasks )
+{
+    Wake_Signal signal_a;
+    Wake_Signal signal_b;
+    auto        socket_a = Fake_Socket{};
+    auto        socket_b = Fake_Socket{};
+    auto        log_a    = std::vector<std::string>{};
+    auto        log_b    = std::vector<std::string>{};
+
+    auto executor = Executor<2>{};
+
+    executor.spawn( echo( signal_a, socket_a, log_a ) );
+    executor.spawn( echo( signal_b, socket_b, log_b ) );
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( executor.tasks(), 2 );
+
+    socket_b.make_available( { 0x37 } );
+    socket_b.set_transmit_capacity( 1 );
+    signal_b.notify();
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( executor.tasks(), 1 );
+    EXPECT_TRUE( log_a.empty() );
+    EXPECT_EQ( socket_a.attempts(), 1 );
+    EXPECT_EQ( socket_b.transmitted(), ( std::vector<std::uint8_t>{ 0x37 } ) );
+}
+
+/**
+ * \brief Verify picolibrary::Coroutine::Executor does not lose wakeups when multiple
+ *        tasks are parked on the same wake signal.
+ */
+TEST( executor, sharedSignal )
+{
+    auto signal = Wake_Signal{};
+    auto socket = Fake_Socket{};
+    auto log    = std::vector<std::string>{};
+
+    auto executor = Executor<2>{};
+
+    auto const receiver = []( Wake_Signal & s, Fake_Socket & f, std::vector<std::string> & l ) -> Task {
+        std::uint8_t buffer[ 1 ];
+
+        static_cast<void>(
+            co_await ::picolibrary::Coroutine::receive( s, f, buffer, buffer + sizeof( buffer ) ) );
+
+        l.push_back( "received" );
+    };
+
+    auto const transmitter = []( Wake_Signal & s, Fake_Socket & f, std::vector<std::string> & l ) -> Task {
+        static std::uint8_t const data[]{ 0xC5 };
+
+        static_cast<void>(
+            co_await ::picolibrary::Coroutine::transmit( s, f, data, data + sizeof( data ) ) );
+
+        l.push_back( "transmitted" );
+    };
+
+    executor.spawn( receiver( signal, socket, log ) );
+    executor.spawn( transmitter( signal, socket, log ) );
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( socket.attempts(), 2 );
+
+    socket.set_transmit_capacity( 1 );
+    signal.notify();
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( socket.attempts(), 4 );
+    EXPECT_EQ( log, ( std::vector<std::string>{ "transmitted" } ) );
+    EXPECT_EQ( executor.tasks(), 1 );
+
+    EXPECT_FALSE( executor.run_once() );
+    EXPECT_EQ( socket.attempts(), 4 );
+
+    socket.make_available( { 0x6B } );
+    signal.notify();
+
+    EXPECT_TRUE( executor.run_once() );
+    EXPECT_EQ( log, ( std::vector<std::string>{ "transmitted", "received" } ) );
+    EXPECT_EQ( executor.tasks(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Coroutine::sleep_for() works properly.
+ */
+TEST( sleepFor, worksProperly )
+{
+    auto service = Timer_Service<2, 3>{};
+    auto wakes   = std::vector<std::uint32_t>{};
+
+    auto executor = Executor<1>{};
+
+    auto const task = []( Timer_Service<2, 3> & s, std::vector<std::uint32_t> & w ) -> Task {
+        co_await ::picolibrary::Coroutine::sleep_for( s, 0 );
+        w.push_back( s.now() );
+        co_await ::picolibrary::Coroutine::sleep_for( s, 5 );
+        w.push_back( s.now() );
+        co_await ::picolibrary::Coroutine::sleep_for( s, 12 );
+        w.push_back( s.now() );
+    };
+
+    executor.spawn( task( service, wakes ) );
+
+    executor.run( [ &service ]() noexcept { service.tick(); } );
+
+    EXPECT_EQ( wakes, ( std::vector<std::uint32_t>{ 0, 5, 17 } ) );
+    EXPECT_EQ( executor.tasks(), 0 );
+}
+
+/**
+ * \brief Execute the picolibrary::Coroutine automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,154 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Debounce::Vertical_Counter_Debouncer automated test program.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/debounce.h"
+
+namespace {
+
+using ::picolibrary::Debounce::Multiple_Signals_Debouncer;
+using ::picolibrary::Debounce::Vertical_Counter_Debouncer;
+
+template<typename State, std::uint_fast8_t SAMPLES>
+void verify_matches_multiple_signals_debouncer()
+{
+    auto random = std::minstd_rand{ SAMPLES };
+
+    auto reference = Multiple_Signals_Debouncer<State, SAMPLES>{ 0 };
+    auto signals   = Vertical_Counter_Debouncer<State, SAMPLES>{ 0 };
+
+    auto sample = State{ 0 };
+    for ( auto i = std::size_t{}; i < 2000; ++i ) {
+        // flip a random subset of the signals so that both bouncing and stable signals
+        // are exercised
+        sample ^= static_cast<State>( random() & random() & random() );
+
+        auto const previous_state = reference.state();
+
+        reference.debounce( sample );
+        signals.debounce( sample );
+
+        ASSERT_EQ( signals.state(), reference.state() ) << "SAMPLES: " << +SAMPLES << ", i: " << i;
+        ASSERT_EQ( signals.changed(), static_cast<State>( previous_state ^ reference.state() ) )
+            << "SAMPLES: " << +SAMPLES << ", i: " << i;
+    } // for
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Debounce::Vertical_Counter_Debouncer works properly.
+ */
+TEST( debouncer, worksProperly )
+{
+    auto signals = Vertical_Counter_Debouncer<std::uint8_t, 6>{ 0b10100011 };
+
+    EXPECT_EQ( signals.state(), 0b10100011 );
+
+    struct {
+        std::uint8_t sample;
+        std::uint8_t state;
+    } const data[]{
+        // clang-format off
+
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+
+        { 0b01011100, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+
+        { 0b00100000, 0b10100011 },
+        { 0b10111101, 0b10100011 },
+        { 0b01000111, 0b10100011 },
+        { 0b01111100, 0b10100011 },
+        { 0b10111011, 0b10100011 },
+        { 0b10100011, 0b10100011 },
+
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b10100011 },
+        { 0b01011100, 0b01011100 },
+
+        // clang-format on
+    };
+
+    for ( auto i = std::size_t{}; i < sizeof( data ) / sizeof( data[ 0 ] ); ++i ) {
+        auto const [ sample, state ] = data[ i ];
+
+        signals.debounce( sample );
+
+        EXPECT_EQ( signals.state(), state ) << "i: " << i;
+        EXPECT_EQ( signals.changed(), i == 29 ? 0b11111111 : 0 ) << "i: " << i;
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::Debounce::Vertical_Counter_Debouncer produces the same
+ *        debounced state as picolibrary::Debounce::Multiple_Signals_Debouncer.
+ */
+TEST( debouncer, matchesMultipleSignalsDebouncer )
+{
+    verify_matches_multiple_signals_debouncer<std::uint8_t, 1>();
+    verify_matches_multiple_signals_debouncer<std::uint8_t, 2>();
+    verify_matches_multiple_signals_debouncer<std::uint16_t, 3>();
+    verify_matches_multiple_signals_debouncer<std::uint16_t, 4>();
+    verify_matches_multiple_signals_debouncer<std::uint32_t, 5>();
+    verify_matches_multiple_signals_debouncer<std::uint32_t, 8>();
+    verify_matches_multiple_signals_debouncer<std::uint64_t, 9>();
+}
+
+/**
+ * \brief Execute the picolibrary::Debounce::Vertical_Counter_Debouncer automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argc The array of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,359 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary event pool automated test program.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/active_object.h"
+#include "picolibrary/event.h"
+#include "picolibrary/event_pool.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/testing/automated/event.h"
+#include "picolibrary/testing/automated/interrupt.h"
+
+namespace {
+
+using ::picolibrary::Active_Object;
+using ::picolibrary::Event;
+using ::picolibrary::Event_Handle;
+using ::picolibrary::Event_ID;
+using ::picolibrary::Event_Pool;
+using ::picolibrary::Event_Pool_Set;
+using ::picolibrary::Event_Publisher;
+using ::picolibrary::Result;
+using ::picolibrary::Simple_Event;
+using ::picolibrary::Testing::Automated::Mock_Event_Category;
+using ::picolibrary::Testing::Automated::Interrupt::Mock_Controller;
+using ::testing::NiceMock;
+
+class Counted_Event final : public Event {
+  public:
+    Counted_Event( Event_ID id, std::size_t & destructions ) noexcept :
+        Event{ Mock_Event_Category::instance(), id },
+        m_destructions{ &destructions }
+    {
+    }
+
+    Counted_Event( Counted_Event && ) = delete;
+
+    Counted_Event( Counted_Event const & ) = delete;
+
+    ~Counted_Event() noexcept override final
+    {
+        ++*m_destructions;
+    }
+
+    auto operator=( Counted_Event && ) = delete;
+
+    auto operator=( Counted_Event const & ) = delete;
+
+#ifndef PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+    auto print_details( ::picolibrary::Output_Stream & ) const noexcept
+        -> Result<std::size_t> override final
+    {
+        return std::size_t{ 0 };
+    }
+
+    auto print_details( ::picolibrary::Reliable_Output_Stream & ) const noexcept
+        -> std::size_t override final
+    {
+        return 0;
+    }
+#endif // PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+
+    void print_details( std::ostream & ) const override final
+    {
+    }
+
+  private:
+    std::size_t * m_destructions;
+};
+
+class Large_Event final : public Event {
+  public:
+    Large_Event( Event_ID id ) noexcept : Event{ Mock_Event_Category::instance(), id }
+    {
+    }
+
+#ifndef PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+    auto print_details( ::picolibrary::Output_Stream & ) const noexcept
+        -> Result<std::size_t> override final
+    {
+        return std::size_t{ 0 };
+    }
+
+    auto print_details( ::picolibrary::Reliable_Output_Stream & ) const noexcept
+        -> std::size_t override final
+    {
+        return 0;
+    }
+#endif // PICOLIBRARY_SUPPRESS_HUMAN_READABLE_EVENT_INFORMATION
+
+    void print_details( std::ostream & ) const override final
+    {
+    }
+
+  private:
+    std::uint8_t m_data[ 64 ]{};
+};
+
+using Small_Event_Pool = Event_Pool<sizeof( Counted_Event ), 2, Mock_Controller::Handle>;
+
+using Large_Event_Pool = Event_Pool<sizeof( Large_Event ), 1, Mock_Controller::Handle>;
+
+class Subscriber :
+    public Active_Object<Subscriber, sizeof( Event_Handle ), std::uint_fast8_t, 4, Mock_Controller::Handle> {
+  public:
+    Subscriber( Mock_Controller & controller, char name, std::ostream & stream ) noexcept :
+        Active_Object{ controller.handle() },
+        m_name{ name },
+        m_stream{ stream }
+    {
+    }
+
+    auto last_event() const noexcept -> Event const *
+    {
+        return m_last_event;
+    }
+
+  private:
+    friend Active_Object;
+
+    char m_name;
+
+    std::ostream & m_stream;
+
+    Event const * m_last_event{};
+
+    void dispatch( Event const & event ) noexcept
+    {
+        m_stream << m_name << static_cast<unsigned int>( event.id() ) << ';';
+
+        m_last_event = &event;
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Event_Pool and picolibrary::Event_Handle work properly.
+ */
+TEST( eventPool, worksProperly )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto destructions = std::size_t{ 0 };
+
+    auto pool = Small_Event_Pool{ controller.handle() };
+
+    EXPECT_EQ( pool.block_size(), sizeof( Counted_Event ) );
+    EXPECT_EQ( pool.available(), 2 );
+
+    EXPECT_FALSE( pool.make<Large_Event>( 1 ) );
+    EXPECT_EQ( pool.available(), 2 );
+
+    {
+        auto a = pool.make<Counted_Event>( 1, destructions );
+
+        ASSERT_TRUE( a );
+        EXPECT_EQ( a.event().id(), 1 );
+        EXPECT_EQ( a.references(), 1 );
+        EXPECT_EQ( pool.available(), 1 );
+
+        auto b = a;
+
+        EXPECT_EQ( &b.event(), &a.event() );
+        EXPECT_EQ( a.references(), 2 );
+
+        auto c = pool.make<Counted_Event>( 2, destructions );
+
+        ASSERT_TRUE( c );
+        EXPECT_EQ( pool.available(), 0 );
+        EXPECT_FALSE( pool.make<Counted_Event>( 3, destructions ) );
+
+        a.reset();
+
+        EXPECT_FALSE( a );
+        EXPECT_EQ( a.references(), 0 );
+        EXPECT_EQ( b.references(), 1 );
+        EXPECT_EQ( destructions, 0 );
+
+        b = std::move( c );
+
+        EXPECT_FALSE( c );
+        EXPECT_EQ( b.event().id(), 2 );
+        EXPECT_EQ( destructions, 1 );
+        EXPECT_EQ( pool.available(), 1 );
+    }
+
+    EXPECT_EQ( destructions, 2 );
+    EXPECT_EQ( pool.available(), 2 );
+}
+
+/**
+ * \brief Verify picolibrary::Event_Pool_Set::make() allocates from the smallest size
+ *        class that the event fits in and that is not exhausted.
+ */
+TEST( eventPoolSet, worksProperly )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto destructions = std::size_t{ 0 };
+
+    auto small_pool = Small_Event_Pool{ controller.handle() };
+    auto large_pool = Large_Event_Pool{ controller.handle() };
+
+    auto const pools = Event_Pool_Set<2>{ small_pool, large_pool };
+
+    auto const a = pools.make<Counted_Event>( 1, destructions );
+    auto const b = pools.make<Large_Event>( 2 );
+
+    EXPECT_TRUE( a );
+    EXPECT_TRUE( b );
+    EXPECT_EQ( small_pool.available(), 1 );
+    EXPECT_EQ( large_pool.available(), 0 );
+
+    EXPECT_FALSE( pools.make<Large_Event>( 3 ) );
+
+    auto const c = pools.make<Counted_Event>( 4, destructions );
+    auto const d = pools.make<Counted_Event>( 5, destructions );
+
+    EXPECT_TRUE( c );
+    EXPECT_FALSE( d );
+    EXPECT_EQ( small_pool.available(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Event_Publisher publishes a single event allocation to all
+ *        subscribers, and that the event is released after the last subscriber has
+ *        processed it.
+ */
+TEST( eventPublisher, worksProperly )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto destructions = std::size_t{ 0 };
+
+    auto pool = Small_Event_Pool{ controller.handle() };
+
+    auto stream = std::ostringstream{};
+
+    auto a = Subscriber{ controller, 'a', stream };
+    auto b = Subscriber{ controller, 'b', stream };
+    auto c = Subscriber{ controller, 'c', stream };
+
+    auto publisher = Event_Publisher<4, 3>{ Mock_Event_Category::instance() };
+
+    EXPECT_EQ( &publisher.category(), &Mock_Event_Category::instance() );
+
+    publisher.add( 0, a );
+    publisher.add( 1, b );
+    publisher.add( 2, c );
+
+    publisher.subscribe( 0, 1 );
+    publisher.subscribe( 1, 1 );
+    publisher.subscribe( 2, 1 );
+    publisher.subscribe( 2, 3 );
+    publisher.unsubscribe( 1, 1 );
+
+    EXPECT_TRUE( publisher.is_subscribed( 0, 1 ) );
+    EXPECT_FALSE( publisher.is_subscribed( 1, 1 ) );
+    EXPECT_FALSE( publisher.is_subscribed( 0, 3 ) );
+
+    EXPECT_EQ( publisher.publish( pool.make<Counted_Event>( 1, destructions ) ), 2 );
+    EXPECT_EQ( publisher.publish_from_interrupt( pool.make<Counted_Event>( 2, destructions ) ), 0 );
+    EXPECT_EQ( publisher.publish( pool.make<Counted_Event>( 3, destructions ) ), 1 );
+
+    EXPECT_EQ( destructions, 1 );
+    EXPECT_EQ( pool.available(), 0 );
+
+    EXPECT_FALSE( b.has_pending_events() );
+
+    a.process_events();
+
+    EXPECT_EQ( destructions, 1 );
+
+    c.process_event();
+
+    EXPECT_EQ( destructions, 2 );
+    EXPECT_EQ( a.last_event(), c.last_event() );
+
+    c.process_events();
+
+    EXPECT_EQ( destructions, 3 );
+    EXPECT_EQ( pool.available(), 2 );
+    EXPECT_EQ( stream.str(), "a1;c1;c3;" );
+}
+
+/**
+ * \brief Verify picolibrary::Event_Publisher does not publish events from other event
+ *        categories.
+ */
+TEST( eventPublisher, otherCategory )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto pool = Small_Event_Pool{ controller.handle() };
+
+    auto stream = std::ostringstream{};
+
+    auto a = Subscriber{ controller, 'a', stream };
+
+    auto publisher = Event_Publisher<4, 1>{ Mock_Event_Category::instance() };
+
+    publisher.add( 0, a );
+
+    publisher.subscribe( 0, 1 );
+
+    auto const other_category = Mock_Event_Category{};
+
+    EXPECT_EQ( publisher.publish( pool.make<Simple_Event>( other_category, 1 ) ), 0 );
+    EXPECT_EQ( publisher.publish_from_interrupt( pool.make<Simple_Event>( other_category, 1 ) ), 0 );
+    EXPECT_EQ( publisher.publish( pool.make<Simple_Event>( Mock_Event_Category::instance(), 1 ) ), 1 );
+
+    EXPECT_EQ( pool.available(), 1 );
+
+    a.process_events();
+
+    EXPECT_EQ( pool.available(), 2 );
+    EXPECT_EQ( stream.str(), "a1;" );
+}
+
+/**
+ * \brief Execute the picolibrary event pool automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,210 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Fixed_Capacity_String automated test program.
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/error.h"
+#include "picolibrary/fixed_capacity_string.h"
+
+namespace {
+
+using ::picolibrary::Fixed_Capacity_String;
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Reliable_Fixed_Capacity_String;
+
+auto to_string( Fixed_Capacity_String<8> const & string ) -> std::string
+{
+    return std::string{ string.begin(), string.end() };
+}
+
+auto to_string( Reliable_Fixed_Capacity_String<8> const & string ) -> std::string
+{
+    return std::string{ string.begin(), string.end() };
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String::Fixed_Capacity_String() works
+ *        properly.
+ */
+TEST( constructorDefault, worksProperly )
+{
+    auto const string = Fixed_Capacity_String<8>{};
+
+    EXPECT_TRUE( string.is_nominal() );
+    EXPECT_TRUE( string.buffer_is_set() );
+    EXPECT_TRUE( string.empty() );
+    EXPECT_FALSE( string.full() );
+    EXPECT_EQ( string.size(), 0 );
+    EXPECT_EQ( string.capacity(), 8 );
+    EXPECT_FALSE( string.truncated() );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String output works properly when the output
+ *        fits in the string.
+ */
+TEST( output, worksProperly )
+{
+    auto string = Fixed_Capacity_String<8>{};
+
+    auto const values = std::vector<std::uint8_t>{ 0x4B, 0x37 };
+
+    EXPECT_FALSE( string.put( &*values.begin(), &*values.end() ).is_error() );
+
+    auto const result = string.print( "zP", '4', "w" );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 4 );
+
+    EXPECT_TRUE( string.is_nominal() );
+    EXPECT_EQ( string.size(), 6 );
+    EXPECT_EQ( to_string( string ), "K7zP4w" );
+    EXPECT_EQ( std::string_view( string.data(), string.size() ), "K7zP4w" );
+    EXPECT_FALSE( string.truncated() );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String output properly handles truncation.
+ */
+TEST( output, truncation )
+{
+    auto string = Fixed_Capacity_String<8>{};
+
+    auto const result = string.print( "Gf0q", "3vNcX", 'j' );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INSUFFICIENT_CAPACITY );
+
+    EXPECT_TRUE( string.fatal_error_present() );
+    EXPECT_TRUE( string.full() );
+    EXPECT_TRUE( string.truncated() );
+    EXPECT_EQ( to_string( string ), "Gf0q3vNc" );
+
+    string.clear();
+
+    EXPECT_TRUE( string.is_nominal() );
+    EXPECT_TRUE( string.empty() );
+    EXPECT_FALSE( string.truncated() );
+
+    EXPECT_FALSE( string.put( "Yr" ).is_error() );
+
+    EXPECT_EQ( to_string( string ), "Yr" );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String::Fixed_Capacity_String(
+ *        picolibrary::Fixed_Capacity_String const & ) works properly.
+ */
+TEST( constructorCopy, worksProperly )
+{
+    auto original = Fixed_Capacity_String<8>{};
+
+    EXPECT_FALSE( original.put( "b9T" ).is_error() );
+
+    auto copy = original;
+
+    EXPECT_FALSE( copy.put( 'e' ).is_error() );
+
+    EXPECT_EQ( to_string( original ), "b9T" );
+    EXPECT_EQ( to_string( copy ), "b9Te" );
+}
+
+/**
+ * \brief Verify picolibrary::Fixed_Capacity_String::operator=(
+ *        picolibrary::Fixed_Capacity_String && ) works properly.
+ */
+TEST( assignmentOperatorMove, worksProperly )
+{
+    auto expression = Fixed_Capacity_String<8>{};
+    auto object     = Fixed_Capacity_String<8>{};
+
+    EXPECT_FALSE( expression.put( "Lm" ).is_error() );
+    EXPECT_FALSE( object.put( "Q1s" ).is_error() );
+
+    object = std::move( expression );
+
+    EXPECT_FALSE( object.put( 'o' ).is_error() );
+
+    EXPECT_TRUE( object.is_nominal() );
+    EXPECT_EQ( to_string( object ), "Lmo" );
+}
+
+/**
+ * \brief Verify picolibrary::Reliable_Fixed_Capacity_String output works properly when
+ *        the output fits in the string.
+ */
+TEST( outputReliable, worksProperly )
+{
+    auto string = Reliable_Fixed_Capacity_String<8>{};
+
+    string.put( 'a' );
+
+    EXPECT_EQ( string.print( "Xq", '7' ), 3 );
+
+    EXPECT_TRUE( string.is_nominal() );
+    EXPECT_EQ( to_string( string ), "aXq7" );
+    EXPECT_FALSE( string.truncated() );
+}
+
+/**
+ * \brief Verify picolibrary::Reliable_Fixed_Capacity_String output properly handles
+ *        truncation.
+ */
+TEST( outputReliable, truncation )
+{
+    auto string = Reliable_Fixed_Capacity_String<8>{};
+
+    string.print( "r2Dk9", "Pu0h", 'W' );
+
+    EXPECT_TRUE( string.is_nominal() );
+    EXPECT_TRUE( string.full() );
+    EXPECT_TRUE( string.truncated() );
+    EXPECT_EQ( to_string( string ), "r2Dk9Pu0" );
+
+    string.clear();
+
+    EXPECT_TRUE( string.empty() );
+    EXPECT_FALSE( string.truncated() );
+}
+
+/**
+ * \brief Execute the picolibrary::Fixed_Capacity_String automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
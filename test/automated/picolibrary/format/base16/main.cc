@@ -0,0 +1,270 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Format::Base16 automated test program.
+ */
+
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/format.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Result;
+using ::picolibrary::Format::Base16;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Output_Stream;
+using ::picolibrary::Testing::Automated::Output_String_Stream;
+using ::picolibrary::Testing::Automated::Reliable_Output_String_Stream;
+using ::testing::A;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base16<Iterator> const & )
+ *        properly handles a put error.
+ */
+TEST( outputFormatterFormatBase16PrintOutputStreamErrorHandling, putError )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = Mock_Error{ 47 };
+
+    EXPECT_CALL( stream.buffer(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto const data = std::string_view{ "H0w8" };
+
+    auto const result = stream.print( Base16{ data.begin(), data.end() } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_present() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print() test
+ *        case.
+ */
+struct outputFormatterFormatBase16Print_Test_Case {
+    /**
+     * \brief The data to encode.
+     */
+    std::string_view data;
+
+    /**
+     * \brief The encoded data.
+     */
+    std::string_view encoded;
+};
+
+auto operator<<( std::ostream & stream, outputFormatterFormatBase16Print_Test_Case const & test_case )
+    -> std::ostream &
+{
+    return stream << test_case.data;
+}
+
+/**
+ * \brief picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print() test
+ *        cases.
+ */
+outputFormatterFormatBase16Print_Test_Case const outputFormatterFormatBase16Print_TEST_CASES[]{
+    // clang-format off
+
+        {
+            "",
+            "",
+        },
+        {
+            "f",
+            "66",
+        },
+        {
+            "fo",
+            "666F",
+        },
+        {
+            "foobar",
+            "666F6F626172",
+        },
+        {
+            "\xA5\x0F\xE1",
+            "A50FE1",
+        },
+
+    // clang-format on
+};
+
+/**
+ * \brief picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base16<Iterator> const & ) test
+ *        fixture.
+ */
+class outputFormatterFormatBase16PrintOutputStream :
+    public TestWithParam<outputFormatterFormatBase16Print_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base16<Iterator> const & ) works
+ *        properly.
+ */
+TEST_P( outputFormatterFormatBase16PrintOutputStream, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = stream.print( Base16{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.encoded );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base16<Iterator> const & ) works
+ *        properly when the data is encoded with multiple puts.
+ */
+TEST_P( outputFormatterFormatBase16PrintOutputStream, worksProperlyMultiplePuts )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = stream.print(
+        Base16<std::string_view::const_iterator, 1>{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.encoded );
+}
+
+INSTANTIATE_TEST_SUITE_P( testCases, outputFormatterFormatBase16PrintOutputStream, ValuesIn( outputFormatterFormatBase16Print_TEST_CASES ) );
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base16<Iterator> const & ) limits
+ *        the amount of data encoded with a single put.
+ */
+TEST( outputFormatterFormatBase16PrintOutputStream, putLimit )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Output_Stream{};
+
+    auto const data = std::string_view{ "foobar" };
+
+    EXPECT_CALL( stream.buffer(), put( std::string{ "666F6F62" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.buffer(), put( std::string{ "6172" } ) ).WillOnce( Return( Result<void>{} ) );
+
+    auto const result = stream.print(
+        Base16<std::string_view::const_iterator, 4>{ data.begin(), data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 12 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print(
+ *        picolibrary::Reliable_Output_Stream &, picolibrary::Format::Base16<Iterator> const & )
+ *        test fixture.
+ */
+class outputFormatterFormatBase16PrintReliableOutputStream :
+    public TestWithParam<outputFormatterFormatBase16Print_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print(
+ *        picolibrary::Reliable_Output_Stream &, picolibrary::Format::Base16<Iterator> const & )
+ *        works properly.
+ */
+TEST_P( outputFormatterFormatBase16PrintReliableOutputStream, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Reliable_Output_String_Stream{};
+
+    auto const n = stream.print( Base16{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.encoded );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base16<Iterator>>::print(
+ *        picolibrary::Reliable_Output_Stream &, picolibrary::Format::Base16<Iterator> const & )
+ *        works properly when the data is encoded with multiple puts.
+ */
+TEST_P( outputFormatterFormatBase16PrintReliableOutputStream, worksProperlyMultiplePuts )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Reliable_Output_String_Stream{};
+
+    auto const n = stream.print(
+        Base16<std::string_view::const_iterator, 1>{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.encoded );
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    testCases,
+    outputFormatterFormatBase16PrintReliableOutputStream,
+    ValuesIn( outputFormatterFormatBase16Print_TEST_CASES ) );
+
+/**
+ * \brief Execute the picolibrary::Format::Base16 automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argc The array of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,282 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Format::Base64 automated test program.
+ */
+
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/format.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Result;
+using ::picolibrary::Format::Base64;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Output_Stream;
+using ::picolibrary::Testing::Automated::Output_String_Stream;
+using ::picolibrary::Testing::Automated::Reliable_Output_String_Stream;
+using ::testing::A;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base64<Iterator> const & )
+ *        properly handles a put error.
+ */
+TEST( outputFormatterFormatBase64PrintOutputStreamErrorHandling, putError )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = Mock_Error{ 212 };
+
+    EXPECT_CALL( stream.buffer(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto const data = std::string_view{ "q7Lx" };
+
+    auto const result = stream.print( Base64{ data.begin(), data.end() } );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_present() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print() test
+ *        case.
+ */
+struct outputFormatterFormatBase64Print_Test_Case {
+    /**
+     * \brief The data to encode.
+     */
+    std::string_view data;
+
+    /**
+     * \brief The encoded data.
+     */
+    std::string_view encoded;
+};
+
+auto operator<<( std::ostream & stream, outputFormatterFormatBase64Print_Test_Case const & test_case )
+    -> std::ostream &
+{
+    return stream << test_case.data;
+}
+
+/**
+ * \brief picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print() test
+ *        cases.
+ */
+outputFormatterFormatBase64Print_Test_Case const outputFormatterFormatBase64Print_TEST_CASES[]{
+    // clang-format off
+
+        {
+            "",
+            "",
+        },
+        {
+            "f",
+            "Zg==",
+        },
+        {
+            "fo",
+            "Zm8=",
+        },
+        {
+            "foo",
+            "Zm9v",
+        },
+        {
+            "foob",
+            "Zm9vYg==",
+        },
+        {
+            "fooba",
+            "Zm9vYmE=",
+        },
+        {
+            "foobar",
+            "Zm9vYmFy",
+        },
+        {
+            "\xFB\xFF\x01",
+            "+/8B",
+        },
+
+    // clang-format on
+};
+
+/**
+ * \brief picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base64<Iterator> const & ) test
+ *        fixture.
+ */
+class outputFormatterFormatBase64PrintOutputStream :
+    public TestWithParam<outputFormatterFormatBase64Print_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base64<Iterator> const & ) works
+ *        properly.
+ */
+TEST_P( outputFormatterFormatBase64PrintOutputStream, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = stream.print( Base64{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.encoded );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base64<Iterator> const & ) works
+ *        properly when the data is encoded with multiple puts.
+ */
+TEST_P( outputFormatterFormatBase64PrintOutputStream, worksProperlyMultiplePuts )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = stream.print(
+        Base64<std::string_view::const_iterator, 1>{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.encoded );
+}
+
+INSTANTIATE_TEST_SUITE_P( testCases, outputFormatterFormatBase64PrintOutputStream, ValuesIn( outputFormatterFormatBase64Print_TEST_CASES ) );
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Base64<Iterator> const & ) limits
+ *        the amount of data encoded with a single put.
+ */
+TEST( outputFormatterFormatBase64PrintOutputStream, putLimit )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Output_Stream{};
+
+    auto const data = std::string_view{ "foobar" };
+
+    EXPECT_CALL( stream.buffer(), put( std::string{ "Zm9v" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.buffer(), put( std::string{ "YmFy" } ) ).WillOnce( Return( Result<void>{} ) );
+
+    auto const result = stream.print(
+        Base64<std::string_view::const_iterator, 1>{ data.begin(), data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 8 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print(
+ *        picolibrary::Reliable_Output_Stream &, picolibrary::Format::Base64<Iterator> const & )
+ *        test fixture.
+ */
+class outputFormatterFormatBase64PrintReliableOutputStream :
+    public TestWithParam<outputFormatterFormatBase64Print_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print(
+ *        picolibrary::Reliable_Output_Stream &, picolibrary::Format::Base64<Iterator> const & )
+ *        works properly.
+ */
+TEST_P( outputFormatterFormatBase64PrintReliableOutputStream, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Reliable_Output_String_Stream{};
+
+    auto const n = stream.print( Base64{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.encoded );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::Base64<Iterator>>::print(
+ *        picolibrary::Reliable_Output_Stream &, picolibrary::Format::Base64<Iterator> const & )
+ *        works properly when the data is encoded with multiple puts.
+ */
+TEST_P( outputFormatterFormatBase64PrintReliableOutputStream, worksProperlyMultiplePuts )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Reliable_Output_String_Stream{};
+
+    auto const n = stream.print(
+        Base64<std::string_view::const_iterator, 1>{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.encoded );
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    testCases,
+    outputFormatterFormatBase64PrintReliableOutputStream,
+    ValuesIn( outputFormatterFormatBase64Print_TEST_CASES ) );
+
+/**
+ * \brief Execute the picolibrary::Format::Base64 automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argc The array of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -32,12 +32,14 @@
 
 namespace {
 
+using ::picolibrary::Result;
 using ::picolibrary::Format::Hex_Dump;
 using ::picolibrary::Testing::Automated::Mock_Error;
 using ::picolibrary::Testing::Automated::Mock_Output_Stream;
 using ::picolibrary::Testing::Automated::Output_String_Stream;
 using ::picolibrary::Testing::Automated::Reliable_Output_String_Stream;
 using ::testing::A;
+using ::testing::InSequence;
 using ::testing::Return;
 using ::testing::TestWithParam;
 using ::testing::ValuesIn;
@@ -155,8 +157,65 @@ TEST_P( outputFormatterFormatHexDumpPrintOutputStream, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex_dump );
 }
 
+/**
+ * \brief Verify
+ *        picolibrary::Output_Formatter<picolibrary::Format::Hex_Dump<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Hex_Dump<Iterator> const & )
+ *        works properly when multiple rows are written with a single put.
+ */
+TEST_P( outputFormatterFormatHexDumpPrintOutputStream, worksProperlyMultipleRowsPerPut )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = stream.print(
+        Hex_Dump<std::string_view::const_iterator, 3>{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex_dump );
+}
+
 INSTANTIATE_TEST_SUITE_P( testCases, outputFormatterFormatHexDumpPrintOutputStream, ValuesIn( outputFormatterFormatHexDumpPrint_TEST_CASES ) );
 
+/**
+ * \brief Verify
+ *        picolibrary::Output_Formatter<picolibrary::Format::Hex_Dump<Iterator>>::print(
+ *        picolibrary::Output_Stream &, picolibrary::Format::Hex_Dump<Iterator> const & )
+ *        writes multiple rows with a single put.
+ */
+TEST( outputFormatterFormatHexDumpPrintOutputStream, multipleRowsPerPut )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Output_Stream{};
+
+    auto const data = std::string_view{ "/B>wiGoUZ|6cjO(_`T.8jV:RxSUssq!L{yZZk7V!" };
+
+    EXPECT_CALL(
+        stream.buffer(),
+        put( std::string{
+            "0000000000000000  2F 42 3E 77 69 47 6F 55 5A 7C 36 63 6A 4F 28 5F  |/B>wiGoUZ|6cjO(_|\n"
+            "0000000000000010  60 54 2E 38 6A 56 3A 52 78 53 55 73 73 71 21 4C  |`T.8jV:RxSUssq!L|\n" } ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL(
+        stream.buffer(),
+        put( std::string{
+            "0000000000000020  7B 79 5A 5A 6B 37 56 21                          |{yZZk7V!|        \n" } ) )
+        .WillOnce( Return( Result<void>{} ) );
+
+    auto const result = stream.print(
+        Hex_Dump<std::string_view::const_iterator, 2>{ data.begin(), data.end() } );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 3 * 86 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
 /**
  * \brief picolibrary::Output_Formatter<picolibrary::Format::Hex_Dump<Iterator>>::print(
  *        picolibrary::Reliable_Output_Stream &, picolibrary::Format::Hex_Dump<Iterator>
@@ -186,6 +245,27 @@ TEST_P( outputFormatterFormatHexDumpPrintReliableOutputStream, worksProperly )
     EXPECT_EQ( stream.string(), test_case.hex_dump );
 }
 
+/**
+ * \brief Verify
+ *        picolibrary::Output_Formatter<picolibrary::Format::Hex_Dump<Iterator>>::print(
+ *        picolibrary::Reliable_Output_Stream &, picolibrary::Format::Hex_Dump<Iterator>
+ *        const & ) works properly when multiple rows are written with a single put.
+ */
+TEST_P( outputFormatterFormatHexDumpPrintReliableOutputStream, worksProperlyMultipleRowsPerPut )
+{
+    auto const test_case = GetParam();
+
+    auto stream = Reliable_Output_String_Stream{};
+
+    auto const n = stream.print(
+        Hex_Dump<std::string_view::const_iterator, 3>{ test_case.data.begin(), test_case.data.end() } );
+
+    EXPECT_EQ( n, stream.string().size() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_EQ( stream.string(), test_case.hex_dump );
+}
+
 INSTANTIATE_TEST_SUITE_P(
     testCases,
     outputFormatterFormatHexDumpPrintReliableOutputStream,
@@ -0,0 +1,230 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Format::String automated test program.
+ */
+
+#include <cstdint>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/format.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Result;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Output_Stream;
+using ::picolibrary::Testing::Automated::Output_String_Stream;
+using ::picolibrary::Testing::Automated::Reliable_Output_String_Stream;
+using ::testing::A;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::SafeMatcherCast;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::String<Source,
+ *        Types...>>::print( picolibrary::Output_Stream &,
+ *        picolibrary::Format::String<Source, Types...> const & ) properly handles a
+ *        literal put error.
+ */
+TEST( outputFormatterFormatStringPrintOutputStreamErrorHandling, literalPutError )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = Mock_Error{ 47 };
+
+    EXPECT_CALL( stream.buffer(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( PICOLIBRARY_FORMAT( "rGz{}", 'Q' ) );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_present() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::String<Source,
+ *        Types...>>::print( picolibrary::Output_Stream &,
+ *        picolibrary::Format::String<Source, Types...> const & ) properly handles a
+ *        value put error.
+ */
+TEST( outputFormatterFormatStringPrintOutputStreamErrorHandling, valuePutError )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = Mock_Error{ 210 };
+
+    EXPECT_CALL( stream.buffer(), put( A<char>() ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.print( PICOLIBRARY_FORMAT( "{}Ti", 'Q' ) );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_present() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::String<Source,
+ *        Types...>>::print( picolibrary::Output_Stream &,
+ *        picolibrary::Format::String<Source, Types...> const & ) merges adjacent
+ *        literal characters into a single put.
+ */
+TEST( outputFormatterFormatStringPrintOutputStream, mergesLiterals )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Output_Stream{};
+
+    EXPECT_CALL( stream.buffer(), put( std::string{ "a{b}c=" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.buffer(), put( SafeMatcherCast<char>( Eq( 'x' ) ) ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.buffer(), put( std::string{ "}}d" } ) ).WillOnce( Return( Result<void>{} ) );
+
+    auto const result = stream.print( PICOLIBRARY_FORMAT( "a{{b}}c={}}}}}d", 'x' ) );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 10 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::String<Source,
+ *        Types...>>::print( picolibrary::Output_Stream &,
+ *        picolibrary::Format::String<Source, Types...> const & ) works properly.
+ */
+TEST( outputFormatterFormatStringPrintOutputStream, worksProperly )
+{
+    {
+        auto stream = Output_String_Stream{};
+
+        auto const result = stream.print( PICOLIBRARY_FORMAT( "" ) );
+
+        EXPECT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), 0 );
+
+        EXPECT_TRUE( stream.is_nominal() );
+        EXPECT_EQ( stream.string(), "" );
+    }
+
+    {
+        auto stream = Output_String_Stream{};
+
+        auto const result = stream.print( PICOLIBRARY_FORMAT( "8Ls{{3}}" ) );
+
+        EXPECT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), stream.string().size() );
+
+        EXPECT_TRUE( stream.is_nominal() );
+        EXPECT_EQ( stream.string(), "8Ls{3}" );
+    }
+
+    {
+        auto stream = Output_String_Stream{};
+
+        auto const result = stream.print( PICOLIBRARY_FORMAT(
+            "temp={} rh={:d} status={:x} flags={:b}{}",
+            "-3",
+            std::int16_t{ -417 },
+            std::uint16_t{ 0x3A9C },
+            std::uint8_t{ 0b1001'0110 },
+            '\n' ) );
+
+        EXPECT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), stream.string().size() );
+
+        EXPECT_TRUE( stream.is_nominal() );
+        EXPECT_EQ( stream.string(), "temp=-3 rh=-417 status=0x3A9C flags=0b10010110\n" );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::Output_Formatter<picolibrary::Format::String<Source,
+ *        Types...>>::print( picolibrary::Reliable_Output_Stream &,
+ *        picolibrary::Format::String<Source, Types...> const & ) works properly.
+ */
+TEST( outputFormatterFormatStringPrintReliableOutputStream, worksProperly )
+{
+    {
+        auto stream = Reliable_Output_String_Stream{};
+
+        auto const n = stream.print( PICOLIBRARY_FORMAT( "" ) );
+
+        EXPECT_EQ( n, 0 );
+
+        EXPECT_TRUE( stream.is_nominal() );
+        EXPECT_EQ( stream.string(), "" );
+    }
+
+    {
+        auto stream = Reliable_Output_String_Stream{};
+
+        auto const n = stream.print( PICOLIBRARY_FORMAT( "8Ls{{3}}" ) );
+
+        EXPECT_EQ( n, stream.string().size() );
+
+        EXPECT_TRUE( stream.is_nominal() );
+        EXPECT_EQ( stream.string(), "8Ls{3}" );
+    }
+
+    {
+        auto stream = Reliable_Output_String_Stream{};
+
+        auto const n = stream.print( PICOLIBRARY_FORMAT(
+            "temp={} rh={:d} status={:x} flags={:b}{}",
+            "-3",
+            std::int16_t{ -417 },
+            std::uint16_t{ 0x3A9C },
+            std::uint8_t{ 0b1001'0110 },
+            '\n' ) );
+
+        EXPECT_EQ( n, stream.string().size() );
+
+        EXPECT_TRUE( stream.is_nominal() );
+        EXPECT_EQ( stream.string(), "temp=-3 rh=-417 status=0x3A9C flags=0b10010110\n" );
+    }
+}
+
+/**
+ * \brief Execute the picolibrary::Format::String automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,609 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary framing automated test program.
+ */
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/circular_buffer.h"
+#include "picolibrary/error.h"
+#include "picolibrary/framing.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Circular_Buffer;
+using ::picolibrary::Circular_Buffer_Use_Case;
+using ::picolibrary::COBS_Decoder;
+using ::picolibrary::COBS_Encoder_Stream_Buffer;
+using ::picolibrary::Framed_Output_Stream;
+using ::picolibrary::Generic_Error;
+using ::picolibrary::is_interrupt_written_circular_buffer_v;
+using ::picolibrary::Reliable_COBS_Encoder_Stream_Buffer;
+using ::picolibrary::Reliable_SLIP_Encoder_Stream_Buffer;
+using ::picolibrary::SLIP_Decoder;
+using ::picolibrary::SLIP_Encoder_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Reliable_Vector_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Vector_Stream_Buffer;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::SafeMatcherCast;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+
+using Main_Buffer = Circular_Buffer<std::uint8_t, std::uint_fast16_t, 512, Circular_Buffer_Use_Case::MAIN_READS_MAIN_WRITES>;
+
+/**
+ * \brief Circular buffer that is written to by interrupts.
+ */
+class Interrupt_Buffer {
+  public:
+    using Value = std::uint8_t;
+
+    auto full_from_interrupt() const noexcept -> bool
+    {
+        return false;
+    }
+
+    void push_from_interrupt( Value const & value ) noexcept
+    {
+        m_vector.push_back( value );
+    }
+
+    auto vector() const noexcept -> std::vector<Value> const &
+    {
+        return m_vector;
+    }
+
+  private:
+    std::vector<Value> m_vector{};
+};
+
+static_assert( not is_interrupt_written_circular_buffer_v<Main_Buffer> );
+static_assert( is_interrupt_written_circular_buffer_v<Interrupt_Buffer> );
+
+/**
+ * \brief Generate a sequence of bytes.
+ *
+ * \param[in] first The first byte in the sequence.
+ * \param[in] last The last byte in the sequence.
+ *
+ * \return The sequence of bytes.
+ */
+auto sequence( std::uint8_t first, std::uint8_t last ) -> std::vector<std::uint8_t>
+{
+    auto bytes = std::vector<std::uint8_t>{};
+
+    for ( auto byte = unsigned{ first }; byte <= last; ++byte ) {
+        bytes.push_back( static_cast<std::uint8_t>( byte ) );
+    } // for
+
+    return bytes;
+}
+
+/**
+ * \brief Concatenate sequences of bytes.
+ *
+ * \param[in] sequences The sequences of bytes to concatenate.
+ *
+ * \return The concatenated sequences of bytes.
+ */
+auto concatenate( std::vector<std::vector<std::uint8_t>> const & sequences ) -> std::vector<std::uint8_t>
+{
+    auto bytes = std::vector<std::uint8_t>{};
+
+    for ( auto const & sequence : sequences ) {
+        bytes.insert( bytes.end(), sequence.begin(), sequence.end() );
+    } // for
+
+    return bytes;
+}
+
+/**
+ * \brief Framing test case.
+ */
+struct Framing_Test_Case {
+    /**
+     * \brief The decoded frame.
+     */
+    std::vector<std::uint8_t> decoded;
+
+    /**
+     * \brief The encoded frame (including the frame delimiter).
+     */
+    std::vector<std::uint8_t> encoded;
+};
+
+auto operator<<( std::ostream & stream, Framing_Test_Case const & test_case ) -> std::ostream &
+{
+    return stream << "{ .decoded.size() = " << test_case.decoded.size()
+                  << ", .encoded.size() = " << test_case.encoded.size() << " }";
+}
+
+/**
+ * \brief Drain a circular buffer.
+ *
+ * \tparam Buffer The type of circular buffer to drain.
+ *
+ * \param[in] buffer The circular buffer to drain.
+ *
+ * \return The data that was drained from the circular buffer.
+ */
+template<typename Buffer>
+auto drain( Buffer & buffer ) -> std::vector<std::uint8_t>
+{
+    auto data = std::vector<std::uint8_t>{};
+
+    while ( not buffer.empty() ) {
+        data.push_back( buffer.front() );
+        buffer.pop();
+    } // while
+
+    return data;
+}
+
+/**
+ * \brief picolibrary COBS test cases.
+ */
+auto const COBS_TEST_CASES = std::vector<Framing_Test_Case>{
+    // clang-format off
+
+    { { 0x00 }, { 0x01, 0x01, 0x00 } },
+    { { 0x00, 0x00 }, { 0x01, 0x01, 0x01, 0x00 } },
+    { { 0x00, 0x11, 0x00 }, { 0x01, 0x02, 0x11, 0x01, 0x00 } },
+    { { 0x11, 0x22, 0x00, 0x33 }, { 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 } },
+    { { 0x11, 0x22, 0x33, 0x44 }, { 0x05, 0x11, 0x22, 0x33, 0x44, 0x00 } },
+    { { 0x11, 0x00, 0x00, 0x00 }, { 0x02, 0x11, 0x01, 0x01, 0x01, 0x00 } },
+    { sequence( 0x01, 0xFE ), concatenate( { { 0xFF }, sequence( 0x01, 0xFE ), { 0x00 } } ) },
+    { concatenate( { { 0x00 }, sequence( 0x01, 0xFE ) } ), concatenate( { { 0x01, 0xFF }, sequence( 0x01, 0xFE ), { 0x00 } } ) },
+    { sequence( 0x01, 0xFF ), concatenate( { { 0xFF }, sequence( 0x01, 0xFE ), { 0x02, 0xFF, 0x00 } } ) },
+    { concatenate( { sequence( 0x02, 0xFF ), { 0x00 } } ), concatenate( { { 0xFF }, sequence( 0x02, 0xFF ), { 0x01, 0x01, 0x00 } } ) },
+    { concatenate( { sequence( 0x03, 0xFF ), { 0x00, 0x01 } } ), concatenate( { { 0xFE }, sequence( 0x03, 0xFF ), { 0x02, 0x01, 0x00 } } ) },
+
+    // clang-format on
+};
+
+/**
+ * \brief picolibrary SLIP test cases.
+ */
+auto const SLIP_TEST_CASES = std::vector<Framing_Test_Case>{
+    // clang-format off
+
+    { { 0x01 }, { 0x01, 0xC0 } },
+    { { 0xC0 }, { 0xDB, 0xDC, 0xC0 } },
+    { { 0xDB }, { 0xDB, 0xDD, 0xC0 } },
+    { { 0x3A, 0xC0, 0xDB, 0xDC, 0xDD, 0x00 }, { 0x3A, 0xDB, 0xDC, 0xDB, 0xDD, 0xDC, 0xDD, 0x00, 0xC0 } },
+
+    // clang-format on
+};
+
+} // namespace
+
+/**
+ * \brief picolibrary::COBS_Encoder_Stream_Buffer encoding test fixture.
+ */
+class cobsEncoding : public TestWithParam<Framing_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::COBS_Encoder_Stream_Buffer properly encodes a frame.
+ */
+TEST_P( cobsEncoding, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto downstream = Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto buffer = COBS_Encoder_Stream_Buffer{ downstream };
+
+    EXPECT_FALSE( buffer.put( &*test_case.decoded.begin(), &*test_case.decoded.end() ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_EQ( downstream.vector(), test_case.encoded );
+}
+
+INSTANTIATE_TEST_SUITE_P( testCases, cobsEncoding, ValuesIn( COBS_TEST_CASES ) );
+
+/**
+ * \brief picolibrary::Reliable_COBS_Encoder_Stream_Buffer encoding test fixture.
+ */
+class reliableCobsEncoding : public TestWithParam<Framing_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::Reliable_COBS_Encoder_Stream_Buffer properly encodes a frame.
+ */
+TEST_P( reliableCobsEncoding, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto downstream = Reliable_Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto buffer = Reliable_COBS_Encoder_Stream_Buffer{ downstream };
+
+    EXPECT_FALSE( buffer.put( &*test_case.decoded.begin(), &*test_case.decoded.end() ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_EQ( downstream.vector(), test_case.encoded );
+}
+
+INSTANTIATE_TEST_SUITE_P( testCases, reliableCobsEncoding, ValuesIn( COBS_TEST_CASES ) );
+
+/**
+ * \brief picolibrary::COBS_Decoder decoding test fixture.
+ */
+class cobsDecoding : public TestWithParam<Framing_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::COBS_Decoder properly decodes a frame.
+ */
+TEST_P( cobsDecoding, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto buffer = Main_Buffer{};
+
+    auto decoder = COBS_Decoder{ buffer };
+
+    for ( auto i = std::size_t{ 0 }; i < test_case.encoded.size(); ++i ) {
+        auto const result = decoder.decode( test_case.encoded[ i ] );
+
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), i + 1 == test_case.encoded.size() );
+    } // for
+
+    EXPECT_EQ( decoder.frame_size(), test_case.decoded.size() );
+    EXPECT_EQ( drain( buffer ), test_case.decoded );
+}
+
+INSTANTIATE_TEST_SUITE_P( testCases, cobsDecoding, ValuesIn( COBS_TEST_CASES ) );
+
+/**
+ * \brief Verify picolibrary::COBS_Encoder_Stream_Buffer does not write a frame if no data
+ *        has been written since the previous frame was completed.
+ */
+TEST( cobsEncoding, emptyFrame )
+{
+    auto downstream = Mock_Stream_Buffer{};
+
+    auto buffer = COBS_Encoder_Stream_Buffer{ downstream };
+
+    EXPECT_CALL( downstream, flush() ).WillOnce( Return( ::picolibrary::Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.flush().is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::COBS_Encoder_Stream_Buffer properly handles a downstream
+ *        buffer write error.
+ */
+TEST( cobsEncoding, downstreamError )
+{
+    auto downstream = Mock_Stream_Buffer{};
+
+    auto buffer = COBS_Encoder_Stream_Buffer{ downstream };
+
+    auto const error = Mock_Error{ 0x4C };
+
+    EXPECT_CALL( downstream, put( SafeMatcherCast<std::uint8_t>( _ ) ) ).WillOnce( Return( error ) );
+
+    auto const result = buffer.put( std::uint8_t{ 0x00 } );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::COBS_Decoder ignores empty frames and writes to circular
+ *        buffers that are written to by interrupts.
+ */
+TEST( cobsDecoding, consecutiveFrames )
+{
+    auto buffer = Interrupt_Buffer{};
+
+    auto decoder = COBS_Decoder{ buffer };
+
+    auto const encoded = std::vector<std::uint8_t>{ 0x00, 0x00, 0x02, 0x7A, 0x00, 0x00, 0x01, 0x00 };
+    auto const frame_completed = std::vector<bool>{ false, false, false, false, true, false, false, true };
+
+    for ( auto i = std::size_t{ 0 }; i < encoded.size(); ++i ) {
+        auto const result = decoder.decode( encoded[ i ] );
+
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), frame_completed[ i ] );
+    } // for
+
+    EXPECT_EQ( decoder.frame_size(), 0 );
+    EXPECT_EQ( buffer.vector(), ( std::vector<std::uint8_t>{ 0x7A } ) );
+}
+
+/**
+ * \brief Verify picolibrary::COBS_Decoder properly handles a truncated block.
+ */
+TEST( cobsDecoding, truncatedBlock )
+{
+    auto buffer = Main_Buffer{};
+
+    auto decoder = COBS_Decoder{ buffer };
+
+    EXPECT_FALSE( decoder.decode( 0x03 ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x5E ).is_error() );
+
+    auto const result = decoder.decode( 0x00 );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+    EXPECT_EQ( decoder.frame_size(), 1 );
+
+    EXPECT_FALSE( decoder.decode( 0x02 ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x91 ).is_error() );
+    EXPECT_TRUE( decoder.decode( 0x00 ).value() );
+    EXPECT_EQ( decoder.frame_size(), 1 );
+
+    EXPECT_EQ( drain( buffer ), ( std::vector<std::uint8_t>{ 0x5E, 0x91 } ) );
+}
+
+/**
+ * \brief Verify picolibrary::COBS_Decoder properly handles a full circular buffer.
+ */
+TEST( cobsDecoding, insufficientCapacity )
+{
+    auto buffer = Circular_Buffer<std::uint8_t, std::uint_fast8_t, 2, Circular_Buffer_Use_Case::MAIN_READS_MAIN_WRITES>{};
+
+    auto decoder = COBS_Decoder{ buffer };
+
+    EXPECT_FALSE( decoder.decode( 0x04 ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x1B ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x2C ).is_error() );
+
+    auto const result = decoder.decode( 0x3D );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INSUFFICIENT_CAPACITY );
+    EXPECT_EQ( decoder.frame_size(), 2 );
+
+    EXPECT_FALSE( decoder.decode( 0x01 ).value() );
+    EXPECT_FALSE( decoder.decode( 0x00 ).value() );
+
+    buffer.clear();
+
+    EXPECT_FALSE( decoder.decode( 0x02 ).is_error() );
+    EXPECT_FALSE( decoder.decode( 0x6F ).is_error() );
+    EXPECT_TRUE( decoder.decode( 0x00 ).value() );
+    EXPECT_EQ( drain( buffer ), ( std::vector<std::uint8_t>{ 0x6F } ) );
+}
+
+/**
+ * \brief picolibrary::SLIP_Encoder_Stream_Buffer encoding test fixture.
+ */
+class slipEncoding : public TestWithParam<Framing_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::SLIP_Encoder_Stream_Buffer properly encodes a frame.
+ */
+TEST_P( slipEncoding, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto downstream = Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto buffer = SLIP_Encoder_Stream_Buffer{ downstream };
+
+    EXPECT_FALSE( buffer.put( &*test_case.decoded.begin(), &*test_case.decoded.end() ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_EQ( downstream.vector(), test_case.encoded );
+}
+
+INSTANTIATE_TEST_SUITE_P( testCases, slipEncoding, ValuesIn( SLIP_TEST_CASES ) );
+
+/**
+ * \brief picolibrary::Reliable_SLIP_Encoder_Stream_Buffer encoding test fixture.
+ */
+class reliableSlipEncoding : public TestWithParam<Framing_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::Reliable_SLIP_Encoder_Stream_Buffer properly encodes a frame.
+ */
+TEST_P( reliableSlipEncoding, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto downstream = Reliable_Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto buffer = Reliable_SLIP_Encoder_Stream_Buffer{ downstream };
+
+    EXPECT_FALSE( buffer.put( &*test_case.decoded.begin(), &*test_case.decoded.end() ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_EQ( downstream.vector(), test_case.encoded );
+}
+
+INSTANTIATE_TEST_SUITE_P( testCases, reliableSlipEncoding, ValuesIn( SLIP_TEST_CASES ) );
+
+/**
+ * \brief Verify picolibrary::SLIP_Encoder_Stream_Buffer writes escaped data to the
+ *        downstream buffer one chunk at a time.
+ */
+TEST( slipEncoding, chunking )
+{
+    auto const in_sequence = InSequence{};
+
+    auto downstream = Mock_Stream_Buffer{};
+
+    auto buffer = SLIP_Encoder_Stream_Buffer{ downstream };
+
+    auto data = std::vector<std::uint8_t>( 32, 0x5A );
+    data[ 30 ] = SLIP_Encoder_Stream_Buffer::END;
+
+    auto first_chunk = std::vector<std::uint8_t>( 30, 0x5A );
+    first_chunk.push_back( SLIP_Encoder_Stream_Buffer::ESC );
+    first_chunk.push_back( SLIP_Encoder_Stream_Buffer::ESC_END );
+
+    EXPECT_CALL( downstream, put( first_chunk ) ).WillOnce( Return( ::picolibrary::Result<void>{} ) );
+    EXPECT_CALL( downstream, put( std::vector<std::uint8_t>{ 0x5A } ) )
+        .WillOnce( Return( ::picolibrary::Result<void>{} ) );
+    EXPECT_CALL( downstream, put( std::vector<std::uint8_t>{ SLIP_Encoder_Stream_Buffer::ESC, SLIP_Encoder_Stream_Buffer::ESC_ESC } ) )
+        .WillOnce( Return( ::picolibrary::Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.put( &*data.begin(), &*data.begin() + data.size() ).is_error() );
+    EXPECT_FALSE( buffer.put( SLIP_Encoder_Stream_Buffer::ESC ).is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::SLIP_Encoder_Stream_Buffer properly handles a downstream
+ *        buffer write error.
+ */
+TEST( slipEncoding, downstreamError )
+{
+    auto downstream = Mock_Stream_Buffer{};
+
+    auto buffer = SLIP_Encoder_Stream_Buffer{ downstream };
+
+    auto const error = Mock_Error{ 0x91 };
+
+    EXPECT_CALL( downstream, put( SafeMatcherCast<std::vector<std::uint8_t>>( _ ) ) ).WillOnce( Return( error ) );
+
+    auto const result = buffer.put( std::uint8_t{ 0x00 } );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief picolibrary::SLIP_Decoder decoding test fixture.
+ */
+class slipDecoding : public TestWithParam<Framing_Test_Case> {
+};
+
+/**
+ * \brief Verify picolibrary::SLIP_Decoder properly decodes a frame.
+ */
+TEST_P( slipDecoding, worksProperly )
+{
+    auto const test_case = GetParam();
+
+    auto buffer = Main_Buffer{};
+
+    auto decoder = SLIP_Decoder{ buffer };
+
+    EXPECT_FALSE( decoder.decode( SLIP_Encoder_Stream_Buffer::END ).value() );
+
+    for ( auto i = std::size_t{ 0 }; i < test_case.encoded.size(); ++i ) {
+        auto const result = decoder.decode( test_case.encoded[ i ] );
+
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), i + 1 == test_case.encoded.size() );
+    } // for
+
+    EXPECT_EQ( decoder.frame_size(), test_case.decoded.size() );
+    EXPECT_EQ( drain( buffer ), test_case.decoded );
+}
+
+INSTANTIATE_TEST_SUITE_P( testCases, slipDecoding, ValuesIn( SLIP_TEST_CASES ) );
+
+/**
+ * \brief Verify picolibrary::SLIP_Decoder properly handles an invalid escape sequence.
+ */
+TEST( slipDecoding, invalidEscapeSequence )
+{
+    auto buffer = Main_Buffer{};
+
+    auto decoder = SLIP_Decoder{ buffer };
+
+    EXPECT_FALSE( decoder.decode( 0x48 ).is_error() );
+    EXPECT_FALSE( decoder.decode( SLIP_Encoder_Stream_Buffer::ESC ).is_error() );
+
+    auto const result = decoder.decode( 0x48 );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+    EXPECT_EQ( decoder.frame_size(), 1 );
+
+    EXPECT_FALSE( decoder.decode( 0x52 ).value() );
+    EXPECT_FALSE( decoder.decode( SLIP_Encoder_Stream_Buffer::END ).value() );
+    EXPECT_FALSE( decoder.decode( 0x52 ).value() );
+    EXPECT_TRUE( decoder.decode( SLIP_Encoder_Stream_Buffer::END ).value() );
+
+    EXPECT_EQ( drain( buffer ), ( std::vector<std::uint8_t>{ 0x48, 0x52 } ) );
+}
+
+/**
+ * \brief Verify picolibrary::Framed_Output_Stream works properly.
+ */
+TEST( framedOutputStream, worksProperly )
+{
+    auto downstream = Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto stream = Framed_Output_Stream<COBS_Encoder_Stream_Buffer>{ downstream };
+
+    EXPECT_FALSE( stream.put( "a" ).is_error() );
+    EXPECT_FALSE( stream.put( std::uint8_t{ 0x00 } ).is_error() );
+    EXPECT_FALSE( stream.put( "b" ).is_error() );
+    EXPECT_FALSE( stream.flush().is_error() );
+
+    EXPECT_EQ( downstream.vector(), ( std::vector<std::uint8_t>{ 0x02, 'a', 0x02, 'b', 0x00 } ) );
+}
+
+/**
+ * \brief Verify picolibrary::Framed_Output_Stream works properly with a reliable
+ *        downstream buffer.
+ */
+TEST( framedOutputStream, reliableDownstream )
+{
+    auto downstream = Reliable_Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto stream = Framed_Output_Stream<Reliable_SLIP_Encoder_Stream_Buffer>{ downstream };
+
+    EXPECT_FALSE( stream.put( "a" ).is_error() );
+    EXPECT_FALSE( stream.put( std::uint8_t{ 0xC0 } ).is_error() );
+    EXPECT_FALSE( stream.flush().is_error() );
+
+    EXPECT_EQ( downstream.vector(), ( std::vector<std::uint8_t>{ 'a', 0xDB, 0xDC, 0xC0 } ) );
+}
+
+/**
+ * \brief Execute the picolibrary framing automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
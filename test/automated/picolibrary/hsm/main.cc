@@ -20,8 +20,10 @@
  * \brief picolibrary::HSM automated test program.
  */
 
+#include <cstddef>
 #include <ostream>
 #include <sstream>
+#include <string>
 
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -55,6 +57,12 @@ class Test_HSM : public HSM {
     {
     }
 
+    constexpr Test_HSM( std::ostream & stream, Hierarchy_Cache & hierarchy_cache ) noexcept :
+        HSM{ initial_pseudostate, hierarchy_cache },
+        m_stream{ stream }
+    {
+    }
+
     Test_HSM( Test_HSM && ) = delete;
 
     Test_HSM( Test_HSM const & ) = delete;
@@ -72,6 +80,17 @@ class Test_HSM : public HSM {
 
     using HSM::dispatch;
 
+    void prime_hierarchy_cache() noexcept
+    {
+        HSM::prime_hierarchy_cache( s11 );
+        HSM::prime_hierarchy_cache( s211 );
+    }
+
+    auto discoveries() const noexcept -> std::size_t
+    {
+        return m_discoveries;
+    }
+
   private:
     enum class Event : Event_ID {
         TOPMOST_INITIAL_TRANSITION_TRIGGER,
@@ -142,6 +161,8 @@ class Test_HSM : public HSM {
 
     bool m_foo{};
 
+    std::size_t m_discoveries{};
+
     static auto initial_pseudostate( HSM & hsm, ::picolibrary::Event const & event ) noexcept -> Event_Handling_Result
     {
         auto & test_hsm = static_cast<Test_HSM &>( hsm );
@@ -168,6 +189,9 @@ class Test_HSM : public HSM {
                 case Pseudo_Event::NESTED_INITIAL_TRANSITION:
                     test_hsm.m_stream << "s-INIT;";
                     return test_hsm.transition_to( s11, event );
+                case Pseudo_Event::DISCOVERY:
+                    ++test_hsm.m_discoveries;
+                    break;
                 default: break;
             } // switch
         }     // if
@@ -206,6 +230,9 @@ class Test_HSM : public HSM {
                 case Pseudo_Event::NESTED_INITIAL_TRANSITION:
                     test_hsm.m_stream << "s1-INIT;";
                     return test_hsm.transition_to( s11, event );
+                case Pseudo_Event::DISCOVERY:
+                    ++test_hsm.m_discoveries;
+                    break;
                 default: break;
             } // switch
         }     // if
@@ -253,6 +280,9 @@ class Test_HSM : public HSM {
                 case Pseudo_Event::EXIT:
                     test_hsm.m_stream << "s11-EXIT;";
                     return test_hsm.event_handled( event );
+                case Pseudo_Event::DISCOVERY:
+                    ++test_hsm.m_discoveries;
+                    break;
                 default: break;
             } // switch
         }     // if
@@ -294,6 +324,9 @@ class Test_HSM : public HSM {
                 case Pseudo_Event::NESTED_INITIAL_TRANSITION:
                     test_hsm.m_stream << "s2-INIT;";
                     return test_hsm.transition_to( s211, event );
+                case Pseudo_Event::DISCOVERY:
+                    ++test_hsm.m_discoveries;
+                    break;
                 default: break;
             } // switch
         }     // if
@@ -335,6 +368,9 @@ class Test_HSM : public HSM {
                 case Pseudo_Event::NESTED_INITIAL_TRANSITION:
                     test_hsm.m_stream << "s21-INIT;";
                     return test_hsm.transition_to( s211, event );
+                case Pseudo_Event::DISCOVERY:
+                    ++test_hsm.m_discoveries;
+                    break;
                 default: break;
             } // switch
         }     // if
@@ -369,6 +405,9 @@ class Test_HSM : public HSM {
                 case Pseudo_Event::EXIT:
                     test_hsm.m_stream << "s211-EXIT;";
                     return test_hsm.event_handled( event );
+                case Pseudo_Event::DISCOVERY:
+                    ++test_hsm.m_discoveries;
+                    break;
                 default: break;
             } // switch
         }     // if
@@ -406,6 +445,62 @@ Simple_Event const Test_HSM::G{ Event_Category::instance(), to_underlying( Event
 Simple_Event const Test_HSM::H{ Event_Category::instance(), to_underlying( Event::H ) };
 Simple_Event const Test_HSM::I{ Event_Category::instance(), to_underlying( Event::I ) };
 
+/**
+ * \brief Test event sequence.
+ */
+Simple_Event const EVENT_SEQUENCE[]{
+    // clang-format off
+
+    Test_HSM::G,
+    Test_HSM::I,
+    Test_HSM::A,
+    Test_HSM::D,
+    Test_HSM::D,
+    Test_HSM::C,
+    Test_HSM::E,
+    Test_HSM::E,
+    Test_HSM::G,
+    Test_HSM::I,
+    Test_HSM::I,
+
+    // clang-format on
+};
+
+/**
+ * \brief Expected test event sequence output.
+ */
+auto const EXPECTED_OUTPUT = std::string{
+    "top-INIT;s-ENTRY;s2-ENTRY;s2-INIT;s21-ENTRY;s211-ENTRY;\n"
+    "s21-G;s211-EXIT;s21-EXIT;s2-EXIT;s1-ENTRY;s11-ENTRY;\n"
+    "s1-I;\n"
+    "s1-A;s11-EXIT;s1-EXIT;s1-ENTRY;s1-INIT;s11-ENTRY;\n"
+    "s1-D;s11-EXIT;s1-EXIT;s-INIT;s1-ENTRY;s11-ENTRY;\n"
+    "s11-D;s11-EXIT;s1-INIT;s11-ENTRY;\n"
+    "s1-C;s11-EXIT;s1-EXIT;s2-ENTRY;s2-INIT;s21-ENTRY;s211-ENTRY;\n"
+    "s-E;s211-EXIT;s21-EXIT;s2-EXIT;s1-ENTRY;s11-ENTRY;\n"
+    "s-E;s11-EXIT;s1-EXIT;s1-ENTRY;s11-ENTRY;\n"
+    "s11-G;s11-EXIT;s1-EXIT;s2-ENTRY;s21-ENTRY;s211-ENTRY;\n"
+    "s2-I;\n"
+    "s-I;\n"
+};
+
+/**
+ * \brief Run the test event sequence.
+ *
+ * \param[in] test_hsm The HSM to run the test event sequence on.
+ * \param[in] stream The HSM's output stream.
+ */
+void run_event_sequence( Test_HSM & test_hsm, std::ostream & stream )
+{
+    test_hsm.execute_topmost_initial_transition();
+    stream << '\n';
+
+    for ( auto const & event : EVENT_SEQUENCE ) {
+        test_hsm.dispatch( event );
+        stream << '\n';
+    } // for
+}
+
 } // namespace
 
 /**
@@ -459,6 +554,74 @@ TEST( hsm, worksProperly )
         "s-I;\n" );
 }
 
+/**
+ * \brief Verify picolibrary::HSM works properly when a state hierarchy cache is used, and
+ *        that each state is only discovered once.
+ */
+TEST( hsm, worksProperlyHierarchyCache )
+{
+    auto stream          = std::ostringstream{};
+    auto hierarchy_cache = HSM::Fixed_Capacity_Hierarchy_Cache<8>{};
+
+    auto test_hsm = Test_HSM{ stream, hierarchy_cache };
+
+    run_event_sequence( test_hsm, stream );
+
+    EXPECT_EQ( stream.str(), EXPECTED_OUTPUT );
+    EXPECT_EQ( test_hsm.discoveries(), 6 );
+    EXPECT_EQ( hierarchy_cache.size(), 6 );
+    EXPECT_EQ( hierarchy_cache.capacity(), 8 );
+}
+
+/**
+ * \brief Verify picolibrary::HSM::prime_hierarchy_cache() moves all state hierarchy
+ *        discovery out of event dispatch.
+ */
+TEST( hsm, primedHierarchyCache )
+{
+    auto stream          = std::ostringstream{};
+    auto hierarchy_cache = HSM::Fixed_Capacity_Hierarchy_Cache<6>{};
+
+    auto test_hsm = Test_HSM{ stream, hierarchy_cache };
+
+    test_hsm.prime_hierarchy_cache();
+
+    EXPECT_EQ( test_hsm.discoveries(), 6 );
+    EXPECT_EQ( hierarchy_cache.size(), 6 );
+
+    run_event_sequence( test_hsm, stream );
+
+    EXPECT_EQ( stream.str(), EXPECTED_OUTPUT );
+    EXPECT_EQ( test_hsm.discoveries(), 6 );
+}
+
+/**
+ * \brief Verify picolibrary::HSM works properly when the state hierarchy cache is smaller
+ *        than the number of states, and falls back to regular discovery for the states
+ *        that do not fit in the cache.
+ */
+TEST( hsm, undersizedHierarchyCache )
+{
+    auto uncached_stream = std::ostringstream{};
+
+    auto uncached_test_hsm = Test_HSM{ uncached_stream };
+
+    run_event_sequence( uncached_test_hsm, uncached_stream );
+
+    auto stream          = std::ostringstream{};
+    auto hierarchy_cache = HSM::Fixed_Capacity_Hierarchy_Cache<2>{};
+
+    auto test_hsm = Test_HSM{ stream, hierarchy_cache };
+
+    run_event_sequence( test_hsm, stream );
+
+    EXPECT_EQ( stream.str(), EXPECTED_OUTPUT );
+    EXPECT_EQ( hierarchy_cache.size(), 2 );
+    EXPECT_EQ( hierarchy_cache.capacity(), 2 );
+    EXPECT_GT( test_hsm.discoveries(), 6 );
+    EXPECT_LT( test_hsm.discoveries(), uncached_test_hsm.discoveries() );
+}
+
 /**
  * \brief Execute the picolibrary::HSM automated tests.
  *
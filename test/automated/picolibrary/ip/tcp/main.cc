@@ -0,0 +1,381 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::IP::TCP automated test program.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/error.h"
+#include "picolibrary/ip/tcp.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/testing/automated/error.h"
+
+namespace {
+
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Result;
+using ::picolibrary::Stream_Segment;
+using ::picolibrary::IP::TCP::has_maximum_segment_size_v;
+using ::picolibrary::IP::TCP::Socket_Input_Buffer;
+using ::picolibrary::IP::TCP::Socket_Output_Stream;
+using ::picolibrary::IP::TCP::Socket_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::Return;
+
+/**
+ * \brief Mock socket.
+ */
+class Mock_Socket {
+  public:
+    MOCK_METHOD( (Result<std::size_t>), transmit, (std::vector<std::uint8_t>));
+
+    auto transmit( std::uint8_t const * begin, std::uint8_t const * end )
+        -> Result<std::uint8_t const *>
+    {
+        auto const result = transmit( std::vector<std::uint8_t>{ begin, end } );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return begin + result.value();
+    }
+
+    MOCK_METHOD( (Result<std::vector<std::uint8_t>>), receive, (std::size_t));
+
+    auto receive( std::uint8_t * begin, std::uint8_t * end ) -> Result<std::uint8_t *>
+    {
+        auto const result = receive( static_cast<std::size_t>( end - begin ) );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        for ( auto const data : result.value() ) {
+            *begin = data;
+
+            ++begin;
+        } // for
+
+        return begin;
+    }
+};
+
+/**
+ * \brief Mock socket that reports its maximum segment size.
+ */
+class Mock_Segmented_Socket : public Mock_Socket {
+  public:
+    MOCK_METHOD( std::uint16_t, maximum_segment_size, (), ( const ) );
+};
+
+static_assert( not has_maximum_segment_size_v<Mock_Socket> );
+static_assert( has_maximum_segment_size_v<Mock_Segmented_Socket> );
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::IP::TCP::Socket_Stream_Buffer coalesces writes into
+ *        segments of N bytes if the socket does not report its maximum segment size.
+ */
+TEST( socketStreamBufferCoalescing, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto socket = Mock_Socket{};
+
+    auto buffer = Socket_Stream_Buffer<Mock_Socket, 4>{ socket };
+
+    auto const uint8s = std::vector<std::uint8_t>{ 0x9C, 0x31, 0xE7, 0x05, 0x4A, 0xD2 };
+
+    EXPECT_EQ( buffer.segment_size(), 4 );
+
+    EXPECT_FALSE( buffer.put( 'q' ).is_error() );
+    EXPECT_FALSE( buffer.put( std::int8_t{ -0x19 } ).is_error() );
+    EXPECT_EQ( buffer.pending(), 2 );
+
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 'q', 0xE7, 0x9C, 0x31 } ) )
+        .WillOnce( Return( std::size_t{ 4 } ) );
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 0xE7, 0x05, 0x4A, 0xD2 } ) )
+        .WillOnce( Return( std::size_t{ 4 } ) );
+
+    EXPECT_FALSE( buffer.put( &*uint8s.begin(), &*uint8s.end() ).is_error() );
+    EXPECT_EQ( buffer.pending(), 0 );
+
+    EXPECT_FALSE( buffer.put( "Zn" ).is_error() );
+    EXPECT_EQ( buffer.pending(), 2 );
+
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 'Z', 'n' } ) ).WillOnce( Return( std::size_t{ 2 } ) );
+
+    EXPECT_FALSE( buffer.flush().is_error() );
+    EXPECT_EQ( buffer.pending(), 0 );
+
+    EXPECT_FALSE( buffer.flush().is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::IP::TCP::Socket_Stream_Buffer coalesces writes into
+ *        segments of the socket's maximum segment size if it is smaller than N.
+ */
+TEST( socketStreamBufferCoalescing, maximumSegmentSize )
+{
+    auto const in_sequence = InSequence{};
+
+    auto socket = Mock_Segmented_Socket{};
+
+    auto buffer = Socket_Stream_Buffer<Mock_Segmented_Socket, 8>{ socket };
+
+    auto const uint8s = std::vector<std::uint8_t>{ 0x6B, 0xF0, 0x27, 0x8E, 0x13 };
+
+    EXPECT_CALL( socket, maximum_segment_size() ).Times( 1 ).WillOnce( Return( 3 ) );
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 0x6B, 0xF0, 0x27 } ) )
+        .WillOnce( Return( std::size_t{ 3 } ) );
+
+    EXPECT_FALSE( buffer.put( &*uint8s.begin(), &*uint8s.end() ).is_error() );
+    EXPECT_EQ( buffer.pending(), 2 );
+    EXPECT_EQ( buffer.segment_size(), 3 );
+
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 0x8E, 0x13, 'k' } ) )
+        .WillOnce( Return( std::size_t{ 3 } ) );
+
+    EXPECT_FALSE( buffer.put( 'k' ).is_error() );
+    EXPECT_EQ( buffer.pending(), 0 );
+
+    EXPECT_FALSE( buffer.put( 'w' ).is_error() );
+    EXPECT_EQ( buffer.pending(), 1 );
+
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 'w' } ) ).WillOnce( Return( std::size_t{ 1 } ) );
+
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_CALL( socket, maximum_segment_size() ).Times( 1 ).WillOnce( Return( 0 ) );
+
+    EXPECT_EQ( buffer.segment_size(), 8 );
+
+    EXPECT_CALL( socket, maximum_segment_size() ).Times( 1 ).WillOnce( Return( 1460 ) );
+
+    EXPECT_FALSE( buffer.put( 'v' ).is_error() );
+    EXPECT_EQ( buffer.segment_size(), 8 );
+}
+
+/**
+ * \brief Verify picolibrary::IP::TCP::Socket_Stream_Buffer coalesces gathered segments in
+ *        a single pass.
+ */
+TEST( socketStreamBufferCoalescing, gather )
+{
+    auto const in_sequence = InSequence{};
+
+    auto socket = Mock_Segmented_Socket{};
+
+    auto buffer = Socket_Stream_Buffer<Mock_Segmented_Socket, 8>{ socket };
+
+    auto const header   = std::vector<std::uint8_t>{ 0xA1, 0x5F };
+    auto const payload  = std::vector<std::uint8_t>{ 0x07, 0xC8, 0x3D };
+    auto const crc      = std::vector<std::uint8_t>{ 0xE2 };
+    auto const segments = std::vector<Stream_Segment>{ { &*header.begin(), &*header.end() },
+                                                       { &*payload.begin(), &*payload.end() },
+                                                       { &*crc.begin(), &*crc.end() } };
+
+    EXPECT_CALL( socket, maximum_segment_size() ).Times( 1 ).WillOnce( Return( 4 ) );
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 0xA1, 0x5F, 0x07, 0xC8 } ) )
+        .WillOnce( Return( std::size_t{ 4 } ) );
+
+    EXPECT_FALSE( buffer.put( &*segments.begin(), &*segments.end() ).is_error() );
+    EXPECT_EQ( buffer.pending(), 2 );
+}
+
+/**
+ * \brief Verify picolibrary::IP::TCP::Socket_Stream_Buffer retries partial and would
+ *        block socket transmit buffer writes.
+ */
+TEST( socketStreamBufferTransmit, partialAndWouldBlock )
+{
+    auto const in_sequence = InSequence{};
+
+    auto socket = Mock_Socket{};
+
+    auto buffer = Socket_Stream_Buffer<Mock_Socket, 16>{ socket };
+
+    auto const uint8s = std::vector<std::uint8_t>{ 0x58, 0xC3, 0x0A, 0x91 };
+
+    EXPECT_FALSE( buffer.put( &*uint8s.begin(), &*uint8s.end() ).is_error() );
+
+    EXPECT_CALL( socket, transmit( uint8s ) ).WillOnce( Return( Generic_Error::WOULD_BLOCK ) );
+    EXPECT_CALL( socket, transmit( uint8s ) ).WillOnce( Return( std::size_t{ 1 } ) );
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 0xC3, 0x0A, 0x91 } ) )
+        .WillOnce( Return( std::size_t{ 3 } ) );
+
+    EXPECT_FALSE( buffer.flush().is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::IP::TCP::Socket_Stream_Buffer properly handles a socket
+ *        transmit buffer write error.
+ */
+TEST( socketStreamBufferTransmit, error )
+{
+    auto socket = Mock_Socket{};
+
+    auto buffer = Socket_Stream_Buffer<Mock_Socket, 16>{ socket };
+
+    EXPECT_FALSE( buffer.put( "vR4" ).is_error() );
+
+    auto const error = Mock_Error{ 0x2D };
+
+    EXPECT_CALL( socket, transmit( _ ) ).WillOnce( Return( error ) );
+
+    auto const result = buffer.flush();
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+    EXPECT_EQ( buffer.pending(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::IP::TCP::Socket_Output_Stream works properly.
+ */
+TEST( socketOutputStream, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto socket = Mock_Socket{};
+
+    auto stream = Socket_Output_Stream<Mock_Socket, 16>{ socket };
+
+    EXPECT_FALSE( stream.put( "ping" ).is_error() );
+    EXPECT_EQ( stream.pending(), 4 );
+
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 'p', 'i', 'n', 'g' } ) )
+        .WillOnce( Return( std::size_t{ 4 } ) );
+
+    EXPECT_FALSE( stream.flush().is_error() );
+    EXPECT_TRUE( stream.is_nominal() );
+
+    EXPECT_FALSE( stream.put( '!' ).is_error() );
+
+    EXPECT_CALL( socket, transmit( _ ) ).WillOnce( Return( Generic_Error::NOT_CONNECTED ) );
+
+    EXPECT_TRUE( stream.flush().is_error() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::IP::TCP::Socket_Input_Buffer reads the socket's receive
+ *        buffer in chunks.
+ */
+TEST( socketInputBuffer, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto socket = Mock_Socket{};
+
+    auto buffer = Socket_Input_Buffer<Mock_Socket, 4>{ socket };
+
+    EXPECT_CALL( socket, receive( 4 ) )
+        .WillOnce( Return( std::vector<std::uint8_t>{ 0x3E, 0xA7, 0x52 } ) );
+
+    auto value = std::uint8_t{};
+
+    EXPECT_FALSE( buffer.get( value ).is_error() );
+    EXPECT_EQ( value, 0x3E );
+    EXPECT_EQ( buffer.buffered(), 2 );
+
+    auto data = std::vector<std::uint8_t>( 3 );
+
+    {
+        auto const result = buffer.get( &*data.begin(), &*data.end() );
+
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), &data[ 2 ] );
+        EXPECT_EQ( data[ 0 ], 0xA7 );
+        EXPECT_EQ( data[ 1 ], 0x52 );
+        EXPECT_EQ( buffer.buffered(), 0 );
+    }
+
+    data = std::vector<std::uint8_t>( 6 );
+
+    EXPECT_CALL( socket, receive( 6 ) )
+        .WillOnce( Return( std::vector<std::uint8_t>{ 0xC1, 0x08, 0x7F, 0x64, 0x9D } ) );
+
+    {
+        auto const result = buffer.get( &*data.begin(), &*data.end() );
+
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), &data[ 5 ] );
+        EXPECT_EQ( data, ( std::vector<std::uint8_t>{ 0xC1, 0x08, 0x7F, 0x64, 0x9D, 0x00 } ) );
+        EXPECT_EQ( buffer.buffered(), 0 );
+    }
+}
+
+/**
+ * \brief Verify picolibrary::IP::TCP::Socket_Input_Buffer properly handles a socket
+ *        receive buffer read error.
+ */
+TEST( socketInputBuffer, error )
+{
+    auto const in_sequence = InSequence{};
+
+    auto socket = Mock_Socket{};
+
+    auto buffer = Socket_Input_Buffer<Mock_Socket, 4>{ socket };
+
+    auto value = std::uint8_t{};
+
+    auto const error = Mock_Error{ 0x71 };
+
+    EXPECT_CALL( socket, receive( 4 ) ).WillOnce( Return( error ) );
+
+    {
+        auto const result = buffer.get( value );
+
+        ASSERT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), error );
+    }
+
+    EXPECT_CALL( socket, receive( 4 ) ).WillOnce( Return( std::vector<std::uint8_t>{} ) );
+
+    {
+        auto const result = buffer.get( value );
+
+        ASSERT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), Generic_Error::WOULD_BLOCK );
+    }
+}
+
+/**
+ * \brief Execute the picolibrary::IP::TCP automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
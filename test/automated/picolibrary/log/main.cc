@@ -0,0 +1,539 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Log automated test program.
+ */
+
+// log level names are commonly defined as macros (e.g. DEBUG in embedded builds), verify
+// that they do not interfere with logging
+#define DEBUG 1
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/format.h"
+#include "picolibrary/log.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+// ERROR is defined by <windows.h>, verify that it does not interfere with log statements
+#define ERROR 0
+
+namespace {
+
+using ::picolibrary::Log::Argument_Type;
+using ::picolibrary::Log::argument_type;
+using ::picolibrary::Log::Decoder;
+using ::picolibrary::Log::Deferred_Log;
+using ::picolibrary::Log::format_string_id;
+using ::picolibrary::Log::is_enabled;
+using ::picolibrary::Log::Level;
+using ::picolibrary::Log::module_level;
+using ::picolibrary::Log::parse_level;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Output_Stream;
+using ::picolibrary::Testing::Automated::Output_String_Stream;
+using ::picolibrary::Testing::Automated::Reliable_Output_String_Stream;
+using ::testing::A;
+using ::testing::Return;
+
+/**
+ * \brief The format strings used by the automated tests.
+ */
+char const * const DICTIONARY[]{
+    "boot",
+    "temp={} rh={:d} status={:x} flags={:b} mode={} grade={}",
+    "id={:x} count={}",
+    "{{{}}}",
+};
+
+/**
+ * \brief Convert a string to a vector of bytes.
+ *
+ * \param[in] string The string to convert.
+ *
+ * \return The vector of bytes.
+ */
+auto bytes( std::string const & string ) -> std::vector<std::uint8_t>
+{
+    return { string.begin(), string.end() };
+}
+
+/**
+ * \brief Decode records.
+ *
+ * \param[in] records The records to decode.
+ *
+ * \return The decoded records.
+ */
+auto decode( std::vector<std::uint8_t> const & records ) -> std::string
+{
+    auto stream = Output_String_Stream{};
+
+    auto const result = Decoder{ std::begin( DICTIONARY ), std::end( DICTIONARY ) }.decode(
+        stream, &*records.begin(), &*records.end() );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), &*records.end() );
+
+    return stream.string();
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Log::format_string_id() works properly.
+ */
+TEST( formatStringID, worksProperly )
+{
+    static_assert( format_string_id( "" ) == 0x811C'9DC5 );
+    static_assert( format_string_id( "a" ) == 0xE40C'292C );
+    static_assert( format_string_id( "foobar" ) == 0xBF9C'F968 );
+}
+
+/**
+ * \brief Verify picolibrary::Log::argument_type() works properly.
+ */
+TEST( argumentType, worksProperly )
+{
+    static_assert( argument_type<char>() == Argument_Type::CHAR );
+    static_assert( argument_type<std::uint8_t>() == Argument_Type::UINT8 );
+    static_assert( argument_type<std::int8_t>() == Argument_Type::INT8 );
+    static_assert( argument_type<std::uint16_t>() == Argument_Type::UINT16 );
+    static_assert( argument_type<std::int16_t>() == Argument_Type::INT16 );
+    static_assert( argument_type<std::uint32_t>() == Argument_Type::UINT32 );
+    static_assert( argument_type<std::int32_t>() == Argument_Type::INT32 );
+    static_assert( argument_type<std::uint64_t>() == Argument_Type::UINT64 );
+    static_assert( argument_type<std::int64_t>() == Argument_Type::INT64 );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Deferred_Log::write() properly encodes records.
+ */
+TEST( deferredLogWrite, encodesRecords )
+{
+    auto log = Deferred_Log<std::uint8_t, 32>{};
+
+    EXPECT_TRUE( log.empty() );
+
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "boot" ) ) );
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "id={:x} count={}", std::uint16_t{ 0x3A9C }, 'Z' ) ) );
+
+    EXPECT_FALSE( log.empty() );
+
+    auto stream = Output_String_Stream{};
+
+    EXPECT_FALSE( log.drain( stream ).is_error() );
+
+    EXPECT_TRUE( log.empty() );
+    EXPECT_TRUE( stream.is_nominal() );
+
+    constexpr auto boot = format_string_id( "boot" );
+    constexpr auto id   = format_string_id( "id={:x} count={}" );
+
+    EXPECT_EQ(
+        bytes( stream.string() ),
+        ( std::vector<std::uint8_t>{
+            // clang-format off
+
+            4,
+            static_cast<std::uint8_t>( boot ),
+            static_cast<std::uint8_t>( boot >> 8 ),
+            static_cast<std::uint8_t>( boot >> 16 ),
+            static_cast<std::uint8_t>( boot >> 24 ),
+
+            9,
+            static_cast<std::uint8_t>( id ),
+            static_cast<std::uint8_t>( id >> 8 ),
+            static_cast<std::uint8_t>( id >> 16 ),
+            static_cast<std::uint8_t>( id >> 24 ),
+            static_cast<std::uint8_t>( Argument_Type::UINT16 ), 0x9C, 0x3A,
+            static_cast<std::uint8_t>( Argument_Type::CHAR ), 'Z',
+
+            // clang-format on
+        } ) );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Deferred_Log::write() properly handles a full deferred
+ *        log.
+ */
+TEST( deferredLogWrite, full )
+{
+    auto log = Deferred_Log<std::uint8_t, 16>{};
+
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "id={:x} count={}", std::uint16_t{ 0x0001 }, 'a' ) ) );
+    EXPECT_FALSE( log.write( PICOLIBRARY_FORMAT( "id={:x} count={}", std::uint16_t{ 0x0002 }, 'b' ) ) );
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "boot" ) ) );
+    EXPECT_FALSE( log.write( PICOLIBRARY_FORMAT( "boot" ) ) );
+
+    EXPECT_EQ( log.dropped(), 2 );
+
+    auto stream = Output_String_Stream{};
+
+    EXPECT_FALSE( log.drain( stream ).is_error() );
+
+    EXPECT_TRUE( log.empty() );
+    EXPECT_EQ( log.dropped(), 0 );
+
+    EXPECT_EQ( decode( bytes( stream.string() ) ), "id=0x0001 count=a\nboot\n<2 deferred log records dropped>\n" );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Deferred_Log::drain( picolibrary::Output_Stream & )
+ *        properly handles a put error.
+ */
+TEST( deferredLogDrainErrorHandling, putError )
+{
+    auto log = Deferred_Log<std::uint8_t, 16>{};
+
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "boot" ) ) );
+
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = Mock_Error{ 93 };
+
+    EXPECT_CALL( stream.buffer(), put( A<std::vector<std::uint8_t>>() ) ).WillOnce( Return( error ) );
+
+    auto const result = log.drain( stream );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Deferred_Log::drain( picolibrary::Reliable_Output_Stream
+ *        & ) works properly.
+ */
+TEST( deferredLogDrainReliable, worksProperly )
+{
+    auto log = Deferred_Log<std::uint16_t, 64>{};
+
+    for ( auto i = 0; i < 8; ++i ) {
+        EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "{{{}}}", static_cast<std::int8_t>( -i ) ) ) );
+    } // for
+
+    auto stream = Reliable_Output_String_Stream{};
+
+    log.drain( stream );
+
+    EXPECT_TRUE( log.empty() );
+    EXPECT_TRUE( stream.is_nominal() );
+
+    EXPECT_EQ( decode( bytes( stream.string() ) ), "{0}\n{-1}\n{-2}\n{-3}\n{-4}\n{-5}\n{-6}\n{-7}\n" );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Decoder::decode() works properly.
+ */
+TEST( decoderDecode, worksProperly )
+{
+    auto log = Deferred_Log<std::uint8_t, 64>{};
+
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT(
+        "temp={} rh={:d} status={:x} flags={:b} mode={} grade={}",
+        std::int16_t{ -417 },
+        std::uint32_t{ 4'000'000'000 },
+        std::uint16_t{ 0x3A9C },
+        std::uint8_t{ 0b1001'0110 },
+        'R',
+        std::int64_t{ -9'000'000'000 } ) ) );
+
+    auto stream = Output_String_Stream{};
+
+    EXPECT_FALSE( log.drain( stream ).is_error() );
+
+    EXPECT_EQ(
+        decode( bytes( stream.string() ) ),
+        "temp=-417 rh=4000000000 status=0x3A9C flags=0b10010110 mode=R "
+        "grade=-9000000000\n" );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Decoder::decode() properly handles an incomplete
+ *        record.
+ */
+TEST( decoderDecode, incompleteRecord )
+{
+    auto log = Deferred_Log<std::uint8_t, 32>{};
+
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "boot" ) ) );
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "id={:x} count={}", std::uint16_t{ 0x0C3B }, '7' ) ) );
+
+    auto drained = Output_String_Stream{};
+
+    EXPECT_FALSE( log.drain( drained ).is_error() );
+
+    auto const records = bytes( drained.string() );
+
+    auto const decoder = Decoder{ std::begin( DICTIONARY ), std::end( DICTIONARY ) };
+
+    auto stream = Output_String_Stream{};
+
+    auto const result = decoder.decode( stream, &*records.begin(), &*records.end() - 1 );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), &*records.begin() + 5 );
+
+    EXPECT_EQ( stream.string(), "boot\n" );
+
+    EXPECT_EQ( decoder.decode( stream, result.value(), &*records.end() ).value(), &*records.end() );
+
+    EXPECT_EQ( stream.string(), "boot\nid=0x0C3B count=7\n" );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Decoder::decode() properly handles a record whose
+ *        format string is not in the dictionary.
+ */
+TEST( decoderDecode, unknownFormatString )
+{
+    auto log = Deferred_Log<std::uint8_t, 32>{};
+
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "not in dictionary" ) ) );
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "boot" ) ) );
+
+    auto stream = Output_String_Stream{};
+
+    EXPECT_FALSE( log.drain( stream ).is_error() );
+
+    auto expected = Output_String_Stream{};
+
+    EXPECT_FALSE( expected
+                      .print(
+                          "<unknown deferred log format string ID ",
+                          ::picolibrary::Format::Hex{ format_string_id( "not in dictionary" ) },
+                          ">\nboot\n" )
+                      .is_error() );
+
+    EXPECT_EQ( decode( bytes( stream.string() ) ), expected.string() );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Decoder::decode() properly handles a record that does
+ *        not match its format string.
+ */
+TEST( decoderDecode, malformedRecord )
+{
+    constexpr auto id = format_string_id( "id={:x} count={}" );
+
+    auto const records = std::vector<std::uint8_t>{
+        // clang-format off
+
+        3, 0x00, 0x00, 0x00,
+
+        7,
+        static_cast<std::uint8_t>( id ),
+        static_cast<std::uint8_t>( id >> 8 ),
+        static_cast<std::uint8_t>( id >> 16 ),
+        static_cast<std::uint8_t>( id >> 24 ),
+        static_cast<std::uint8_t>( Argument_Type::UINT16 ), 0x9C, 0x3A,
+
+        10,
+        static_cast<std::uint8_t>( id ),
+        static_cast<std::uint8_t>( id >> 8 ),
+        static_cast<std::uint8_t>( id >> 16 ),
+        static_cast<std::uint8_t>( id >> 24 ),
+        static_cast<std::uint8_t>( Argument_Type::UINT16 ), 0x9C, 0x3A,
+        static_cast<std::uint8_t>( Argument_Type::CHAR ), 'Z',
+        0x00,
+
+        9,
+        static_cast<std::uint8_t>( id ),
+        static_cast<std::uint8_t>( id >> 8 ),
+        static_cast<std::uint8_t>( id >> 16 ),
+        static_cast<std::uint8_t>( id >> 24 ),
+        static_cast<std::uint8_t>( Argument_Type::UINT16 ), 0x9C, 0x3A,
+        0xFF, 'Z',
+
+        // clang-format on
+    };
+
+    EXPECT_EQ(
+        decode( records ),
+        "<malformed deferred log record>\n"
+        "<malformed deferred log record>\n"
+        "<malformed deferred log record>\n"
+        "<malformed deferred log record>\n" );
+}
+
+/**
+ * \brief Verify picolibrary::Log::Decoder::decode() properly handles a put error.
+ */
+TEST( decoderDecodeErrorHandling, putError )
+{
+    auto log = Deferred_Log<std::uint8_t, 16>{};
+
+    EXPECT_TRUE( log.write( PICOLIBRARY_FORMAT( "boot" ) ) );
+
+    auto drained = Output_String_Stream{};
+
+    EXPECT_FALSE( log.drain( drained ).is_error() );
+
+    auto const records = bytes( drained.string() );
+
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = Mock_Error{ 27 };
+
+    EXPECT_CALL( stream.buffer(), put( A<std::string>() ) ).WillOnce( Return( error ) );
+
+    auto const result = Decoder{ std::begin( DICTIONARY ), std::end( DICTIONARY ) }.decode(
+        stream, &*records.begin(), &*records.end() );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::Log::parse_level() works properly.
+ */
+TEST( parseLevel, worksProperly )
+{
+    struct {
+        char const * name;
+        bool         is_valid;
+        Level        level;
+    } const test_cases[]{
+        // clang-format off
+
+        { "OFF",   true,  Level::LEVEL_OFF   },
+        { "ERROR", true,  Level::LEVEL_ERROR },
+        { "WARN",  true,  Level::LEVEL_WARN  },
+        { "INFO",  true,  Level::LEVEL_INFO  },
+        { "DEBUG", true,  Level::LEVEL_DEBUG },
+        { "TRACE", true,  Level::LEVEL_TRACE },
+        { "",      false, Level::LEVEL_INFO  },
+        { "TRAC",  false, Level::LEVEL_INFO  },
+        { "TRACES", false, Level::LEVEL_INFO },
+        { "trace", false, Level::LEVEL_INFO  },
+
+        // clang-format on
+    };
+
+    for ( auto const test_case : test_cases ) {
+        auto const name = std::string{ test_case.name };
+
+        auto level = Level::LEVEL_INFO;
+
+        EXPECT_EQ( parse_level( &*name.begin(), &*name.end(), level ), test_case.is_valid );
+        EXPECT_EQ( level, test_case.level );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::Log::module_level() works properly.
+ */
+TEST( moduleLevel, worksProperly )
+{
+    static_assert( module_level( "", "spi", Level::LEVEL_WARN ) == Level::LEVEL_WARN );
+    static_assert( module_level( "spi=TRACE", "spi", Level::LEVEL_WARN ) == Level::LEVEL_TRACE );
+    static_assert( module_level( "spi=TRACE", "sp", Level::LEVEL_WARN ) == Level::LEVEL_WARN );
+    static_assert( module_level( "spi=TRACE", "spi2", Level::LEVEL_WARN ) == Level::LEVEL_WARN );
+    static_assert( module_level( "i2c=DEBUG,spi=OFF,uart=ERROR", "i2c", Level::LEVEL_WARN ) == Level::LEVEL_DEBUG );
+    static_assert( module_level( "i2c=DEBUG,spi=OFF,uart=ERROR", "spi", Level::LEVEL_WARN ) == Level::LEVEL_OFF );
+    static_assert( module_level( "i2c=DEBUG,spi=OFF,uart=ERROR", "uart", Level::LEVEL_WARN ) == Level::LEVEL_ERROR );
+    static_assert( module_level( "i2c=DEBUG,spi=OFF,uart=ERROR", "gpio", Level::LEVEL_WARN ) == Level::LEVEL_WARN );
+    static_assert( module_level( "spi,spi=bogus,spi=INFO", "spi", Level::LEVEL_WARN ) == Level::LEVEL_INFO );
+}
+
+/**
+ * \brief Verify the PICOLIBRARY_LOG_ERROR(), PICOLIBRARY_LOG_WARN(),
+ *        PICOLIBRARY_LOG_INFO(), PICOLIBRARY_LOG_DEBUG(), and PICOLIBRARY_LOG_TRACE()
+ *        macros work properly.
+ */
+TEST( logMacros, worksProperly )
+{
+    auto stream = Reliable_Output_String_Stream{};
+
+    auto evaluations = 0;
+
+    auto const evaluate = [ &evaluations ]( std::uint8_t value ) {
+        ++evaluations;
+
+        return value;
+    };
+
+    PICOLIBRARY_LOG_ERROR( "log", stream, "e={:d}", evaluate( 1 ) );
+    PICOLIBRARY_LOG_WARN( "log", stream, "w={:d}", evaluate( 2 ) );
+    PICOLIBRARY_LOG_INFO( "log", stream, "i={:d}", evaluate( 3 ) );
+    PICOLIBRARY_LOG_DEBUG( "log", stream, "d={:d}", evaluate( 4 ) );
+    PICOLIBRARY_LOG_TRACE( "log", stream, "t={:d}", evaluate( 5 ) );
+    PICOLIBRARY_LOG_INFO( "log", stream, "no values" );
+
+    auto expected_evaluations = 0;
+    auto expected_string      = std::string{};
+
+    struct {
+        Level        level;
+        char const * string;
+    } const test_cases[]{
+        { Level::LEVEL_ERROR, "[ERROR] e=1\n" }, { Level::LEVEL_WARN, "[WARN] w=2\n" },
+        { Level::LEVEL_INFO, "[INFO] i=3\n" },   { Level::LEVEL_DEBUG, "[DEBUG] d=4\n" },
+        { Level::LEVEL_TRACE, "[TRACE] t=5\n" },
+    };
+
+    for ( auto const test_case : test_cases ) {
+        if ( is_enabled( test_case.level, "log" ) ) {
+            ++expected_evaluations;
+            expected_string += test_case.string;
+        } // if
+    }     // for
+
+    if ( is_enabled( Level::LEVEL_INFO, "log" ) ) {
+        expected_string += "[INFO] no values\n";
+    } // if
+
+    EXPECT_EQ( evaluations, expected_evaluations );
+    EXPECT_EQ( stream.string(), expected_string );
+}
+
+/**
+ * \brief Verify the PICOLIBRARY_LOG_ERROR() macro works properly when writing to a
+ *        deferred log.
+ */
+TEST( logMacrosDeferredLog, worksProperly )
+{
+    auto log = Deferred_Log<std::uint8_t, 16>{};
+
+    PICOLIBRARY_LOG_ERROR( "log", log, "boot" );
+
+    EXPECT_EQ( log.empty(), not is_enabled( Level::LEVEL_ERROR, "log" ) );
+}
+
+/**
+ * \brief Execute the picolibrary::Log automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
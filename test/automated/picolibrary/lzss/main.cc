@@ -0,0 +1,247 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::LZSS automated test program.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/lzss.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::LZSS::Compressing_Output_Stream;
+using ::picolibrary::LZSS::Decoder_Stream_Buffer;
+using ::picolibrary::LZSS::Encoder_Stream_Buffer;
+using ::picolibrary::LZSS::Parameters;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Vector_Stream_Buffer;
+using ::testing::_;
+using ::testing::Return;
+using ::testing::SafeMatcherCast;
+
+static_assert( Parameters<8, 4>::WINDOW_SIZE == 256 );
+static_assert( Parameters<8, 4>::MATCH_LENGTH_MIN == 2 );
+static_assert( Parameters<8, 4>::MATCH_LENGTH_MAX == 16 );
+static_assert( Parameters<11, 4>::WINDOW_SIZE == 2048 );
+static_assert( Parameters<11, 4>::MATCH_LENGTH_MIN == 2 );
+
+/**
+ * \brief Generate a telemetry-like message sequence.
+ *
+ * \return The message sequence.
+ */
+auto telemetry() -> std::string
+{
+    auto string = std::string{};
+
+    for ( auto i = 0; i < 64; ++i ) {
+        string += "adc[" + std::to_string( i % 8 ) + "]=" + std::to_string( ( i * 37 ) % 1024 )
+                  + " status=OK\n";
+    } // for
+
+    return string;
+}
+
+/**
+ * \brief Generate a pseudorandom byte sequence.
+ *
+ * \param[in] size The size of the sequence.
+ *
+ * \return The pseudorandom byte sequence.
+ */
+auto noise( std::size_t size ) -> std::vector<std::uint8_t>
+{
+    auto bytes = std::vector<std::uint8_t>{};
+    auto state = std::uint32_t{ 0x1D872B41 };
+
+    for ( auto i = std::size_t{ 0 }; i < size; ++i ) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        bytes.push_back( static_cast<std::uint8_t>( state ) );
+    } // for
+
+    return bytes;
+}
+
+/**
+ * \brief Decompress compressed data.
+ *
+ * \tparam WINDOW_BITS The number of bits used to encode a back-reference's offset.
+ * \tparam LOOKAHEAD_BITS The number of bits used to encode a back-reference's length.
+ *
+ * \param[in] compressed The compressed data.
+ *
+ * \return The decompressed data.
+ */
+template<std::uint_fast8_t WINDOW_BITS, std::uint_fast8_t LOOKAHEAD_BITS>
+auto decompress( std::vector<std::uint8_t> const & compressed ) -> std::vector<std::uint8_t>
+{
+    auto downstream = Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto decoder = Decoder_Stream_Buffer<WINDOW_BITS, LOOKAHEAD_BITS>{ downstream };
+
+    for ( auto const data : compressed ) {
+        EXPECT_FALSE( decoder.put( data ).is_error() );
+    } // for
+
+    EXPECT_FALSE( decoder.flush().is_error() );
+
+    return downstream.vector();
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::LZSS::Encoder_Stream_Buffer produces the expected tokens.
+ */
+TEST( encoding, tokens )
+{
+    auto downstream = Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto encoder = Encoder_Stream_Buffer<8, 4>{ downstream };
+
+    EXPECT_FALSE( encoder.put( "aaaa" ).is_error() );
+    EXPECT_TRUE( downstream.vector().empty() );
+
+    EXPECT_FALSE( encoder.flush().is_error() );
+
+    // literal 'a', back-reference (offset 1, length 3), sync token, padding
+    EXPECT_EQ( downstream.vector(), ( std::vector<std::uint8_t>{ 0xB0, 0x80, 0x04, 0x01, 0xE0 } ) );
+
+    EXPECT_FALSE( encoder.flush().is_error() );
+    EXPECT_EQ( downstream.vector().size(), 5 );
+}
+
+/**
+ * \brief Verify telemetry survives a compression round trip and is compressed.
+ */
+TEST( roundTrip, telemetry )
+{
+    auto const string = telemetry();
+
+    auto downstream = Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto encoder = Encoder_Stream_Buffer<10, 4>{ downstream };
+
+    EXPECT_FALSE( encoder.put( string.c_str() ).is_error() );
+    EXPECT_FALSE( encoder.flush().is_error() );
+
+    EXPECT_LT( downstream.vector().size(), string.size() / 2 );
+
+    EXPECT_EQ( ( decompress<10, 4>( downstream.vector() ) ), ( std::vector<std::uint8_t>{ string.begin(), string.end() } ) );
+}
+
+/**
+ * \brief Verify incompressible data survives a compression round trip across multiple
+ *        flushes and window wrap-arounds.
+ */
+TEST( roundTrip, flushes )
+{
+    auto const bytes = noise( 1500 );
+
+    auto downstream = Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto encoder = Encoder_Stream_Buffer<8, 3>{ downstream };
+
+    auto expected = std::vector<std::uint8_t>{};
+
+    for ( auto i = std::size_t{ 0 }; i < bytes.size(); ++i ) {
+        EXPECT_FALSE( encoder.put( bytes[ i ] ).is_error() );
+        expected.push_back( bytes[ i ] );
+
+        if ( i % 97 == 0 ) {
+            EXPECT_FALSE( encoder.put( "repeat repeat repeat" ).is_error() );
+            EXPECT_FALSE( encoder.flush().is_error() );
+
+            auto const repeat = std::string{ "repeat repeat repeat" };
+            expected.insert( expected.end(), repeat.begin(), repeat.end() );
+
+            EXPECT_EQ( ( decompress<8, 3>( downstream.vector() ) ), expected );
+        } // if
+    }     // for
+
+    EXPECT_FALSE( encoder.flush().is_error() );
+
+    EXPECT_EQ( ( decompress<8, 3>( downstream.vector() ) ), expected );
+}
+
+/**
+ * \brief Verify picolibrary::LZSS::Encoder_Stream_Buffer properly handles a downstream
+ *        buffer write error.
+ */
+TEST( encoding, downstreamError )
+{
+    auto downstream = Mock_Stream_Buffer{};
+
+    auto encoder = Encoder_Stream_Buffer<8>{ downstream };
+
+    auto const error = Mock_Error{ 0x35 };
+
+    EXPECT_FALSE( encoder.put( 'k' ).is_error() );
+
+    EXPECT_CALL( downstream, put( SafeMatcherCast<std::uint8_t>( _ ) ) ).WillOnce( Return( error ) );
+
+    auto const result = encoder.flush();
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::LZSS::Compressing_Output_Stream works properly.
+ */
+TEST( compressingOutputStream, worksProperly )
+{
+    auto downstream = Vector_Stream_Buffer<std::uint8_t>{};
+
+    auto stream = Compressing_Output_Stream<9>{ downstream };
+
+    EXPECT_FALSE( stream.put( "status=OK status=OK status=OK\n" ).is_error() );
+    EXPECT_FALSE( stream.flush().is_error() );
+    EXPECT_TRUE( stream.is_nominal() );
+
+    auto const string = std::string{ "status=OK status=OK status=OK\n" };
+
+    EXPECT_EQ( ( decompress<9, 4>( downstream.vector() ) ), ( std::vector<std::uint8_t>{ string.begin(), string.end() } ) );
+}
+
+/**
+ * \brief Execute the picolibrary::LZSS automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::MCP23X08::Debounced_Input_Pin automated test program.
+ */
+
+#include <cstdint>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/gpio.h"
+#include "picolibrary/microchip/mcp23x08.h"
+#include "picolibrary/testing/automated/microchip/mcp23x08.h"
+
+namespace {
+
+using ::picolibrary::GPIO::Initial_Pull_Up_State;
+using ::picolibrary::Microchip::MCP23X08::Debounced_Input_Pin;
+using ::picolibrary::Microchip::MCP23X08::Port_Snapshot;
+using ::picolibrary::Testing::Automated::Microchip::MCP23X08::Mock_Caching_Driver;
+using ::testing::_;
+using ::testing::InSequence;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Microchip::MCP23X08::Debounced_Input_Pin::initialize() works
+ *        properly.
+ */
+TEST( initialize, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto mcp23x08 = Mock_Caching_Driver{};
+
+    auto port_snapshot = Port_Snapshot{ mcp23x08, 0b0000'0000 };
+
+    auto pin = Debounced_Input_Pin{ port_snapshot, 0b0010'0000 };
+
+    EXPECT_CALL( mcp23x08, iodir() ).WillOnce( Return( 0b0000'0001 ) );
+    EXPECT_CALL( mcp23x08, write_iodir( 0b0010'0001 ) );
+    EXPECT_CALL( mcp23x08, gppu() ).WillOnce( Return( 0b0000'0001 ) );
+    EXPECT_CALL( mcp23x08, write_gppu( 0b0010'0001 ) );
+
+    pin.initialize( Initial_Pull_Up_State::ENABLED );
+
+    EXPECT_CALL( mcp23x08, gppu() ).WillOnce( Return( 0b0010'0001 ) );
+    EXPECT_CALL( mcp23x08, write_gppu( 0b0000'0001 ) );
+}
+
+/**
+ * \brief Verify picolibrary::Microchip::MCP23X08::Debounced_Input_Pin state and edge
+ *        queries are answered from the port snapshot without reading the GPIO register.
+ */
+TEST( state, answeredFromPortSnapshot )
+{
+    auto mcp23x08 = NiceMock<Mock_Caching_Driver>{};
+
+    auto port_snapshot = Port_Snapshot<Mock_Caching_Driver>{ mcp23x08, 0b1111'1111 };
+
+    auto const pin_0 = Debounced_Input_Pin{ port_snapshot, 0b0000'0001 };
+    auto const pin_7 = Debounced_Input_Pin{ port_snapshot, 0b1000'0000 };
+
+    EXPECT_CALL( mcp23x08, read_gpio() ).Times( 4 ).WillRepeatedly( Return( 0b0111'1111 ) );
+
+    for ( auto scan = 0; scan < 4; ++scan ) {
+        port_snapshot.scan();
+
+        EXPECT_TRUE( pin_0.is_high() );
+        EXPECT_FALSE( pin_0.rising_edge() );
+        EXPECT_FALSE( pin_0.falling_edge() );
+
+        EXPECT_EQ( pin_7.is_low(), scan == 3 );
+        EXPECT_FALSE( pin_7.rising_edge() );
+        EXPECT_EQ( pin_7.falling_edge(), scan == 3 );
+    } // for
+
+    EXPECT_CALL( mcp23x08, read_gpio() ).Times( 0 );
+    EXPECT_CALL( mcp23x08, write_gppu( _ ) ).Times( 2 );
+
+    EXPECT_TRUE( pin_0.is_high() );
+    EXPECT_TRUE( pin_7.is_low() );
+}
+
+/**
+ * \brief Execute the picolibrary::Microchip::MCP23X08::Debounced_Input_Pin
+ *        automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argc The array of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,191 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Microchip::MCP23X08::Port_Snapshot automated test program.
+ */
+
+#include <cstdint>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/debounce.h"
+#include "picolibrary/microchip/mcp23x08.h"
+#include "picolibrary/testing/automated/microchip/mcp23x08.h"
+
+namespace {
+
+using ::picolibrary::Debounce::Vertical_Counter_Debouncer;
+using ::picolibrary::Microchip::MCP23X08::Port_Snapshot;
+using ::picolibrary::Testing::Automated::Microchip::MCP23X08::Mock_Caching_Driver;
+using ::testing::Return;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Microchip::MCP23X08::Port_Snapshot::scan() works properly.
+ */
+TEST( scan, worksProperly )
+{
+    auto mcp23x08 = Mock_Caching_Driver{};
+
+    auto port_snapshot = Port_Snapshot{ mcp23x08, 0b1111'0000 };
+
+    EXPECT_EQ( port_snapshot.state(), 0b1111'0000 );
+    EXPECT_EQ( port_snapshot.rising_edges(), 0 );
+    EXPECT_EQ( port_snapshot.falling_edges(), 0 );
+
+    struct {
+        std::uint8_t gpio;
+        std::uint8_t state;
+        std::uint8_t rising_edges;
+        std::uint8_t falling_edges;
+    } const data[]{
+        // clang-format off
+
+        { 0b1100'0011, 0b1111'0000, 0b0000'0000, 0b0000'0000 },
+        { 0b1100'0011, 0b1111'0000, 0b0000'0000, 0b0000'0000 },
+        { 0b1100'0001, 0b1111'0000, 0b0000'0000, 0b0000'0000 },
+        { 0b1100'0011, 0b1100'0001, 0b0000'0001, 0b0011'0000 },
+        { 0b1100'0011, 0b1100'0001, 0b0000'0000, 0b0000'0000 },
+        { 0b1100'0011, 0b1100'0001, 0b0000'0000, 0b0000'0000 },
+        { 0b1100'0011, 0b1100'0011, 0b0000'0010, 0b0000'0000 },
+
+        // clang-format on
+    };
+
+    for ( auto const [ gpio, state, rising_edges, falling_edges ] : data ) {
+        EXPECT_CALL( mcp23x08, read_gpio() ).WillOnce( Return( gpio ) );
+
+        port_snapshot.scan();
+
+        EXPECT_EQ( port_snapshot.sample(), gpio );
+        EXPECT_EQ( port_snapshot.state(), state );
+        EXPECT_EQ( port_snapshot.rising_edges(), rising_edges );
+        EXPECT_EQ( port_snapshot.falling_edges(), falling_edges );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::Microchip::MCP23X08::Port_Snapshot::handle_interrupt() works
+ *        properly when an interrupt is not pending.
+ */
+TEST( handleInterrupt, worksProperlyInterruptNotPending )
+{
+    auto mcp23x08 = Mock_Caching_Driver{};
+
+    auto port_snapshot = Port_Snapshot<Mock_Caching_Driver, Vertical_Counter_Debouncer<std::uint8_t, 1>>{
+        mcp23x08, 0b0101'1010
+    };
+
+    EXPECT_CALL( mcp23x08, read_intf() ).WillOnce( Return( 0b0000'0000 ) );
+    EXPECT_CALL( mcp23x08, read_intcap() ).Times( 0 );
+
+    EXPECT_FALSE( port_snapshot.handle_interrupt() );
+
+    EXPECT_FALSE( port_snapshot.scan_pending() );
+    EXPECT_EQ( port_snapshot.state(), 0b0101'1010 );
+}
+
+/**
+ * \brief Verify picolibrary::Microchip::MCP23X08::Port_Snapshot::handle_interrupt() works
+ *        properly when an interrupt is pending.
+ */
+TEST( handleInterrupt, worksProperlyInterruptPending )
+{
+    auto mcp23x08 = Mock_Caching_Driver{};
+
+    auto port_snapshot = Port_Snapshot<Mock_Caching_Driver, Vertical_Counter_Debouncer<std::uint8_t, 1>>{
+        mcp23x08, 0b0101'1010
+    };
+
+    EXPECT_CALL( mcp23x08, read_intf() ).WillOnce( Return( 0b0000'0110 ) );
+    EXPECT_CALL( mcp23x08, read_intcap() ).WillOnce( Return( 0b0101'1100 ) );
+    EXPECT_CALL( mcp23x08, read_gpio() ).Times( 0 );
+
+    EXPECT_TRUE( port_snapshot.handle_interrupt() );
+
+    EXPECT_TRUE( port_snapshot.scan_pending() );
+    EXPECT_EQ( port_snapshot.sample(), 0b0101'1010 );
+    EXPECT_EQ( port_snapshot.state(), 0b0101'1010 );
+    EXPECT_EQ( port_snapshot.rising_edges(), 0 );
+    EXPECT_EQ( port_snapshot.falling_edges(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Microchip::MCP23X08::Port_Snapshot::handle_interrupt() does
+ *        not defeat debouncing when interrupts burst.
+ */
+TEST( handleInterrupt, worksProperlyInterruptBurst )
+{
+    auto mcp23x08 = Mock_Caching_Driver{};
+
+    auto port_snapshot = Port_Snapshot{ mcp23x08, 0b0000'0000 };
+
+    EXPECT_CALL( mcp23x08, read_intf() ).WillRepeatedly( Return( 0b0000'0001 ) );
+    EXPECT_CALL( mcp23x08, read_intcap() ).WillRepeatedly( Return( 0b0000'0001 ) );
+
+    for ( auto i = 0; i < 8; ++i ) {
+        EXPECT_TRUE( port_snapshot.handle_interrupt() );
+    } // for
+
+    EXPECT_TRUE( port_snapshot.scan_pending() );
+    EXPECT_EQ( port_snapshot.state(), 0b0000'0000 );
+
+    struct {
+        std::uint8_t gpio;
+        bool         scan_pending;
+        std::uint8_t state;
+    } const data[]{
+        // clang-format off
+
+        { 0b0000'0001, true,  0b0000'0000 },
+        { 0b0000'0000, false, 0b0000'0000 },
+        { 0b0000'0001, true,  0b0000'0000 },
+        { 0b0000'0001, true,  0b0000'0000 },
+        { 0b0000'0001, true,  0b0000'0000 },
+        { 0b0000'0001, false, 0b0000'0001 },
+
+        // clang-format on
+    };
+
+    for ( auto const [ gpio, scan_pending, state ] : data ) {
+        EXPECT_CALL( mcp23x08, read_gpio() ).WillOnce( Return( gpio ) );
+
+        port_snapshot.scan();
+
+        EXPECT_EQ( port_snapshot.scan_pending(), scan_pending );
+        EXPECT_EQ( port_snapshot.state(), state );
+    } // for
+}
+
+/**
+ * \brief Execute the picolibrary::Microchip::MCP23X08::Port_Snapshot automated
+ *        tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argc The array of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
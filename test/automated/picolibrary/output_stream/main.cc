@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -41,6 +42,7 @@ using ::picolibrary::Error_Code;
 using ::picolibrary::Output_Formatter;
 using ::picolibrary::Output_Stream;
 using ::picolibrary::Result;
+using ::picolibrary::Stream_Segment;
 using ::picolibrary::to_underlying;
 using ::picolibrary::Testing::Automated::Mock_Error;
 using ::picolibrary::Testing::Automated::Mock_Error_Category;
@@ -381,6 +383,64 @@ TEST( putSignedByteBlock, worksProperly )
     EXPECT_TRUE( stream.is_nominal() );
 }
 
+/**
+ * \brief Verify picolibrary::Output_Stream::put( picolibrary::Stream_Segment const *,
+ *        picolibrary::Stream_Segment const * ) properly handles a put error.
+ */
+TEST( putSegmentsErrorHandling, putError )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto const error = Mock_Error{ 183 };
+
+    EXPECT_CALL( stream.buffer(), put( A<std::vector<std::vector<std::uint8_t>>>() ) )
+        .WillOnce( Return( error ) );
+
+    auto const header  = std::vector<std::uint8_t>{ 0xA1, 0x5C };
+    auto const payload = std::vector<std::uint8_t>{ 0x0B, 0x6E, 0xD7 };
+
+    Stream_Segment const segments[]{
+        { &*header.begin(), &*header.end() },
+        { &*payload.begin(), &*payload.end() },
+    };
+
+    auto const result = stream.put( std::begin( segments ), std::end( segments ) );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_present() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::Output_Stream::put( picolibrary::Stream_Segment const *,
+ *        picolibrary::Stream_Segment const * ) works properly.
+ */
+TEST( putSegments, worksProperly )
+{
+    auto stream = Mock_Output_Stream{};
+
+    auto const header  = std::vector<std::uint8_t>{ 0xA1, 0x5C };
+    auto const payload = std::vector<std::uint8_t>{ 0x0B, 0x6E, 0xD7 };
+    auto const crc     = std::vector<std::uint8_t>{ 0x44, 0x19 };
+
+    EXPECT_CALL(
+        stream.buffer(), put( std::vector<std::vector<std::uint8_t>>{ header, payload, crc } ) )
+        .WillOnce( Return( Result<void>{} ) );
+
+    Stream_Segment const segments[]{
+        { &*header.begin(), &*header.end() },
+        { &*payload.begin(), &*payload.end() },
+        { &*crc.begin(), &*crc.end() },
+    };
+
+    EXPECT_FALSE( stream.put( std::begin( segments ), std::end( segments ) ).is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
 /**
  * \brief Verify picolibrary::Output_Stream::print() properly handles a
  *        picolibrary::Output_Formatter::print() error.
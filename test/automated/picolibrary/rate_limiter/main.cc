@@ -0,0 +1,455 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary rate limiting automated test program.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/error.h"
+#include "picolibrary/rate_limiter.h"
+#include "picolibrary/result.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Rate_Limited_Reliable_Stream_Buffer;
+using ::picolibrary::Rate_Limited_Stream_Buffer;
+using ::picolibrary::Result;
+using ::picolibrary::Token_Bucket;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Reliable_String_Stream_Buffer;
+using ::picolibrary::Testing::Automated::String_Stream_Buffer;
+using ::testing::_;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::SafeMatcherCast;
+
+/**
+ * \brief Fake tick source.
+ */
+class Fake_Tick_Source {
+  public:
+    using Tick = std::uint16_t;
+
+    auto ticks() const noexcept -> Tick
+    {
+        return tick;
+    }
+
+    Tick tick{};
+};
+
+/**
+ * \brief Mock stream socket.
+ */
+class Mock_Stream_Socket {
+  public:
+    MOCK_METHOD( (Result<std::size_t>), transmit, (std::vector<std::uint8_t>));
+
+    auto transmit( std::uint8_t const * begin, std::uint8_t const * end )
+        -> Result<std::uint8_t const *>
+    {
+        auto const result = transmit( std::vector<std::uint8_t>{ begin, end } );
+        if ( result.is_error() ) {
+            return result.error();
+        } // if
+
+        return begin + result.value();
+    }
+};
+
+/**
+ * \brief Mock datagram socket.
+ */
+class Mock_Datagram_Socket {
+  public:
+    MOCK_METHOD( (Result<void>), transmit, (std::uint16_t, std::vector<std::uint8_t>));
+
+    auto transmit( std::uint16_t endpoint, std::uint8_t const * begin, std::uint8_t const * end )
+        -> Result<void>
+    {
+        return transmit( endpoint, std::vector<std::uint8_t>{ begin, end } );
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Token_Bucket starts full, and is refilled at the configured
+ *        rate up to its capacity.
+ */
+TEST( tokenBucket, worksProperly )
+{
+    auto tick_source = Fake_Tick_Source{};
+
+    auto bucket = Token_Bucket<Fake_Tick_Source>{ tick_source, 5, 2, 10 };
+
+    EXPECT_EQ( bucket.capacity(), 5 );
+    EXPECT_EQ( bucket.available(), 5 );
+
+    EXPECT_TRUE( bucket.consume( 4 ) );
+    EXPECT_FALSE( bucket.consume( 2 ) );
+    EXPECT_EQ( bucket.available(), 1 );
+
+    tick_source.tick = 9;
+    EXPECT_EQ( bucket.available(), 1 );
+
+    tick_source.tick = 10;
+    EXPECT_EQ( bucket.available(), 3 );
+
+    tick_source.tick = 19;
+    EXPECT_EQ( bucket.available(), 3 );
+
+    tick_source.tick = 25;
+    EXPECT_EQ( bucket.available(), 5 );
+
+    tick_source.tick = 200;
+    EXPECT_EQ( bucket.available(), 5 );
+}
+
+/**
+ * \brief Verify picolibrary::Token_Bucket handles tick count wrap around properly.
+ */
+TEST( tokenBucket, tickWrapAround )
+{
+    auto tick_source = Fake_Tick_Source{};
+    tick_source.tick = 0xFFFA;
+
+    auto bucket = Token_Bucket<Fake_Tick_Source>{ tick_source, 4, 1, 8 };
+
+    EXPECT_TRUE( bucket.consume( 4 ) );
+
+    tick_source.tick = 0x0001;
+    EXPECT_EQ( bucket.available(), 0 );
+
+    tick_source.tick = 0x0002;
+    EXPECT_EQ( bucket.available(), 1 );
+
+    tick_source.tick = 0x000A;
+    EXPECT_EQ( bucket.available(), 2 );
+}
+
+/**
+ * \brief Verify picolibrary::Rate_Limited_Stream_Buffer suppresses messages when no tokens
+ *        are available, and summarizes suppressed messages before the next message.
+ */
+TEST( rateLimitedStreamBuffer, worksProperly )
+{
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 2, 1, 100 };
+    auto downstream  = String_Stream_Buffer{};
+
+    auto buffer = Rate_Limited_Stream_Buffer<Fake_Tick_Source>{ downstream, bucket };
+
+    auto const uint8s = std::vector<std::uint8_t>{ 'x', 'y' };
+
+    for ( auto i = 0; i < 5; ++i ) {
+        EXPECT_FALSE( buffer.put( "a" ).is_error() );
+        EXPECT_FALSE( buffer.put( &*uint8s.begin(), &*uint8s.end() ).is_error() );
+        EXPECT_FALSE( buffer.put( '\n' ).is_error() );
+        EXPECT_FALSE( buffer.flush().is_error() );
+    } // for
+
+    EXPECT_EQ( downstream.string(), "axy\naxy\n" );
+    EXPECT_EQ( buffer.suppressed(), 3 );
+
+    tick_source.tick = 100;
+
+    EXPECT_FALSE( buffer.put( "b\n" ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_EQ( downstream.string(), "axy\naxy\n<3 messages suppressed>\nb\n" );
+    EXPECT_EQ( buffer.suppressed(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Rate_Limited_Stream_Buffer::flush() only flushes the
+ *        downstream buffer if the message was not suppressed.
+ */
+TEST( rateLimitedStreamBuffer, flush )
+{
+    auto const in_sequence = InSequence{};
+
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 1, 1, 100 };
+    auto downstream  = Mock_Stream_Buffer{};
+
+    auto buffer = Rate_Limited_Stream_Buffer<Fake_Tick_Source>{ downstream, bucket };
+
+    EXPECT_CALL( downstream, put( SafeMatcherCast<char>( Eq( 'a' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( downstream, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.put( 'a' ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_FALSE( buffer.put( 'b' ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_CALL( downstream, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.flush().is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Rate_Limited_Stream_Buffer properly handles a downstream
+ *        error.
+ */
+TEST( rateLimitedStreamBuffer, downstreamError )
+{
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 1, 1, 100 };
+    auto downstream  = Mock_Stream_Buffer{};
+
+    auto buffer = Rate_Limited_Stream_Buffer<Fake_Tick_Source>{ downstream, bucket };
+
+    auto const error = Mock_Error{ 0x3B };
+
+    EXPECT_CALL( downstream, put( SafeMatcherCast<std::uint8_t>( _ ) ) ).WillOnce( Return( error ) );
+
+    auto const result = buffer.put( std::uint8_t{ 0x9C } );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::Rate_Limited_Stream_Buffer does not reset the suppressed
+ *        message count if writing the summary of the suppressed messages fails.
+ */
+TEST( rateLimitedStreamBuffer, summaryError )
+{
+    auto const in_sequence = InSequence{};
+
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 1, 1, 100 };
+    auto downstream  = Mock_Stream_Buffer{};
+
+    auto buffer = Rate_Limited_Stream_Buffer<Fake_Tick_Source>{ downstream, bucket };
+
+    EXPECT_CALL( downstream, put( SafeMatcherCast<char>( Eq( 'a' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( downstream, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.put( 'a' ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_FALSE( buffer.put( 'b' ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    EXPECT_EQ( buffer.suppressed(), 1 );
+
+    tick_source.tick = 100;
+
+    auto const error = Mock_Error{ 0xE4 };
+
+    EXPECT_CALL( downstream, put( std::string{ "<1 messages suppressed>\n" } ) ).WillOnce( Return( error ) );
+
+    auto const result = buffer.put( 'c' );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+    EXPECT_EQ( buffer.suppressed(), 1 );
+
+    EXPECT_CALL( downstream, put( std::string{ "<1 messages suppressed>\n" } ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( downstream, put( SafeMatcherCast<char>( Eq( 'd' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.put( 'd' ).is_error() );
+    EXPECT_EQ( buffer.suppressed(), 0 );
+}
+
+/**
+ * \brief Verify picolibrary::Rate_Limited_Reliable_Stream_Buffer suppresses messages when
+ *        no tokens are available, and summarizes suppressed messages before the next
+ *        message.
+ */
+TEST( rateLimitedReliableStreamBuffer, worksProperly )
+{
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 1, 1, 50 };
+    auto downstream  = Reliable_String_Stream_Buffer{};
+
+    auto buffer = Rate_Limited_Reliable_Stream_Buffer<Fake_Tick_Source>{ downstream, bucket };
+
+    for ( auto i = 0; i < 13; ++i ) {
+        buffer.put( "m\n" );
+        buffer.flush();
+    } // for
+
+    EXPECT_EQ( buffer.suppressed(), 12 );
+
+    tick_source.tick = 50;
+
+    buffer.put( std::int8_t{ 'n' } );
+    buffer.flush();
+
+    EXPECT_EQ( downstream.string(), "m\n<12 messages suppressed>\nn" );
+}
+
+/**
+ * \brief Verify picolibrary::transmit( picolibrary::Token_Bucket &, Socket &,
+ *        std::uint8_t const *, std::uint8_t const * ) works properly.
+ */
+TEST( transmitStream, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 4, 4, 10 };
+    auto socket      = Mock_Stream_Socket{};
+
+    auto const data = std::vector<std::uint8_t>{ 0x1A, 0x2B, 0x3C, 0x4D, 0x5E, 0x6F };
+
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 0x1A, 0x2B, 0x3C, 0x4D } ) )
+        .WillOnce( Return( std::size_t{ 3 } ) );
+
+    auto result = ::picolibrary::transmit( bucket, socket, &*data.begin(), &*data.end() );
+
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), &*data.begin() + 3 );
+    EXPECT_EQ( bucket.available(), 1 );
+
+    EXPECT_CALL( socket, transmit( std::vector<std::uint8_t>{ 0x4D } ) ).WillOnce( Return( std::size_t{ 1 } ) );
+
+    result = ::picolibrary::transmit( bucket, socket, &*data.begin() + 3, &*data.end() );
+
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), &*data.begin() + 4 );
+
+    result = ::picolibrary::transmit( bucket, socket, &*data.begin() + 4, &*data.end() );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_BLOCK );
+
+    auto const error = Mock_Error{ 0x71 };
+
+    tick_source.tick = 10;
+
+    EXPECT_CALL( socket, transmit( _ ) ).WillOnce( Return( error ) );
+
+    result = ::picolibrary::transmit( bucket, socket, &*data.begin() + 4, &*data.end() );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+    EXPECT_EQ( bucket.available(), 4 );
+}
+
+/**
+ * \brief Verify picolibrary::transmit( picolibrary::Token_Bucket &, Socket &, Endpoint
+ *        const &, std::uint8_t const *, std::uint8_t const * ) works properly.
+ */
+TEST( transmitDatagram, worksProperly )
+{
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 5, 5, 10 };
+    auto socket      = Mock_Datagram_Socket{};
+
+    auto const datagram = std::vector<std::uint8_t>{ 0xA4, 0x09, 0x7E };
+    auto const endpoint = std::uint16_t{ 0x4C2D };
+
+    EXPECT_CALL( socket, transmit( endpoint, datagram ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( ::picolibrary::transmit( bucket, socket, endpoint, &*datagram.begin(), &*datagram.end() )
+                      .is_error() );
+
+    auto const result = ::picolibrary::transmit(
+        bucket, socket, endpoint, &*datagram.begin(), &*datagram.end() );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::INSUFFICIENT_CAPACITY );
+    EXPECT_EQ( bucket.available(), 2 );
+}
+
+/**
+ * \brief Verify picolibrary::transmit( picolibrary::Token_Bucket &, Socket &, Endpoint
+ *        const &, std::uint8_t const *, std::uint8_t const * ) properly handles a socket
+ *        error.
+ */
+TEST( transmitDatagram, socketError )
+{
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 5, 5, 10 };
+    auto socket      = Mock_Datagram_Socket{};
+
+    auto const datagram = std::vector<std::uint8_t>{ 0x3F, 0xD2, 0x81, 0x5B };
+    auto const endpoint = std::uint16_t{ 0x91E6 };
+
+    EXPECT_CALL( socket, transmit( endpoint, datagram ) ).WillOnce( Return( Generic_Error::WOULD_BLOCK ) );
+
+    auto const result = ::picolibrary::transmit(
+        bucket, socket, endpoint, &*datagram.begin(), &*datagram.end() );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::WOULD_BLOCK );
+    EXPECT_EQ( bucket.available(), 5 );
+
+    EXPECT_CALL( socket, transmit( endpoint, datagram ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( ::picolibrary::transmit( bucket, socket, endpoint, &*datagram.begin(), &*datagram.end() )
+                      .is_error() );
+    EXPECT_EQ( bucket.available(), 1 );
+}
+
+/**
+ * \brief Verify picolibrary::transmit( picolibrary::Token_Bucket &, Socket &, Endpoint
+ *        const &, std::uint8_t const *, std::uint8_t const * ) properly handles a
+ *        datagram that is larger than the token bucket's capacity.
+ */
+TEST( transmitDatagram, excessiveMessageSize )
+{
+    auto tick_source = Fake_Tick_Source{};
+    auto bucket      = Token_Bucket<Fake_Tick_Source>{ tick_source, 5, 5, 10 };
+    auto socket      = Mock_Datagram_Socket{};
+
+    auto const datagram = std::vector<std::uint8_t>{ 0xE0, 0x47, 0x1C, 0x9A, 0x62, 0x0D };
+    auto const endpoint = std::uint16_t{ 0x2B78 };
+
+    EXPECT_CALL( socket, transmit( _, _ ) ).Times( 0 );
+
+    auto const result = ::picolibrary::transmit(
+        bucket, socket, endpoint, &*datagram.begin(), &*datagram.end() );
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::EXCESSIVE_MESSAGE_SIZE );
+    EXPECT_EQ( bucket.available(), 5 );
+}
+
+/**
+ * \brief Execute the picolibrary rate limiting automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
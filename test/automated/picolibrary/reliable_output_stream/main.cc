@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -39,6 +40,7 @@ namespace {
 using ::picolibrary::Error_Code;
 using ::picolibrary::Output_Formatter;
 using ::picolibrary::Reliable_Output_Stream;
+using ::picolibrary::Stream_Segment;
 using ::picolibrary::to_underlying;
 using ::picolibrary::Testing::Automated::Mock_Error;
 using ::picolibrary::Testing::Automated::Mock_Error_Category;
@@ -215,6 +217,32 @@ TEST( putSignedByteBlock, worksProperly )
     EXPECT_TRUE( stream.is_nominal() );
 }
 
+/**
+ * \brief Verify picolibrary::Reliable_Output_Stream::put( picolibrary::Stream_Segment
+ *        const *, picolibrary::Stream_Segment const * ) works properly.
+ */
+TEST( putSegments, worksProperly )
+{
+    auto stream = Mock_Reliable_Output_Stream{};
+
+    auto const header  = std::vector<std::uint8_t>{ 0x6F, 0x02 };
+    auto const payload = std::vector<std::uint8_t>{ 0x90, 0x3B };
+    auto const crc     = std::vector<std::uint8_t>{ 0xE7, 0x51 };
+
+    EXPECT_CALL(
+        stream.buffer(), put( std::vector<std::vector<std::uint8_t>>{ header, payload, crc } ) );
+
+    Stream_Segment const segments[]{
+        { &*header.begin(), &*header.end() },
+        { &*payload.begin(), &*payload.end() },
+        { &*crc.begin(), &*crc.end() },
+    };
+
+    stream.put( std::begin( segments ), std::end( segments ) );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
 /**
  * \brief Verify picolibrary::Reliable_Output_Stream::print() works properly when there is
  *        a single value to format.
@@ -21,6 +21,7 @@
  */
 
 #include <cstdint>
+#include <iterator>
 #include <string_view>
 #include <vector>
 
@@ -31,6 +32,7 @@
 
 namespace {
 
+using ::picolibrary::Stream_Segment;
 using ::picolibrary::Testing::Automated::Mock_Reliable_Stream_Buffer;
 using ::testing::Eq;
 using ::testing::InSequence;
@@ -113,6 +115,33 @@ TEST( putSignedByteBlock, worksProperly )
     buffer.Reliable_Stream_Buffer::put( &*values.begin(), &*values.end() );
 }
 
+/**
+ * \brief Verify picolibrary::Reliable_Stream_Buffer::put( picolibrary::Stream_Segment
+ *        const *, picolibrary::Stream_Segment const * ) works properly.
+ */
+TEST( putSegments, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto buffer = Mock_Reliable_Stream_Buffer{};
+
+    auto const header  = std::vector<std::uint8_t>{ 0x27, 0x01 };
+    auto const payload = std::vector<std::uint8_t>{ 0xF0 };
+    auto const crc     = std::vector<std::uint8_t>{ 0x3D, 0x96 };
+
+    EXPECT_CALL( buffer, put( header ) );
+    EXPECT_CALL( buffer, put( payload ) );
+    EXPECT_CALL( buffer, put( crc ) );
+
+    Stream_Segment const segments[]{
+        { &*header.begin(), &*header.end() },
+        { &*payload.begin(), &*payload.end() },
+        { &*crc.begin(), &*crc.end() },
+    };
+
+    buffer.Reliable_Stream_Buffer::put( std::begin( segments ), std::end( segments ) );
+}
+
 /**
  * \brief Execute the picolibrary::Reliable_Stream_Buffer automated tests.
  *
@@ -0,0 +1,164 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Scheduler automated test program.
+ */
+
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/active_object.h"
+#include "picolibrary/event.h"
+#include "picolibrary/scheduler.h"
+#include "picolibrary/testing/automated/event.h"
+#include "picolibrary/testing/automated/interrupt.h"
+
+namespace {
+
+using ::picolibrary::Active_Object;
+using ::picolibrary::Event;
+using ::picolibrary::Simple_Event;
+using ::picolibrary::Testing::Automated::Mock_Event_Category;
+using ::picolibrary::Testing::Automated::Interrupt::Mock_Controller;
+using ::testing::NiceMock;
+
+using Scheduler = ::picolibrary::Scheduler<4, Mock_Controller::Handle>;
+
+class Test_Active_Object :
+    public Active_Object<Test_Active_Object, sizeof( Simple_Event ), std::uint_fast8_t, 4, Mock_Controller::Handle> {
+  public:
+    Test_Active_Object(
+        Mock_Controller &    controller,
+        char                 name,
+        std::ostream &       stream,
+        Test_Active_Object * peer = nullptr ) noexcept :
+        Active_Object{ controller.handle() },
+        m_name{ name },
+        m_stream{ stream },
+        m_peer{ peer }
+    {
+    }
+
+  private:
+    friend Active_Object;
+
+    char m_name;
+
+    std::ostream & m_stream;
+
+    Test_Active_Object * m_peer;
+
+    void dispatch( Event const & event ) noexcept
+    {
+        m_stream << m_name << static_cast<unsigned int>( event.id() ) << ';';
+
+        if ( m_peer and event.id() == 0 ) {
+            m_peer->post( Simple_Event{ Mock_Event_Category::instance(), 9 } );
+        } // if
+    }
+};
+
+auto event( std::uint_fast8_t id ) noexcept -> Simple_Event
+{
+    return Simple_Event{ Mock_Event_Category::instance(), id };
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Scheduler dispatches events to the highest priority ready
+ *        active object first, one event at a time.
+ */
+TEST( scheduler, worksProperly )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto stream = std::ostringstream{};
+
+    auto high = Test_Active_Object{ controller, 'H', stream };
+    auto low  = Test_Active_Object{ controller, 'L', stream, &high };
+
+    low.post( event( 1 ) );
+
+    auto scheduler = Scheduler{ controller.handle() };
+
+    scheduler.add( 3, low );
+    scheduler.add( 0, high );
+
+    EXPECT_TRUE( scheduler.ready() );
+
+    low.post( event( 0 ) );
+    low.post( event( 2 ) );
+    high.post_from_interrupt( event( 5 ) );
+
+    while ( scheduler.dispatch() ) { stream << ' '; } // while
+
+    EXPECT_FALSE( scheduler.ready() );
+    EXPECT_FALSE( scheduler.dispatch() );
+    EXPECT_EQ( stream.str(), "H5; L1; L0; H9; L2; " );
+}
+
+/**
+ * \brief Verify picolibrary::Scheduler::schedule() calls the idle hook when none of the
+ *        scheduler's active objects are ready.
+ */
+TEST( scheduler, idleHook )
+{
+    auto controller = NiceMock<Mock_Controller>{};
+
+    auto stream = std::ostringstream{};
+
+    auto active_object = Test_Active_Object{ controller, 'A', stream };
+
+    auto scheduler = Scheduler{ controller.handle() };
+
+    scheduler.add( 2, active_object );
+
+    auto idle = 0;
+
+    scheduler.schedule( [ &idle ]() { ++idle; } );
+
+    EXPECT_EQ( idle, 1 );
+
+    active_object.post( event( 4 ) );
+
+    scheduler.schedule( [ &idle ]() { ++idle; } );
+    scheduler.schedule( [ &idle ]() { ++idle; } );
+
+    EXPECT_EQ( idle, 2 );
+    EXPECT_EQ( stream.str(), "A4;" );
+}
+
+/**
+ * \brief Execute the picolibrary::Scheduler automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
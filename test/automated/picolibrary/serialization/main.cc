@@ -0,0 +1,201 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Serialization automated test program.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/array.h"
+#include "picolibrary/serialization.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Array;
+using ::picolibrary::Serialization::Byte_Order;
+using ::picolibrary::Serialization::deserialize;
+using ::picolibrary::Serialization::Layout;
+using ::picolibrary::Serialization::serialize;
+using ::picolibrary::Testing::Automated::Output_Vector_Stream;
+using ::picolibrary::Testing::Automated::Reliable_Output_Vector_Stream;
+
+/**
+ * \brief Mode.
+ */
+enum class Mode : std::uint8_t {
+    IDLE   = 0x01, ///< Idle.
+    ACTIVE = 0xA5, ///< Active.
+};
+
+/**
+ * \brief Record.
+ */
+struct Record {
+    std::uint16_t id;
+    std::int8_t   temperature;
+    std::uint32_t timestamp;
+    Mode          mode;
+    bool          valid;
+    std::int16_t  offset;
+};
+
+/**
+ * \brief Big endian record layout.
+ */
+using Big_Endian_Layout =
+    Layout<Byte_Order::BIG, &Record::id, &Record::temperature, &Record::timestamp, &Record::mode, &Record::valid, &Record::offset>;
+
+/**
+ * \brief Little endian record layout.
+ */
+using Little_Endian_Layout =
+    Layout<Byte_Order::LITTLE, &Record::id, &Record::temperature, &Record::timestamp, &Record::mode, &Record::valid, &Record::offset>;
+
+static_assert( std::is_same_v<Big_Endian_Layout::Record, Record> );
+static_assert( Big_Endian_Layout::SIZE == 11 );
+
+constexpr auto RECORD = Record{ 0x1234, -0x03, 0x89ABCDEF, Mode::ACTIVE, true, -0x0102 };
+
+static_assert( Big_Endian_Layout::serialize( RECORD )[ 0 ] == 0x12 );
+static_assert( Little_Endian_Layout::serialize( RECORD )[ 0 ] == 0x34 );
+static_assert(
+    deserialize<Byte_Order::BIG, std::uint16_t>( Big_Endian_Layout::serialize( RECORD ).data() ) == 0x1234 );
+
+auto const BIG_ENDIAN_RECORD = std::vector<std::uint8_t>{
+    0x12, 0x34, 0xFD, 0x89, 0xAB, 0xCD, 0xEF, 0xA5, 0x01, 0xFE, 0xFE,
+};
+
+auto const LITTLE_ENDIAN_RECORD = std::vector<std::uint8_t>{
+    0x34, 0x12, 0xFD, 0xEF, 0xCD, 0xAB, 0x89, 0xA5, 0x01, 0xFE, 0xFE,
+};
+
+/**
+ * \brief Check if two records are equal.
+ */
+auto operator==( Record const & lhs, Record const & rhs ) noexcept -> bool
+{
+    return lhs.id == rhs.id and lhs.temperature == rhs.temperature and lhs.timestamp == rhs.timestamp
+           and lhs.mode == rhs.mode and lhs.valid == rhs.valid and lhs.offset == rhs.offset;
+}
+
+/**
+ * \brief Convert a serialized record to a vector.
+ */
+template<typename Buffer>
+auto to_vector( Buffer const & buffer ) -> std::vector<std::uint8_t>
+{
+    return { buffer.begin(), buffer.end() };
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Serialization::serialize() and
+ *        picolibrary::Serialization::deserialize() work properly.
+ */
+TEST( value, worksProperly )
+{
+    auto buffer = Array<std::uint8_t, 4>{};
+
+    EXPECT_EQ( serialize<Byte_Order::BIG>( std::uint32_t{ 0x01020304 }, buffer.data() ), buffer.end() );
+    EXPECT_EQ( to_vector( buffer ), ( std::vector<std::uint8_t>{ 0x01, 0x02, 0x03, 0x04 } ) );
+    EXPECT_EQ( ( deserialize<Byte_Order::BIG, std::uint32_t>( buffer.data() ) ), 0x01020304 );
+
+    EXPECT_EQ( serialize<Byte_Order::LITTLE>( std::int32_t{ -2 }, buffer.data() ), buffer.end() );
+    EXPECT_EQ( to_vector( buffer ), ( std::vector<std::uint8_t>{ 0xFE, 0xFF, 0xFF, 0xFF } ) );
+    EXPECT_EQ( ( deserialize<Byte_Order::LITTLE, std::int32_t>( buffer.data() ) ), -2 );
+    EXPECT_EQ( ( deserialize<Byte_Order::BIG, std::int16_t>( buffer.data() ) ), -0x0101 );
+
+    EXPECT_EQ(
+        to_vector( serialize<Byte_Order::BIG>( std::uint16_t{ 0xA15C } ) ),
+        ( std::vector<std::uint8_t>{ 0xA1, 0x5C } ) );
+    EXPECT_EQ(
+        to_vector( serialize<Byte_Order::LITTLE>( std::uint16_t{ 0xA15C } ) ),
+        ( std::vector<std::uint8_t>{ 0x5C, 0xA1 } ) );
+}
+
+/**
+ * \brief Verify picolibrary::Serialization::Layout serializes records properly.
+ */
+TEST( layoutSerialize, worksProperly )
+{
+    EXPECT_EQ( to_vector( Big_Endian_Layout::serialize( RECORD ) ), BIG_ENDIAN_RECORD );
+    EXPECT_EQ( to_vector( Little_Endian_Layout::serialize( RECORD ) ), LITTLE_ENDIAN_RECORD );
+
+    auto buffer = std::vector<std::uint8_t>( 13 );
+
+    EXPECT_EQ( Big_Endian_Layout::serialize( RECORD, &buffer[ 1 ] ), &buffer[ 12 ] );
+    EXPECT_EQ( ( std::vector<std::uint8_t>{ &buffer[ 1 ], &buffer[ 12 ] } ), BIG_ENDIAN_RECORD );
+}
+
+/**
+ * \brief Verify picolibrary::Serialization::Layout deserializes records properly.
+ */
+TEST( layoutDeserialize, worksProperly )
+{
+    EXPECT_TRUE( Big_Endian_Layout::deserialize( BIG_ENDIAN_RECORD.data() ) == RECORD );
+    EXPECT_TRUE( Little_Endian_Layout::deserialize( LITTLE_ENDIAN_RECORD.data() ) == RECORD );
+
+    auto record = Record{};
+
+    EXPECT_EQ( Big_Endian_Layout::deserialize( BIG_ENDIAN_RECORD.data(), record ), &*BIG_ENDIAN_RECORD.end() );
+    EXPECT_TRUE( record == RECORD );
+}
+
+/**
+ * \brief Verify picolibrary::Serialization::Layout writes serialized records to streams
+ *        properly.
+ */
+TEST( layoutSerializeStream, worksProperly )
+{
+    {
+        auto stream = Output_Vector_Stream<std::uint8_t>{};
+
+        EXPECT_FALSE( Big_Endian_Layout::serialize( stream, RECORD ).is_error() );
+
+        EXPECT_EQ( stream.vector(), BIG_ENDIAN_RECORD );
+    }
+
+    {
+        auto stream = Reliable_Output_Vector_Stream<std::uint8_t>{};
+
+        Little_Endian_Layout::serialize( stream, RECORD );
+
+        EXPECT_EQ( stream.vector(), LITTLE_ENDIAN_RECORD );
+    }
+}
+
+/**
+ * \brief Execute the picolibrary::Serialization automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
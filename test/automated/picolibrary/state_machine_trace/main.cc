@@ -0,0 +1,325 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::State_Machine_Trace automated test program.
+ */
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/event.h"
+#include "picolibrary/hsm.h"
+#include "picolibrary/state_machine.h"
+#include "picolibrary/state_machine_trace.h"
+#include "picolibrary/testing/automated/event.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Event;
+using ::picolibrary::Event_ID;
+using ::picolibrary::HSM;
+using ::picolibrary::Simple_Event;
+using ::picolibrary::State_Machine;
+using ::picolibrary::State_Machine_Trace::Analyzer;
+using ::picolibrary::State_Machine_Trace::Buffer;
+using ::picolibrary::State_Machine_Trace::Record;
+using ::picolibrary::State_Machine_Trace::Record_Layout;
+using ::picolibrary::State_Machine_Trace::Record_Type;
+using ::picolibrary::State_Machine_Trace::State_ID;
+using ::picolibrary::State_Machine_Trace::state_id;
+using ::picolibrary::Testing::Automated::Mock_Event_Category;
+using ::picolibrary::Testing::Automated::Reliable_Output_Vector_Stream;
+
+class Fake_Tick_Source {
+  public:
+    using Tick = std::uint32_t;
+
+    auto ticks() const noexcept -> Tick
+    {
+        return tick;
+    }
+
+    Tick tick{};
+};
+
+using Test_Buffer = Buffer<Fake_Tick_Source, std::uint_fast8_t, 16>;
+
+class Test_State_Machine : public State_Machine {
+  public:
+    Test_State_Machine() noexcept : State_Machine{ initial_pseudostate }
+    {
+    }
+
+    using State_Machine::disable_tracing;
+    using State_Machine::dispatch;
+    using State_Machine::enable_tracing;
+    using State_Machine::execute_initial_transition;
+
+    static auto initial_pseudostate( State_Machine & state_machine, Event const & event ) noexcept
+        -> Event_Handling_Result
+    {
+        return state_machine.transition_to( x, event );
+    }
+
+    static auto x( State_Machine & state_machine, Event const & event ) noexcept -> Event_Handling_Result
+    {
+        if ( &event.category() == &Mock_Event_Category::instance() and event.id() == 1 ) {
+            return state_machine.transition_to( y, event );
+        } // if
+
+        return state_machine.event_handled( event );
+    }
+
+    static auto y( State_Machine & state_machine, Event const & event ) noexcept -> Event_Handling_Result
+    {
+        return state_machine.event_handled( event );
+    }
+};
+
+class Test_HSM : public HSM {
+  public:
+    Test_HSM() noexcept : HSM{ initial_pseudostate }
+    {
+    }
+
+    using HSM::dispatch;
+    using HSM::enable_tracing;
+    using HSM::execute_topmost_initial_transition;
+
+    static auto initial_pseudostate( HSM & hsm, Event const & event ) noexcept -> Event_Handling_Result
+    {
+        return hsm.transition_to( a, event );
+    }
+
+    static auto a( HSM & hsm, Event const & event ) noexcept -> Event_Handling_Result
+    {
+        if ( &event.category() == &Mock_Event_Category::instance() ) {
+            switch ( event.id() ) {
+                case 1: return hsm.transition_to( b, event );
+                case 2: return hsm.event_handled( event );
+            } // switch
+        }     // if
+
+        return hsm.defer_event_handling_to( top, event );
+    }
+
+    static auto b( HSM & hsm, Event const & event ) noexcept -> Event_Handling_Result
+    {
+        return hsm.defer_event_handling_to( top, event );
+    }
+};
+
+auto records( Test_Buffer & buffer ) -> std::vector<Record>
+{
+    auto result = std::vector<Record>{};
+
+    for ( ; not buffer.empty(); buffer.pop() ) { result.push_back( buffer.front() ); } // for
+
+    return result;
+}
+
+auto matches( std::vector<Record> const & actual, std::vector<std::pair<Record_Type, State_ID>> const & expected )
+    -> bool
+{
+    if ( actual.size() != expected.size() ) {
+        return false;
+    } // if
+
+    for ( auto i = std::size_t{ 0 }; i < actual.size(); ++i ) {
+        if ( actual[ i ].type != expected[ i ].first or actual[ i ].state != expected[ i ].second ) {
+            return false;
+        } // if
+    }     // for
+
+    return true;
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::State_Machine generates the expected trace records.
+ */
+TEST( stateMachine, tracing )
+{
+    auto tick_source   = Fake_Tick_Source{};
+    auto buffer        = Test_Buffer{ tick_source };
+    auto state_machine = Test_State_Machine{};
+
+    state_machine.enable_tracing( buffer );
+
+    state_machine.execute_initial_transition( Simple_Event{ Mock_Event_Category::instance(), 0 } );
+    state_machine.dispatch( Simple_Event{ Mock_Event_Category::instance(), 2 } );
+    state_machine.dispatch( Simple_Event{ Mock_Event_Category::instance(), 1 } );
+
+    state_machine.disable_tracing();
+
+    state_machine.dispatch( Simple_Event{ Mock_Event_Category::instance(), 2 } );
+
+    auto const x = state_id( &Test_State_Machine::x );
+    auto const y = state_id( &Test_State_Machine::y );
+
+    EXPECT_TRUE( matches(
+        records( buffer ),
+        {
+            { Record_Type::ENTRY, x },
+            { Record_Type::DISPATCH, x },
+            { Record_Type::DISPATCH_COMPLETE, x },
+            { Record_Type::DISPATCH, x },
+            { Record_Type::TRANSITION, x },
+            { Record_Type::EXIT, x },
+            { Record_Type::ENTRY, y },
+            { Record_Type::DISPATCH_COMPLETE, y },
+        } ) );
+}
+
+/**
+ * \brief Verify picolibrary::HSM generates the expected trace records.
+ */
+TEST( hsm, tracing )
+{
+    auto tick_source = Fake_Tick_Source{};
+    auto buffer      = Test_Buffer{ tick_source };
+    auto hsm         = Test_HSM{};
+
+    hsm.enable_tracing( buffer );
+
+    hsm.execute_topmost_initial_transition( Simple_Event{ Mock_Event_Category::instance(), 0 } );
+    hsm.dispatch( Simple_Event{ Mock_Event_Category::instance(), 3 } );
+    hsm.dispatch( Simple_Event{ Mock_Event_Category::instance(), 1 } );
+
+    auto const a   = state_id( &Test_HSM::a );
+    auto const b   = state_id( &Test_HSM::b );
+    auto const top = state_id( &HSM::top );
+
+    auto const actual = records( buffer );
+
+    EXPECT_TRUE( matches(
+        actual,
+        {
+            { Record_Type::ENTRY, a },
+            { Record_Type::DISPATCH, a },
+            { Record_Type::IGNORED, top },
+            { Record_Type::DISPATCH_COMPLETE, a },
+            { Record_Type::DISPATCH, a },
+            { Record_Type::TRANSITION, a },
+            { Record_Type::EXIT, a },
+            { Record_Type::ENTRY, b },
+            { Record_Type::DISPATCH_COMPLETE, b },
+        } ) );
+    ASSERT_EQ( actual.size(), 9 );
+    EXPECT_EQ( actual[ 1 ].event, 3 );
+}
+
+/**
+ * \brief Verify picolibrary::State_Machine_Trace::Buffer overwrites the oldest records
+ *        when full, and flushes records in the fixed width binary form.
+ */
+TEST( buffer, overwriteAndFlush )
+{
+    auto tick_source = Fake_Tick_Source{};
+    auto buffer      = Buffer<Fake_Tick_Source, std::uint_fast8_t, 2>{ tick_source };
+
+    tick_source.tick = 0x01020304;
+    buffer.trace( Record_Type::DISPATCH, 0xA, 1 );
+    buffer.trace( Record_Type::DISPATCH_COMPLETE, 0xB, 2 );
+    buffer.trace( Record_Type::EXIT, std::numeric_limits<State_ID>::max(), 3 );
+
+    EXPECT_EQ( buffer.size(), 2 );
+    EXPECT_EQ( buffer.overwritten(), 1 );
+
+    auto stream = Reliable_Output_Vector_Stream<std::uint8_t>{};
+
+    buffer.flush( stream );
+
+    auto const expected = std::vector<std::uint8_t>{
+        // clang-format off
+
+        0x01, 0x02, 0x04, 0x03, 0x02, 0x01, 0x0B, 0x00, 0x00, 0x00, // DISPATCH_COMPLETE
+        0x04, 0x03, 0x04, 0x03, 0x02, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, // EXIT
+
+        // clang-format on
+    };
+
+    EXPECT_TRUE( buffer.empty() );
+    EXPECT_EQ( stream.vector(), expected );
+}
+
+/**
+ * \brief Verify picolibrary::State_Machine_Trace::Analyzer computes per-state residency
+ *        times and a dispatch latency histogram from a deserialized record sequence.
+ */
+TEST( analyzer, worksProperly )
+{
+    auto const sequence = std::vector<Record>{
+        { Record_Type::ENTRY, 1, 0, 0xA },
+        { Record_Type::DISPATCH, 7, 10, 0xA },
+        { Record_Type::DISPATCH_COMPLETE, 7, 10, 0xA },
+        { Record_Type::DISPATCH, 8, 20, 0xA },
+        { Record_Type::TRANSITION, 8, 21, 0xA },
+        { Record_Type::EXIT, 2, 22, 0xA },
+        { Record_Type::ENTRY, 1, 23, 0xB },
+        { Record_Type::DISPATCH_COMPLETE, 8, 25, 0xB },
+        { Record_Type::DISPATCH, 9, 30, 0xB },
+        { Record_Type::IGNORED, 9, 31, 0xC },
+        { Record_Type::DISPATCH_COMPLETE, 9, 31, 0xB },
+        { Record_Type::EXIT, 2, 40, 0xB },
+    };
+
+    auto analyzer = Analyzer<4>{};
+
+    for ( auto const & record : sequence ) {
+        auto const buffer = Record_Layout::serialize( record );
+
+        analyzer.analyze( Record_Layout::deserialize( buffer.data() ) );
+    } // for
+
+    EXPECT_EQ( analyzer.residency( 0xA ), 22 );
+    EXPECT_EQ( analyzer.residency( 0xB ), 17 );
+    EXPECT_EQ( analyzer.residency( 0xC ), 0 );
+    EXPECT_EQ( analyzer.dispatches(), 3 );
+    EXPECT_EQ( analyzer.transitions(), 1 );
+    EXPECT_EQ( analyzer.ignored(), 1 );
+
+    auto expected_histogram = Analyzer<4>::Histogram{};
+    expected_histogram[ 0 ] = 1; // 0 ticks
+    expected_histogram[ 1 ] = 1; // 1 tick
+    expected_histogram[ 3 ] = 1; // 5 ticks
+
+    EXPECT_EQ( analyzer.histogram(), expected_histogram );
+}
+
+/**
+ * \brief Execute the picolibrary::State_Machine_Trace automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,383 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Static_HSM automated test program.
+ */
+
+#include <ostream>
+#include <sstream>
+#include <string>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/static_hsm.h"
+
+namespace {
+
+using ::picolibrary::Static_HSM;
+using ::picolibrary::Static_HSM_Top;
+
+enum class Event {
+    A,
+    B,
+    C,
+    D,
+    E,
+    F,
+    G,
+    H,
+    I,
+};
+
+struct S11;
+struct S211;
+
+struct S {
+    using Superstate    = Static_HSM_Top;
+    using Initial_State = S11;
+};
+
+struct S1 {
+    using Superstate    = S;
+    using Initial_State = S11;
+};
+
+struct S11 {
+    using Superstate = S1;
+};
+
+struct S2 {
+    using Superstate    = S;
+    using Initial_State = S211;
+};
+
+struct S21 {
+    using Superstate    = S2;
+    using Initial_State = S211;
+};
+
+struct S211 {
+    using Superstate = S21;
+};
+
+class Test_HSM : public Static_HSM<Test_HSM, S, S1, S11, S2, S21, S211> {
+  public:
+    constexpr Test_HSM( std::ostream & stream ) noexcept : m_stream{ stream }
+    {
+    }
+
+    Test_HSM( Test_HSM && ) = delete;
+
+    Test_HSM( Test_HSM const & ) = delete;
+
+    ~Test_HSM() noexcept = default;
+
+    auto operator=( Test_HSM && ) = delete;
+
+    auto operator=( Test_HSM const & ) = delete;
+
+    void execute_topmost_initial_transition() noexcept
+    {
+        m_foo = false;
+
+        m_stream << "top-INIT;";
+
+        Static_HSM::execute_topmost_initial_transition<S2>();
+    }
+
+    using Static_HSM::dispatch;
+    using Static_HSM::is_in;
+
+  private:
+    friend Static_HSM;
+
+    std::ostream & m_stream;
+
+    bool m_foo{};
+
+    void on_entry( S ) noexcept
+    {
+        m_stream << "s-ENTRY;";
+    }
+
+    void on_exit( S ) noexcept
+    {
+        m_stream << "s-EXIT;";
+    }
+
+    void on_initial_transition( S ) noexcept
+    {
+        m_stream << "s-INIT;";
+    }
+
+    auto on_event( S state, Event event ) noexcept -> Event_Handling_Result
+    {
+        switch ( event ) {
+            case Event::E: m_stream << "s-E;"; return transition_to<S11>( state );
+            case Event::I:
+                if ( m_foo ) {
+                    m_foo = false;
+                    m_stream << "s-I;";
+                    return event_handled();
+                } // if
+                break;
+            default: break;
+        } // switch
+
+        return defer_event_handling_to_superstate();
+    }
+
+    void on_entry( S1 ) noexcept
+    {
+        m_stream << "s1-ENTRY;";
+    }
+
+    void on_exit( S1 ) noexcept
+    {
+        m_stream << "s1-EXIT;";
+    }
+
+    void on_initial_transition( S1 ) noexcept
+    {
+        m_stream << "s1-INIT;";
+    }
+
+    auto on_event( S1 state, Event event ) noexcept -> Event_Handling_Result
+    {
+        switch ( event ) {
+            case Event::A: m_stream << "s1-A;"; return transition_to<S1>( state );
+            case Event::B: m_stream << "s1-B;"; return transition_to<S11>( state );
+            case Event::C: m_stream << "s1-C;"; return transition_to<S2>( state );
+            case Event::D:
+                if ( not m_foo ) {
+                    m_foo = true;
+                    m_stream << "s1-D;";
+                    return transition_to<S>( state );
+                } // if
+                break;
+            case Event::F: m_stream << "s1-F;"; return transition_to<S211>( state );
+            case Event::I: m_stream << "s1-I;"; return event_handled();
+            default: break;
+        } // switch
+
+        return defer_event_handling_to_superstate();
+    }
+
+    void on_entry( S11 ) noexcept
+    {
+        m_stream << "s11-ENTRY;";
+    }
+
+    void on_exit( S11 ) noexcept
+    {
+        m_stream << "s11-EXIT;";
+    }
+
+    auto on_event( S11 state, Event event ) noexcept -> Event_Handling_Result
+    {
+        switch ( event ) {
+            case Event::D:
+                if ( m_foo ) {
+                    m_foo = false;
+                    m_stream << "s11-D;";
+                    return transition_to<S1>( state );
+                } // if
+                break;
+            case Event::G: m_stream << "s11-G;"; return transition_to<S211>( state );
+            case Event::H: m_stream << "s11-H;"; return transition_to<S>( state );
+            default: break;
+        } // switch
+
+        return defer_event_handling_to_superstate();
+    }
+
+    void on_entry( S2 ) noexcept
+    {
+        m_stream << "s2-ENTRY;";
+    }
+
+    void on_exit( S2 ) noexcept
+    {
+        m_stream << "s2-EXIT;";
+    }
+
+    void on_initial_transition( S2 ) noexcept
+    {
+        m_stream << "s2-INIT;";
+    }
+
+    auto on_event( S2 state, Event event ) noexcept -> Event_Handling_Result
+    {
+        switch ( event ) {
+            case Event::C: m_stream << "s2-C;"; return transition_to<S1>( state );
+            case Event::F: m_stream << "s2-F;"; return transition_to<S11>( state );
+            case Event::I:
+                if ( not m_foo ) {
+                    m_foo = true;
+                    m_stream << "s2-I;";
+                    return event_handled();
+                } // if
+                break;
+            default: break;
+        } // switch
+
+        return defer_event_handling_to_superstate();
+    }
+
+    void on_entry( S21 ) noexcept
+    {
+        m_stream << "s21-ENTRY;";
+    }
+
+    void on_exit( S21 ) noexcept
+    {
+        m_stream << "s21-EXIT;";
+    }
+
+    void on_initial_transition( S21 ) noexcept
+    {
+        m_stream << "s21-INIT;";
+    }
+
+    auto on_event( S21 state, Event event ) noexcept -> Event_Handling_Result
+    {
+        switch ( event ) {
+            case Event::A: m_stream << "s21-A;"; return transition_to<S21>( state );
+            case Event::B: m_stream << "s21-B;"; return transition_to<S211>( state );
+            case Event::G: m_stream << "s21-G;"; return transition_to<S11>( state );
+            default: break;
+        } // switch
+
+        return defer_event_handling_to_superstate();
+    }
+
+    void on_entry( S211 ) noexcept
+    {
+        m_stream << "s211-ENTRY;";
+    }
+
+    void on_exit( S211 ) noexcept
+    {
+        m_stream << "s211-EXIT;";
+    }
+
+    auto on_event( S211 state, Event event ) noexcept -> Event_Handling_Result
+    {
+        switch ( event ) {
+            case Event::D: m_stream << "s211-D;"; return transition_to<S21>( state );
+            case Event::H: m_stream << "s211-H;"; return transition_to<S>( state );
+            default: break;
+        } // switch
+
+        return defer_event_handling_to_superstate();
+    }
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Static_HSM works properly.
+ */
+TEST( staticHSM, worksProperly )
+{
+    auto stream = std::ostringstream{};
+
+    auto test_hsm = Test_HSM{ stream };
+
+    test_hsm.execute_topmost_initial_transition();
+    stream << '\n';
+
+    EXPECT_TRUE( test_hsm.is_in<S211>() );
+    EXPECT_TRUE( test_hsm.is_in<S2>() );
+    EXPECT_FALSE( test_hsm.is_in<S1>() );
+
+    for ( auto const event : {
+              // clang-format off
+
+              Event::G,
+              Event::I,
+              Event::A,
+              Event::D,
+              Event::D,
+              Event::C,
+              Event::E,
+              Event::E,
+              Event::G,
+              Event::I,
+              Event::I,
+
+              // clang-format on
+          } ) {
+        test_hsm.dispatch( event );
+        stream << '\n';
+    } // for
+
+    EXPECT_EQ(
+        stream.str(),
+        "top-INIT;s-ENTRY;s2-ENTRY;s2-INIT;s21-ENTRY;s211-ENTRY;\n"
+        "s21-G;s211-EXIT;s21-EXIT;s2-EXIT;s1-ENTRY;s11-ENTRY;\n"
+        "s1-I;\n"
+        "s1-A;s11-EXIT;s1-EXIT;s1-ENTRY;s1-INIT;s11-ENTRY;\n"
+        "s1-D;s11-EXIT;s1-EXIT;s-INIT;s1-ENTRY;s11-ENTRY;\n"
+        "s11-D;s11-EXIT;s1-INIT;s11-ENTRY;\n"
+        "s1-C;s11-EXIT;s1-EXIT;s2-ENTRY;s2-INIT;s21-ENTRY;s211-ENTRY;\n"
+        "s-E;s211-EXIT;s21-EXIT;s2-EXIT;s1-ENTRY;s11-ENTRY;\n"
+        "s-E;s11-EXIT;s1-EXIT;s1-ENTRY;s11-ENTRY;\n"
+        "s11-G;s11-EXIT;s1-EXIT;s2-ENTRY;s21-ENTRY;s211-ENTRY;\n"
+        "s2-I;\n"
+        "s-I;\n" );
+
+    EXPECT_TRUE( test_hsm.is_in<S211>() );
+    EXPECT_TRUE( test_hsm.is_in<S>() );
+    EXPECT_FALSE( test_hsm.is_in<S11>() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_HSM ignores events that are not handled by any state.
+ */
+TEST( staticHSM, unhandledEvent )
+{
+    auto stream = std::ostringstream{};
+
+    auto test_hsm = Test_HSM{ stream };
+
+    test_hsm.execute_topmost_initial_transition();
+    stream.str( "" );
+
+    test_hsm.dispatch( Event::B );
+    test_hsm.dispatch( 42 );
+
+    EXPECT_EQ( stream.str(), "s21-B;s211-EXIT;s211-ENTRY;" );
+    EXPECT_TRUE( test_hsm.is_in<S211>() );
+}
+
+/**
+ * \brief Execute the picolibrary::Static_HSM automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
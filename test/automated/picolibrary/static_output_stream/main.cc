@@ -0,0 +1,361 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Static_Output_Stream automated test program.
+ */
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Result;
+using ::picolibrary::Static_Output_Stream;
+using ::picolibrary::Stream_Segment;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Reliable_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Mock_Stream_Buffer;
+using ::testing::A;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::SafeMatcherCast;
+
+class Mock_Final_Stream_Buffer final : public Mock_Stream_Buffer {
+};
+
+class Mock_Static_Output_Stream : public Static_Output_Stream<Mock_Final_Stream_Buffer> {
+  public:
+    Mock_Static_Output_Stream()
+    {
+        set_buffer( &m_buffer );
+    }
+
+    Mock_Static_Output_Stream( Mock_Static_Output_Stream && ) = delete;
+
+    Mock_Static_Output_Stream( Mock_Static_Output_Stream const & ) = delete;
+
+    ~Mock_Static_Output_Stream() noexcept = default;
+
+    auto operator=( Mock_Static_Output_Stream && ) = delete;
+
+    auto operator=( Mock_Static_Output_Stream const & ) = delete;
+
+    auto buffer() noexcept -> Mock_Final_Stream_Buffer &
+    {
+        return m_buffer;
+    }
+
+  private:
+    Mock_Final_Stream_Buffer m_buffer{};
+};
+
+class Mock_Final_Reliable_Stream_Buffer final : public Mock_Reliable_Stream_Buffer {
+};
+
+class Mock_Static_Reliable_Output_Stream :
+    public Static_Output_Stream<Mock_Final_Reliable_Stream_Buffer> {
+  public:
+    Mock_Static_Reliable_Output_Stream()
+    {
+        set_buffer( &m_buffer );
+    }
+
+    Mock_Static_Reliable_Output_Stream( Mock_Static_Reliable_Output_Stream && ) = delete;
+
+    Mock_Static_Reliable_Output_Stream( Mock_Static_Reliable_Output_Stream const & ) = delete;
+
+    ~Mock_Static_Reliable_Output_Stream() noexcept = default;
+
+    auto operator=( Mock_Static_Reliable_Output_Stream && ) = delete;
+
+    auto operator=( Mock_Static_Reliable_Output_Stream const & ) = delete;
+
+    auto buffer() noexcept -> Mock_Final_Reliable_Stream_Buffer &
+    {
+        return m_buffer;
+    }
+
+  private:
+    Mock_Final_Reliable_Stream_Buffer m_buffer{};
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::put( char ) properly handles a put
+ *        error.
+ */
+TEST( putCharErrorHandling, putError )
+{
+    auto stream = Mock_Static_Output_Stream{};
+
+    auto const error = Mock_Error{ 76 };
+
+    EXPECT_CALL( stream.buffer(), put( A<char>() ) ).WillOnce( Return( error ) );
+
+    auto const result = stream.put( 'S' );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_present() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::put( char ) works properly.
+ */
+TEST( putChar, worksProperly )
+{
+    auto stream = Mock_Static_Output_Stream{};
+
+    auto const character = 'W';
+
+    EXPECT_CALL( stream.buffer(), put( SafeMatcherCast<char>( Eq( character ) ) ) )
+        .WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( stream.put( character ).is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::put( char const *, char const * )
+ *        works properly.
+ */
+TEST( putCharBlock, worksProperly )
+{
+    auto stream = Mock_Static_Output_Stream{};
+
+    auto const string = std::string_view{ "q8DVHzN0" };
+
+    EXPECT_CALL( stream.buffer(), put( std::string{ string } ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( stream.put( string.begin(), string.end() ).is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::put( char const * ) works properly.
+ */
+TEST( putNullTerminatedString, worksProperly )
+{
+    auto stream = Mock_Static_Output_Stream{};
+
+    auto const string = std::string{ "Xa2Kw7" };
+
+    EXPECT_CALL( stream.buffer(), put( string ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( stream.put( string.c_str() ).is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::put( std::uint8_t const *, std::uint8_t
+ *        const * ) works properly.
+ */
+TEST( putUnsignedByteBlock, worksProperly )
+{
+    auto stream = Mock_Static_Output_Stream{};
+
+    auto const values = std::vector<std::uint8_t>{ 0x1C, 0xE5, 0x70, 0x9A };
+
+    EXPECT_CALL( stream.buffer(), put( values ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( stream.put( &*values.begin(), &*values.end() ).is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::put( picolibrary::Stream_Segment const
+ *        *, picolibrary::Stream_Segment const * ) works properly.
+ */
+TEST( putSegments, worksProperly )
+{
+    auto stream = Mock_Static_Output_Stream{};
+
+    auto const header  = std::vector<std::uint8_t>{ 0x3E, 0x02 };
+    auto const payload = std::vector<std::uint8_t>{ 0xB8, 0x61 };
+
+    EXPECT_CALL( stream.buffer(), put( std::vector<std::vector<std::uint8_t>>{ header, payload } ) )
+        .WillOnce( Return( Result<void>{} ) );
+
+    Stream_Segment const segments[]{
+        { &*header.begin(), &*header.end() },
+        { &*payload.begin(), &*payload.end() },
+    };
+
+    EXPECT_FALSE( stream.put( std::begin( segments ), std::end( segments ) ).is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::print() works properly.
+ */
+TEST( print, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Static_Output_Stream{};
+
+    EXPECT_CALL( stream.buffer(), put( std::string{ "cP4" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( stream.buffer(), put( SafeMatcherCast<char>( Eq( 'j' ) ) ) )
+        .WillOnce( Return( Result<void>{} ) );
+
+    auto const result = stream.print( "cP4", 'j' );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 4 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::flush() properly handles a flush
+ *        error.
+ */
+TEST( flushErrorHandling, flushError )
+{
+    auto stream = Mock_Static_Output_Stream{};
+
+    auto const error = Mock_Error{ 143 };
+
+    EXPECT_CALL( stream.buffer(), flush() ).WillOnce( Return( error ) );
+
+    auto const result = stream.flush();
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( stream.end_of_file_reached() );
+    EXPECT_FALSE( stream.io_error_present() );
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::flush() works properly.
+ */
+TEST( flush, worksProperly )
+{
+    auto stream = Mock_Static_Output_Stream{};
+
+    EXPECT_CALL( stream.buffer(), flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( stream.flush().is_error() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::put( char ) works properly when the
+ *        stream is associated with a reliable I/O stream device access buffer.
+ */
+TEST( putCharReliable, worksProperly )
+{
+    auto stream = Mock_Static_Reliable_Output_Stream{};
+
+    auto const character = 'h';
+
+    EXPECT_CALL( stream.buffer(), put( SafeMatcherCast<char>( Eq( character ) ) ) );
+
+    stream.put( character );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::put( char const * ) works properly
+ *        when the stream is associated with a reliable I/O stream device access buffer.
+ */
+TEST( putNullTerminatedStringReliable, worksProperly )
+{
+    auto stream = Mock_Static_Reliable_Output_Stream{};
+
+    auto const string = std::string{ "V3nu0B" };
+
+    EXPECT_CALL( stream.buffer(), put( string ) );
+
+    stream.put( string.c_str() );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::print() works properly when the stream
+ *        is associated with a reliable I/O stream device access buffer.
+ */
+TEST( printReliable, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto stream = Mock_Static_Reliable_Output_Stream{};
+
+    EXPECT_CALL( stream.buffer(), put( std::string{ "Ug" } ) );
+    EXPECT_CALL( stream.buffer(), put( SafeMatcherCast<char>( Eq( '9' ) ) ) );
+
+    EXPECT_EQ( stream.print( "Ug", '9' ), 3 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Verify picolibrary::Static_Output_Stream::flush() works properly when the stream
+ *        is associated with a reliable I/O stream device access buffer.
+ */
+TEST( flushReliable, worksProperly )
+{
+    auto stream = Mock_Static_Reliable_Output_Stream{};
+
+    EXPECT_CALL( stream.buffer(), flush() );
+
+    stream.flush();
+
+    EXPECT_TRUE( stream.is_nominal() );
+}
+
+/**
+ * \brief Execute the picolibrary::Static_Output_Stream automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -21,6 +21,7 @@
  */
 
 #include <cstdint>
+#include <iterator>
 #include <string_view>
 #include <vector>
 
@@ -34,6 +35,7 @@
 namespace {
 
 using ::picolibrary::Result;
+using ::picolibrary::Stream_Segment;
 using ::picolibrary::Testing::Automated::Mock_Error;
 using ::picolibrary::Testing::Automated::Mock_Stream_Buffer;
 using ::testing::A;
@@ -201,6 +203,60 @@ TEST( putSignedByteBlock, worksProperly )
     EXPECT_FALSE( buffer.Stream_Buffer::put( &*values.begin(), &*values.end() ).is_error() );
 }
 
+/**
+ * \brief Verify picolibrary::Stream_Buffer::put( picolibrary::Stream_Segment const *,
+ *        picolibrary::Stream_Segment const * ) properly handles a put error.
+ */
+TEST( putSegmentsErrorHandling, putError )
+{
+    auto buffer = Mock_Stream_Buffer{};
+
+    auto const error = Mock_Error{ 37 };
+
+    EXPECT_CALL( buffer, put( A<std::vector<std::uint8_t>>() ) ).WillOnce( Return( error ) );
+
+    auto const header  = std::vector<std::uint8_t>{ 0x5A, 0x03 };
+    auto const payload = std::vector<std::uint8_t>{ 0xC4, 0x7E, 0x19 };
+
+    Stream_Segment const segments[]{
+        { &*header.begin(), &*header.end() },
+        { &*payload.begin(), &*payload.end() },
+    };
+
+    auto const result = buffer.Stream_Buffer::put( std::begin( segments ), std::end( segments ) );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+}
+
+/**
+ * \brief Verify picolibrary::Stream_Buffer::put( picolibrary::Stream_Segment const *,
+ *        picolibrary::Stream_Segment const * ) works properly.
+ */
+TEST( putSegments, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto buffer = Mock_Stream_Buffer{};
+
+    auto const header  = std::vector<std::uint8_t>{ 0x5A, 0x03 };
+    auto const payload = std::vector<std::uint8_t>{ 0xC4, 0x7E, 0x19 };
+    auto const crc     = std::vector<std::uint8_t>{ 0x8B, 0xE2 };
+
+    EXPECT_CALL( buffer, put( header ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( buffer, put( payload ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( buffer, put( crc ) ).WillOnce( Return( Result<void>{} ) );
+
+    Stream_Segment const segments[]{
+        { &*header.begin(), &*header.end() },
+        { &*payload.begin(), &*payload.end() },
+        { &*crc.begin(), &*crc.end() },
+    };
+
+    EXPECT_FALSE(
+        buffer.Stream_Buffer::put( std::begin( segments ), std::end( segments ) ).is_error() );
+}
+
 /**
  * \brief Execute the picolibrary::Stream_Buffer automated tests.
  *
@@ -0,0 +1,320 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Table_Driven_State_Machine automated test program.
+ */
+
+#include <ostream>
+#include <sstream>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/event.h"
+#include "picolibrary/rom.h"
+#include "picolibrary/table_driven_state_machine.h"
+#include "picolibrary/testing/automated/event.h"
+#include "picolibrary/utility.h"
+
+namespace {
+
+using ::picolibrary::Event_ID;
+using ::picolibrary::Simple_Event;
+using ::picolibrary::Table_Driven_State_Machine;
+using ::picolibrary::to_underlying;
+using ::picolibrary::Testing::Automated::Mock_Event_Category;
+
+class Test_State_Machine : public Table_Driven_State_Machine {
+  public:
+    static Simple_Event const A;
+    static Simple_Event const B;
+    static Simple_Event const C;
+    static Simple_Event const D;
+
+    constexpr Test_State_Machine( std::ostream & stream ) noexcept :
+        Table_Driven_State_Machine{ Event_Category::instance(),
+                                    TRANSITIONS,
+                                    STATE_ACTIONS },
+        m_stream{ stream }
+    {
+    }
+
+    Test_State_Machine( Test_State_Machine && ) = delete;
+
+    Test_State_Machine( Test_State_Machine const & ) = delete;
+
+    ~Test_State_Machine() noexcept = default;
+
+    auto operator=( Test_State_Machine && ) = delete;
+
+    auto operator=( Test_State_Machine const & ) = delete;
+
+    void execute_initial_transition() noexcept
+    {
+        m_stream << "start-INIT;";
+
+        Table_Driven_State_Machine::execute_initial_transition( to_underlying( State::S1 ) );
+    }
+
+    using Table_Driven_State_Machine::current_state;
+    using Table_Driven_State_Machine::dispatch;
+    using Table_Driven_State_Machine::is_in;
+
+    enum class State : Table_Driven_State_Machine::State {
+        S1,
+        S2,
+    };
+
+  private:
+    enum class Event : Event_ID {
+        A,
+        B,
+        C,
+        D,
+    };
+
+    class Event_Category final : public ::picolibrary::Event_Category {
+      public:
+        static constexpr auto instance() noexcept -> Event_Category const &
+        {
+            return INSTANCE;
+        }
+
+        Event_Category( Event_Category && ) = delete;
+
+        Event_Category( Event_Category const & ) = delete;
+
+        auto operator=( Event_Category && ) = delete;
+
+        auto operator=( Event_Category const & ) = delete;
+
+      private:
+        static Event_Category const INSTANCE;
+
+        constexpr Event_Category() noexcept = default;
+
+        ~Event_Category() noexcept = default;
+
+        auto name() const noexcept -> ::picolibrary::ROM::String override final
+        {
+            return PICOLIBRARY_ROM_STRING( "::Test_State_Machine::Event" );
+        }
+
+        auto event_description( Event_ID id ) const noexcept -> ::picolibrary::ROM::String override final
+        {
+            switch ( static_cast<Event>( id ) ) {
+                    // clang-format off
+
+                case Event::A: return PICOLIBRARY_ROM_STRING( "A" );
+                case Event::B: return PICOLIBRARY_ROM_STRING( "B" );
+                case Event::C: return PICOLIBRARY_ROM_STRING( "C" );
+                case Event::D: return PICOLIBRARY_ROM_STRING( "D" );
+
+                    // clang-format on
+            } // switch
+
+            return PICOLIBRARY_ROM_STRING( "UNKNOWN" );
+        }
+    };
+
+    static constexpr auto NO_TRANSITION = Table_Driven_State_Machine::NO_TRANSITION;
+
+    static constexpr auto S1 = to_underlying( State::S1 );
+    static constexpr auto S2 = to_underlying( State::S2 );
+
+    static Transition const TRANSITIONS[ 2 ][ 4 ];
+
+    static State_Actions const STATE_ACTIONS[ 2 ];
+
+    std::ostream & m_stream;
+
+    static auto stream( Table_Driven_State_Machine & state_machine ) noexcept -> std::ostream &
+    {
+        return static_cast<Test_State_Machine &>( state_machine ).m_stream;
+    }
+
+    static void s1_entry( Table_Driven_State_Machine & state_machine ) noexcept
+    {
+        stream( state_machine ) << "s1-ENTRY;";
+    }
+
+    static void s1_exit( Table_Driven_State_Machine & state_machine ) noexcept
+    {
+        stream( state_machine ) << "s1-EXIT;";
+    }
+
+    static void s1_a( Table_Driven_State_Machine & state_machine, ::picolibrary::Event const & ) noexcept
+    {
+        stream( state_machine ) << "s1-A;";
+    }
+
+    static void s1_b( Table_Driven_State_Machine & state_machine, ::picolibrary::Event const & ) noexcept
+    {
+        stream( state_machine ) << "s1-B;";
+    }
+
+    static void s1_c( Table_Driven_State_Machine & state_machine, ::picolibrary::Event const & ) noexcept
+    {
+        stream( state_machine ) << "s1-C;";
+    }
+
+    static void s2_entry( Table_Driven_State_Machine & state_machine ) noexcept
+    {
+        stream( state_machine ) << "s2-ENTRY;";
+    }
+
+    static void s2_exit( Table_Driven_State_Machine & state_machine ) noexcept
+    {
+        stream( state_machine ) << "s2-EXIT;";
+    }
+
+    static void s2_a( Table_Driven_State_Machine & state_machine, ::picolibrary::Event const & ) noexcept
+    {
+        stream( state_machine ) << "s2-A;";
+    }
+
+    static void s2_b( Table_Driven_State_Machine & state_machine, ::picolibrary::Event const & ) noexcept
+    {
+        stream( state_machine ) << "s2-B;";
+    }
+
+    static void s2_c( Table_Driven_State_Machine & state_machine, ::picolibrary::Event const & ) noexcept
+    {
+        stream( state_machine ) << "s2-C;";
+    }
+};
+
+Test_State_Machine::Event_Category const Test_State_Machine::Event_Category::INSTANCE{};
+
+Table_Driven_State_Machine::Transition const Test_State_Machine::TRANSITIONS[ 2 ][ 4 ]{
+    // clang-format off
+
+    //   A                      B                C                D
+    { { s1_a, NO_TRANSITION }, { s1_b, S1 }, { s1_c, S2 }, { nullptr, NO_TRANSITION } }, // S1
+    { { s2_a, NO_TRANSITION }, { s2_b, S2 }, { s2_c, S1 }, { nullptr, S1            } }, // S2
+
+    // clang-format on
+};
+
+Table_Driven_State_Machine::State_Actions const Test_State_Machine::STATE_ACTIONS[ 2 ]{
+    { s1_entry, s1_exit }, // S1
+    { s2_entry, s2_exit }, // S2
+};
+
+Simple_Event const Test_State_Machine::A{ Event_Category::instance(), to_underlying( Event::A ) };
+Simple_Event const Test_State_Machine::B{ Event_Category::instance(), to_underlying( Event::B ) };
+Simple_Event const Test_State_Machine::C{ Event_Category::instance(), to_underlying( Event::C ) };
+Simple_Event const Test_State_Machine::D{ Event_Category::instance(), to_underlying( Event::D ) };
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Table_Driven_State_Machine works properly.
+ */
+TEST( tableDrivenStateMachine, worksProperly )
+{
+    auto stream = std::ostringstream{};
+
+    auto test_state_machine = Test_State_Machine{ stream };
+
+    EXPECT_EQ( test_state_machine.current_state(), Table_Driven_State_Machine::NO_TRANSITION );
+
+    test_state_machine.execute_initial_transition();
+    stream << '\n';
+
+    EXPECT_TRUE( test_state_machine.is_in( to_underlying( Test_State_Machine::State::S1 ) ) );
+
+    Simple_Event const event_sequence[]{
+        // clang-format off
+
+        Test_State_Machine::A,
+        Test_State_Machine::B,
+        Test_State_Machine::D,
+        Test_State_Machine::C,
+        Test_State_Machine::A,
+        Test_State_Machine::B,
+        Test_State_Machine::C,
+        Test_State_Machine::C,
+        Test_State_Machine::D,
+
+        // clang-format on
+    };
+
+    for ( auto const & event : event_sequence ) {
+        test_state_machine.dispatch( event );
+        stream << '\n';
+    } // for
+
+    EXPECT_EQ(
+        stream.str(),
+        "start-INIT;s1-ENTRY;\n"
+        "s1-A;\n"
+        "s1-B;s1-EXIT;s1-ENTRY;\n"
+        "\n"
+        "s1-C;s1-EXIT;s2-ENTRY;\n"
+        "s2-A;\n"
+        "s2-B;s2-EXIT;s2-ENTRY;\n"
+        "s2-C;s2-EXIT;s1-ENTRY;\n"
+        "s1-C;s1-EXIT;s2-ENTRY;\n"
+        "s2-EXIT;s1-ENTRY;\n" );
+
+    EXPECT_EQ( test_state_machine.current_state(), to_underlying( Test_State_Machine::State::S1 ) );
+}
+
+/**
+ * \brief Verify picolibrary::Table_Driven_State_Machine::dispatch() ignores events from
+ *        other event categories.
+ */
+TEST( dispatch, otherCategory )
+{
+    auto stream = std::ostringstream{};
+
+    auto test_state_machine = Test_State_Machine{ stream };
+
+    test_state_machine.execute_initial_transition();
+    stream.str( "" );
+
+    auto const other_category = Mock_Event_Category{};
+
+    auto const c = Test_State_Machine::C.id();
+
+    test_state_machine.dispatch( Simple_Event{ other_category, c } );
+    test_state_machine.dispatch( Simple_Event{ other_category, 4 } );
+
+    EXPECT_EQ( stream.str(), "" );
+    EXPECT_TRUE( test_state_machine.is_in( to_underlying( Test_State_Machine::State::S1 ) ) );
+
+    test_state_machine.dispatch( Test_State_Machine::C );
+
+    EXPECT_EQ( stream.str(), "s1-C;s1-EXIT;s2-ENTRY;" );
+}
+
+/**
+ * \brief Execute the picolibrary::Table_Driven_State_Machine automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
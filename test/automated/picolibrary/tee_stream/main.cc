@@ -0,0 +1,339 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Tee_Stream_Buffer automated test program.
+ */
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/result.h"
+#include "picolibrary/stream.h"
+#include "picolibrary/tee_stream.h"
+#include "picolibrary/testing/automated/error.h"
+#include "picolibrary/testing/automated/stream.h"
+
+namespace {
+
+using ::picolibrary::Circular_Stream_Buffer;
+using ::picolibrary::Result;
+using ::picolibrary::Stream_Segment;
+using ::picolibrary::Tee_Failure_Policy;
+using ::picolibrary::Tee_Output_Stream;
+using ::picolibrary::Tee_Sink;
+using ::picolibrary::Tee_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Mock_Error;
+using ::picolibrary::Testing::Automated::Mock_Stream_Buffer;
+using ::picolibrary::Testing::Automated::Reliable_String_Stream_Buffer;
+using ::testing::A;
+using ::testing::Eq;
+using ::testing::InSequence;
+using ::testing::Return;
+using ::testing::SafeMatcherCast;
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Tee_Stream_Buffer forwards each put and flush to each sink.
+ */
+TEST( forwarding, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto sink_a = Mock_Stream_Buffer{};
+    auto sink_b = Mock_Stream_Buffer{};
+
+    auto buffer = Tee_Stream_Buffer{ Tee_Sink{ &sink_a, Tee_Failure_Policy::PROPAGATE },
+                                     Tee_Sink{ &sink_b, Tee_Failure_Policy::PROPAGATE } };
+
+    auto const string   = std::string{ "2Gqe" };
+    auto const uint8s   = std::vector<std::uint8_t>{ 0x5D, 0xA0, 0x13 };
+    auto const int8s    = std::vector<std::int8_t>{ -0x2A, 0x71 };
+    auto const header   = std::vector<std::uint8_t>{ 0xE4 };
+    auto const payload  = std::vector<std::uint8_t>{ 0x0B, 0x99 };
+    auto const segments = std::vector<Stream_Segment>{ { &*header.begin(), &*header.end() },
+                                                       { &*payload.begin(), &*payload.end() } };
+
+    EXPECT_CALL( sink_a, put( SafeMatcherCast<char>( Eq( 'x' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( SafeMatcherCast<char>( Eq( 'x' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( string ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( string ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( string ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( string ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( SafeMatcherCast<std::uint8_t>( Eq( 0x7C ) ) ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( SafeMatcherCast<std::uint8_t>( Eq( 0x7C ) ) ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( uint8s ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( uint8s ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( SafeMatcherCast<std::int8_t>( Eq( -0x41 ) ) ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( SafeMatcherCast<std::int8_t>( Eq( -0x41 ) ) ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( int8s ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( int8s ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( std::vector<std::vector<std::uint8_t>>{ header, payload } ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( std::vector<std::vector<std::uint8_t>>{ header, payload } ) )
+        .WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, flush() ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, flush() ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.put( 'x' ).is_error() );
+    EXPECT_FALSE( buffer.put( &*string.begin(), &*string.end() ).is_error() );
+    EXPECT_FALSE( buffer.put( string.c_str() ).is_error() );
+    EXPECT_FALSE( buffer.put( std::uint8_t{ 0x7C } ).is_error() );
+    EXPECT_FALSE( buffer.put( &*uint8s.begin(), &*uint8s.end() ).is_error() );
+    EXPECT_FALSE( buffer.put( std::int8_t{ -0x41 } ).is_error() );
+    EXPECT_FALSE( buffer.put( &*int8s.begin(), &*int8s.end() ).is_error() );
+    EXPECT_FALSE( buffer.put( &*segments.begin(), &*segments.end() ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Tee_Stream_Buffer properly handles a
+ *        picolibrary::Tee_Failure_Policy::DROP sink error.
+ */
+TEST( failurePolicy, drop )
+{
+    auto const in_sequence = InSequence{};
+
+    auto sink_a = Mock_Stream_Buffer{};
+    auto sink_b = Mock_Stream_Buffer{};
+
+    auto buffer = Tee_Stream_Buffer{ Tee_Sink{ &sink_a, Tee_Failure_Policy::DROP },
+                                     Tee_Sink{ &sink_b, Tee_Failure_Policy::PROPAGATE } };
+
+    EXPECT_CALL( sink_a, put( A<std::string>() ) ).WillOnce( Return( Mock_Error{ 61 } ) );
+    EXPECT_CALL( sink_b, put( std::string{ "a9" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( std::string{ "K" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( std::string{ "K" } ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.put( "a9" ).is_error() );
+    EXPECT_FALSE( buffer.degraded( 0 ) );
+
+    EXPECT_FALSE( buffer.put( "K" ).is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Tee_Stream_Buffer properly handles a
+ *        picolibrary::Tee_Failure_Policy::DEGRADE sink error.
+ */
+TEST( failurePolicy, degrade )
+{
+    auto const in_sequence = InSequence{};
+
+    auto sink_a = Mock_Stream_Buffer{};
+    auto sink_b = Mock_Stream_Buffer{};
+
+    auto buffer = Tee_Stream_Buffer{ Tee_Sink{ &sink_a, Tee_Failure_Policy::DEGRADE },
+                                     Tee_Sink{ &sink_b, Tee_Failure_Policy::PROPAGATE } };
+
+    EXPECT_CALL( sink_a, put( A<std::string>() ) ).WillOnce( Return( Mock_Error{ 204 } ) );
+    EXPECT_CALL( sink_b, put( std::string{ "Wf" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( std::string{ "3" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, flush() ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_a, put( std::string{ "u" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( std::string{ "u" } ) ).WillOnce( Return( Result<void>{} ) );
+
+    EXPECT_FALSE( buffer.put( "Wf" ).is_error() );
+    EXPECT_TRUE( buffer.degraded( 0 ) );
+    EXPECT_FALSE( buffer.degraded( 1 ) );
+
+    EXPECT_FALSE( buffer.put( "3" ).is_error() );
+    EXPECT_FALSE( buffer.flush().is_error() );
+
+    buffer.clear_degradation();
+
+    EXPECT_FALSE( buffer.degraded( 0 ) );
+
+    EXPECT_FALSE( buffer.put( "u" ).is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Tee_Stream_Buffer properly handles a
+ *        picolibrary::Tee_Failure_Policy::PROPAGATE sink error.
+ */
+TEST( failurePolicy, propagate )
+{
+    auto const in_sequence = InSequence{};
+
+    auto sink_a = Mock_Stream_Buffer{};
+    auto sink_b = Mock_Stream_Buffer{};
+    auto sink_c = Mock_Stream_Buffer{};
+
+    auto buffer = Tee_Stream_Buffer{ Tee_Sink{ &sink_a, Tee_Failure_Policy::PROPAGATE },
+                                     Tee_Sink{ &sink_b, Tee_Failure_Policy::PROPAGATE },
+                                     Tee_Sink{ &sink_c, Tee_Failure_Policy::PROPAGATE } };
+
+    auto const error = Mock_Error{ 17 };
+
+    EXPECT_CALL( sink_a, put( SafeMatcherCast<char>( Eq( 'n' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( A<char>() ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( sink_c, put( A<char>() ) ).WillOnce( Return( Mock_Error{ 118 } ) );
+    EXPECT_CALL( sink_a, put( SafeMatcherCast<char>( Eq( 'J' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( SafeMatcherCast<char>( Eq( 'J' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_c, put( SafeMatcherCast<char>( Eq( 'J' ) ) ) ).WillOnce( Return( Result<void>{} ) );
+
+    auto const result = buffer.put( 'n' );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_FALSE( buffer.degraded( 1 ) );
+
+    EXPECT_FALSE( buffer.put( 'J' ).is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Tee_Output_Stream::print() formats once and forwards the
+ *        formatted output to each sink.
+ */
+TEST( teeOutputStreamPrint, worksProperly )
+{
+    auto const in_sequence = InSequence{};
+
+    auto sink_a = Mock_Stream_Buffer{};
+    auto sink_b = Mock_Stream_Buffer{};
+
+    auto stream = Tee_Output_Stream{ Tee_Sink{ &sink_a, Tee_Failure_Policy::PROPAGATE },
+                                     Tee_Sink{ &sink_b, Tee_Failure_Policy::DEGRADE } };
+
+    EXPECT_CALL( sink_a, put( std::string{ "qT" } ) ).WillOnce( Return( Result<void>{} ) );
+    EXPECT_CALL( sink_b, put( std::string{ "qT" } ) ).WillOnce( Return( Mock_Error{ 9 } ) );
+    EXPECT_CALL( sink_a, put( std::string{ "7m" } ) ).WillOnce( Return( Result<void>{} ) );
+
+    auto const result = stream.print( "qT", "7m" );
+
+    EXPECT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), 4 );
+
+    EXPECT_TRUE( stream.is_nominal() );
+    EXPECT_TRUE( stream.degraded( 1 ) );
+}
+
+/**
+ * \brief Verify picolibrary::Tee_Output_Stream properly handles a
+ *        picolibrary::Tee_Failure_Policy::PROPAGATE sink error.
+ */
+TEST( teeOutputStreamPrintErrorHandling, propagatedError )
+{
+    auto const in_sequence = InSequence{};
+
+    auto sink_a = Mock_Stream_Buffer{};
+    auto sink_b = Mock_Stream_Buffer{};
+
+    auto stream = Tee_Output_Stream{ Tee_Sink{ &sink_a, Tee_Failure_Policy::PROPAGATE },
+                                     Tee_Sink{ &sink_b, Tee_Failure_Policy::DROP } };
+
+    auto const error = Mock_Error{ 152 };
+
+    EXPECT_CALL( sink_a, put( std::string{ "e0" } ) ).WillOnce( Return( error ) );
+    EXPECT_CALL( sink_b, put( std::string{ "e0" } ) ).WillOnce( Return( Result<void>{} ) );
+
+    auto const result = stream.put( "e0" );
+
+    EXPECT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), error );
+
+    EXPECT_TRUE( stream.fatal_error_present() );
+}
+
+/**
+ * \brief Verify picolibrary::Tee_Output_Stream forwards output to reliable sinks, and that
+ *        reliable sinks are unaffected by other sinks' errors.
+ */
+TEST( reliableSink, worksProperly )
+{
+    auto sink_a = Mock_Stream_Buffer{};
+    auto sink_b = Reliable_String_Stream_Buffer{};
+    auto sink_c = Circular_Stream_Buffer<std::uint8_t, 4>{};
+
+    auto stream = Tee_Output_Stream{ Tee_Sink{ &sink_a, Tee_Failure_Policy::DEGRADE },
+                                     Tee_Sink{ &sink_b },
+                                     Tee_Sink{ &sink_c } };
+
+    EXPECT_CALL( sink_a, put( std::string{ "Xb" } ) ).WillOnce( Return( Mock_Error{ 41 } ) );
+
+    EXPECT_FALSE( stream.print( "Xb", 'U', "4s" ).is_error() );
+
+    EXPECT_TRUE( stream.degraded( 0 ) );
+    EXPECT_FALSE( stream.degraded( 1 ) );
+    EXPECT_FALSE( stream.degraded( 2 ) );
+
+    EXPECT_EQ( sink_b.string(), "XbU4s" );
+
+    EXPECT_EQ( sink_c.size(), 4 );
+    EXPECT_EQ( sink_c.overwritten(), 1 );
+
+    auto crash_log = std::string{};
+    for ( ; not sink_c.empty(); sink_c.pop() ) {
+        crash_log.push_back( sink_c.front() );
+    } // for
+
+    EXPECT_EQ( crash_log, "bU4s" );
+}
+
+/**
+ * \brief Verify picolibrary::Circular_Stream_Buffer overwrites the oldest characters when
+ *        full.
+ */
+TEST( circularStreamBuffer, worksProperly )
+{
+    auto buffer = Circular_Stream_Buffer<std::uint8_t, 4>{};
+
+    EXPECT_TRUE( buffer.empty() );
+
+    buffer.put( 'r' );
+    buffer.put( std::uint8_t{ 0x41 } );
+    buffer.put( std::int8_t{ 0x42 } );
+    buffer.put( "cde" );
+
+    EXPECT_EQ( buffer.size(), 4 );
+    EXPECT_EQ( buffer.overwritten(), 2 );
+    EXPECT_EQ( buffer.front(), 'B' );
+
+    buffer.pop();
+
+    EXPECT_EQ( buffer.front(), 'c' );
+
+    buffer.clear();
+
+    EXPECT_TRUE( buffer.empty() );
+    EXPECT_EQ( buffer.overwritten(), 0 );
+}
+
+/**
+ * \brief Execute the picolibrary::Tee_Stream_Buffer automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
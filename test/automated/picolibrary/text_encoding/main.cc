@@ -0,0 +1,247 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary::Text_Encoding automated test program.
+ */
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/error.h"
+#include "picolibrary/text_encoding.h"
+
+namespace {
+
+using ::picolibrary::Generic_Error;
+using ::picolibrary::Text_Encoding::Base16_Decoder;
+using ::picolibrary::Text_Encoding::base16_encoded_size;
+using ::picolibrary::Text_Encoding::Base64_Decoder;
+using ::picolibrary::Text_Encoding::base64_encoded_size;
+using ::picolibrary::Text_Encoding::encode_base16;
+using ::picolibrary::Text_Encoding::encode_base64;
+
+auto bytes( std::string_view string ) -> std::vector<std::uint8_t>
+{
+    return { string.begin(), string.end() };
+}
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Text_Encoding::encode_base16() works properly.
+ */
+TEST( encodeBase16, worksProperly )
+{
+    auto const data = bytes( "\x01\x9A\xFF" );
+
+    auto encoded = std::string( base16_encoded_size( data.size() ), '\0' );
+
+    auto const end = encode_base16( data.begin(), data.end(), encoded.data() );
+
+    EXPECT_EQ( end, encoded.data() + encoded.size() );
+    EXPECT_EQ( encoded, "019AFF" );
+}
+
+/**
+ * \brief Verify picolibrary::Text_Encoding::encode_base64() works properly.
+ */
+TEST( encodeBase64, worksProperly )
+{
+    struct {
+        std::string_view data;
+        std::string_view encoded;
+    } const test_cases[]{
+        { "", "" },
+        { "f", "Zg==" },
+        { "fo", "Zm8=" },
+        { "foo", "Zm9v" },
+        { "foob", "Zm9vYg==" },
+        { "fooba", "Zm9vYmE=" },
+        { "foobar", "Zm9vYmFy" },
+    };
+
+    for ( auto const test_case : test_cases ) {
+        auto encoded = std::string( base64_encoded_size( test_case.data.size() ), '\0' );
+
+        auto const end = encode_base64( test_case.data.begin(), test_case.data.end(), encoded.data() );
+
+        EXPECT_EQ( end, encoded.data() + encoded.size() );
+        EXPECT_EQ( encoded, test_case.encoded );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::Text_Encoding::Base16_Decoder works properly when encoded
+ *        data is split across ranges.
+ */
+TEST( base16Decoder, worksProperly )
+{
+    auto decoder = Base16_Decoder{};
+
+    auto const first  = std::string_view{ "0a9" };
+    auto const second = std::string_view{ "FfE" };
+    auto const third  = std::string_view{ "03" };
+
+    auto decoded = std::vector<std::uint8_t>( 4 );
+
+    EXPECT_EQ( decoder.decoded_size_max( first.size() ), 1 );
+
+    auto result = decoder.decode( first.begin(), first.end(), decoded.data() );
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), decoded.data() + 1 );
+
+    EXPECT_EQ( decoder.decoded_size_max( second.size() ), 2 );
+
+    result = decoder.decode( second.begin(), second.end(), result.value() );
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), decoded.data() + 3 );
+
+    result = decoder.decode( third.begin(), third.end(), result.value() );
+    ASSERT_FALSE( result.is_error() );
+    EXPECT_EQ( result.value(), decoded.data() + 4 );
+
+    EXPECT_FALSE( decoder.finish().is_error() );
+
+    EXPECT_EQ( decoded, ( std::vector<std::uint8_t>{ 0x0A, 0x9F, 0xFE, 0x03 } ) );
+}
+
+/**
+ * \brief Verify picolibrary::Text_Encoding::Base16_Decoder properly handles invalid and
+ *        incomplete encoded data.
+ */
+TEST( base16Decoder, errorHandling )
+{
+    auto decoder = Base16_Decoder{};
+
+    auto decoded = std::vector<std::uint8_t>( 4 );
+
+    {
+        auto const encoded = std::string_view{ "0G" };
+
+        auto const result = decoder.decode( encoded.begin(), encoded.end(), decoded.data() );
+
+        ASSERT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+    }
+
+    decoder.reset();
+
+    {
+        auto const encoded = std::string_view{ "123" };
+
+        EXPECT_FALSE( decoder.decode( encoded.begin(), encoded.end(), decoded.data() ).is_error() );
+
+        auto const result = decoder.finish();
+
+        ASSERT_TRUE( result.is_error() );
+        EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+    }
+
+    EXPECT_FALSE( decoder.finish().is_error() );
+}
+
+/**
+ * \brief Verify picolibrary::Text_Encoding::Base64_Decoder works properly when encoded
+ *        data is split across ranges.
+ */
+TEST( base64Decoder, worksProperly )
+{
+    auto const encoded = std::string_view{ "Zm9vYmFyYg==" };
+
+    for ( auto split = std::size_t{ 0 }; split <= encoded.size(); ++split ) {
+        auto decoder = Base64_Decoder{};
+
+        auto decoded = std::vector<std::uint8_t>( 9 );
+
+        auto const first  = encoded.substr( 0, split );
+        auto const second = encoded.substr( split );
+
+        auto result = decoder.decode( first.begin(), first.end(), decoded.data() );
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), decoded.data() + ( split < 12 ? ( split / 4 ) * 3 : 7 ) );
+
+        EXPECT_LE(
+            static_cast<std::size_t>( result.value() - decoded.data() )
+                + decoder.decoded_size_max( second.size() ),
+            decoded.size() );
+
+        result = decoder.decode( second.begin(), second.end(), result.value() );
+        ASSERT_FALSE( result.is_error() );
+        EXPECT_EQ( result.value(), decoded.data() + 7 );
+
+        EXPECT_FALSE( decoder.finish().is_error() );
+
+        decoded.resize( 7 );
+        EXPECT_EQ( decoded, bytes( "foobarb" ) );
+    } // for
+}
+
+/**
+ * \brief Verify picolibrary::Text_Encoding::Base64_Decoder properly handles invalid and
+ *        incomplete encoded data.
+ */
+TEST( base64Decoder, errorHandling )
+{
+    auto const invalid_encodings = std::vector<std::string_view>{
+        "Zm9v!A==", "Z===", "Zm=v", "Zm8=Zm8=", "Zg==\x80", "\xC3\xA9",
+    };
+
+    for ( auto const encoded : invalid_encodings ) {
+        auto decoder = Base64_Decoder{};
+
+        auto decoded = std::vector<std::uint8_t>( 6 );
+
+        auto const result = decoder.decode( encoded.begin(), encoded.end(), decoded.data() );
+
+        ASSERT_TRUE( result.is_error() ) << encoded;
+        EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+    } // for
+
+    auto decoder = Base64_Decoder{};
+
+    auto decoded = std::vector<std::uint8_t>( 3 );
+
+    auto const encoded = std::string_view{ "Zm9" };
+
+    EXPECT_FALSE( decoder.decode( encoded.begin(), encoded.end(), decoded.data() ).is_error() );
+
+    auto const result = decoder.finish();
+
+    ASSERT_TRUE( result.is_error() );
+    EXPECT_EQ( result.error(), Generic_Error::RUNTIME_ERROR );
+}
+
+/**
+ * \brief Execute the picolibrary::Text_Encoding automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,220 @@
+/**
+ * picolibrary
+ *
+ * Copyright 2020-2024, Andrew Countryman <apcountryman@gmail.com> and the picolibrary
+ * contributors
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this
+ * file except in compliance with the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under
+ * the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ * KIND, either express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/**
+ * \file
+ * \brief picolibrary timer automated test program.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "picolibrary/event.h"
+#include "picolibrary/testing/automated/event.h"
+#include "picolibrary/timer.h"
+
+namespace {
+
+using ::picolibrary::Event_Timer;
+using ::picolibrary::Simple_Event;
+using ::picolibrary::Timer;
+using ::picolibrary::Timer_Service;
+using ::picolibrary::Testing::Automated::Mock_Event_Category;
+
+using Test_Timer_Service = Timer_Service<3, 2>;
+
+using Tick = Test_Timer_Service::Tick;
+
+class Expiration_Recorder {
+  public:
+    Expiration_Recorder( Test_Timer_Service const & service ) noexcept : m_service{ &service }
+    {
+    }
+
+    void operator()() noexcept
+    {
+        m_expirations.push_back( m_service->now() );
+    }
+
+    auto expirations() const noexcept -> std::vector<Tick> const &
+    {
+        return m_expirations;
+    }
+
+  private:
+    Test_Timer_Service const * m_service;
+
+    std::vector<Tick> m_expirations{};
+};
+
+class Event_Target {
+  public:
+    void post( Simple_Event const & event )
+    {
+        m_ids.push_back( event.id() );
+    }
+
+    auto ids() const noexcept -> std::vector<::picolibrary::Event_ID> const &
+    {
+        return m_ids;
+    }
+
+  private:
+    std::vector<::picolibrary::Event_ID> m_ids{};
+};
+
+} // namespace
+
+/**
+ * \brief Verify picolibrary::Timer_Service expires one-shot timers on the correct tick for
+ *        every supported timeout, regardless of the service's tick count when the timer
+ *        is started.
+ */
+TEST( timerService, oneShotExpiration )
+{
+    EXPECT_EQ( Test_Timer_Service::max_timeout(), 63 );
+
+    for ( auto offset = Tick{ 0 }; offset < 70; offset += 3 ) {
+        for ( auto timeout = Tick{ 1 }; timeout <= Test_Timer_Service::max_timeout(); ++timeout ) {
+            auto service  = Test_Timer_Service{};
+            auto recorder = Expiration_Recorder{ service };
+            auto timer    = Timer{ recorder };
+
+            service.advance( offset );
+            service.start( timer, timeout );
+
+            EXPECT_TRUE( timer.is_running() );
+            EXPECT_EQ( timer.expiration(), offset + timeout );
+
+            service.advance( Test_Timer_Service::max_timeout() + 1 );
+
+            EXPECT_FALSE( timer.is_running() );
+            EXPECT_EQ( recorder.expirations(), std::vector<Tick>{ offset + timeout } );
+        } // for
+    }     // for
+}
+
+/**
+ * \brief Verify picolibrary::Timer_Service re-arms periodic timers, and stops and restarts
+ *        timers properly.
+ */
+TEST( timerService, periodicStopRestart )
+{
+    auto service = Test_Timer_Service{};
+
+    auto periodic_recorder = Expiration_Recorder{ service };
+    auto periodic          = Timer{ periodic_recorder };
+
+    auto one_shot_recorder = Expiration_Recorder{ service };
+    auto one_shot          = Timer{ one_shot_recorder };
+
+    service.start( periodic, 5, 20 );
+    service.start( one_shot, 10 );
+    service.start( one_shot, 30 );
+
+    service.advance( 46 );
+
+    EXPECT_EQ( periodic_recorder.expirations(), ( std::vector<Tick>{ 5, 25, 45 } ) );
+    EXPECT_EQ( one_shot_recorder.expirations(), std::vector<Tick>{ 30 } );
+    EXPECT_TRUE( periodic.is_running() );
+
+    service.stop( periodic );
+    service.stop( one_shot );
+
+    EXPECT_FALSE( periodic.is_running() );
+
+    service.advance( 100 );
+
+    EXPECT_EQ( periodic_recorder.expirations().size(), 3 );
+
+    {
+        auto destroyed = Timer{ one_shot_recorder };
+
+        service.start( destroyed, 2 );
+    }
+
+    service.advance( 10 );
+
+    EXPECT_EQ( one_shot_recorder.expirations().size(), 1 );
+}
+
+/**
+ * \brief Verify picolibrary::Timer_Service::next_deadline() and
+ *        picolibrary::Timer_Service::sleep() work properly.
+ */
+TEST( timerService, tickless )
+{
+    auto service  = Test_Timer_Service{};
+    auto recorder = Expiration_Recorder{ service };
+    auto timer    = Timer{ recorder };
+
+    EXPECT_EQ( service.next_deadline(), Test_Timer_Service::NO_DEADLINE );
+
+    service.start( timer, 3 );
+
+    EXPECT_EQ( service.next_deadline(), 3 );
+
+    service.start( timer, 50 );
+
+    auto requests = std::vector<Tick>{};
+
+    while ( timer.is_running() ) {
+        service.sleep( [ & ]( Tick deadline ) {
+            requests.push_back( deadline );
+
+            return deadline;
+        } );
+    } // while
+
+    EXPECT_EQ( requests, ( std::vector<Tick>{ 48, 2 } ) );
+    EXPECT_EQ( recorder.expirations(), std::vector<Tick>{ 50 } );
+}
+
+/**
+ * \brief Verify picolibrary::Event_Timer posts its timeout event when it expires.
+ */
+TEST( eventTimer, worksProperly )
+{
+    auto service = Test_Timer_Service{};
+    auto target  = Event_Target{};
+    auto timer   = Event_Timer<Event_Target, Simple_Event>{
+        target, Simple_Event{ Mock_Event_Category::instance(), 7 }
+    };
+
+    service.start( timer, 4, 4 );
+
+    service.advance( 12 );
+
+    EXPECT_EQ( target.ids(), ( std::vector<::picolibrary::Event_ID>{ 7, 7, 7 } ) );
+}
+
+/**
+ * \brief Execute the picolibrary timer automated tests.
+ *
+ * \param[in] argc The number of arguments to pass to testing::InitGoogleMock().
+ * \param[in] argv The array  of arguments to pass to testing::InitGoogleMock().
+ *
+ * \return See Google Test's RUN_ALL_TESTS().
+ */
+int main( int argc, char * argv[] )
+{
+    ::testing::InitGoogleMock( &argc, argv );
+
+    return RUN_ALL_TESTS();
+}